@@ -7,6 +7,7 @@
 #pragma once
 
 #include "../utils/error_handling.hpp"
+#include "../utils/id_interner.hpp"
 #include <QObject>
 #include <QString>
 #include <QJsonObject>
@@ -24,6 +25,7 @@
 #include <atomic>
 #include <typeindex>
 #include <any>
+#include <span>
 
 namespace qtplugin {
 
@@ -150,6 +152,7 @@ public:
  */
 struct Subscription {
     std::string subscriber_id;
+    SymbolId subscriber;                 ///< Interned subscriber_id
     std::type_index message_type;
     std::any handler;
     std::function<bool(const IMessage&)> filter;
@@ -158,7 +161,7 @@ struct Subscription {
     uint64_t message_count = 0;
     
     Subscription(std::string_view id, std::type_index type, std::any h)
-        : subscriber_id(id), message_type(type), handler(std::move(h))
+        : subscriber_id(id), subscriber(IdInterner::instance().intern(id)), message_type(type), handler(std::move(h))
         , created_at(std::chrono::system_clock::now()) {}
 };
 
@@ -255,6 +258,13 @@ public:
      * @return true if subscriber exists
      */
     virtual bool has_subscriber(std::string_view subscriber_id) const = 0;
+
+    /**
+     * @brief Check if subscriber exists
+     * @param subscriber Interned subscriber identifier
+     * @return true if subscriber has any subscriptions
+     */
+    bool has_subscriber(PluginHandle subscriber) const { return has_subscriber(subscriber.id()); }
     
     /**
      * @brief Get message bus statistics
@@ -286,6 +296,17 @@ public:
      */
     virtual std::vector<QJsonObject> message_log(size_t limit = 100) const = 0;
 
+    /**
+     * @brief Set hook invoked for each explicit recipient before delivery
+     *
+     * Used by the plugin manager to activate lazily registered plugins
+     * the first time a message is addressed to them.
+     * @param activator Callback receiving the recipient identifier
+     */
+    virtual void set_recipient_activator(std::function<void(std::string_view)> activator) {
+        (void)activator;
+    }
+
 protected:
     virtual qtplugin::expected<void, PluginError> publish_impl(std::shared_ptr<IMessage> message,
                                                                DeliveryMode mode,
@@ -318,11 +339,13 @@ public:
     std::vector<std::string> subscribers(std::type_index message_type) const override;
     std::vector<Subscription> subscriptions(std::string_view subscriber_id) const override;
     bool has_subscriber(std::string_view subscriber_id) const override;
+    bool has_subscriber(PluginHandle subscriber) const;
     QJsonObject statistics() const override;
     void clear() override;
     void set_logging_enabled(bool enabled) override;
     bool is_logging_enabled() const override;
     std::vector<QJsonObject> message_log(size_t limit = 100) const override;
+    void set_recipient_activator(std::function<void(std::string_view)> activator) override;
 
 signals:
     /**
@@ -364,7 +387,8 @@ protected:
 private:
     mutable std::shared_mutex m_subscriptions_mutex;
     std::unordered_map<std::type_index, std::vector<std::unique_ptr<Subscription>>> m_subscriptions;
-    std::unordered_map<std::string, std::unordered_set<std::type_index>> m_subscriber_types;
+    std::unordered_map<SymbolId, std::unordered_set<std::type_index>> m_subscriber_types;
+    std::function<void(std::string_view)> m_recipient_activator;
     
     mutable std::shared_mutex m_log_mutex;
     std::atomic<bool> m_logging_enabled{false};
@@ -377,10 +401,9 @@ private:
     std::atomic<uint64_t> m_delivery_failures{0};
     
     void log_message(const IMessage& message, const std::vector<std::string>& recipients);
-    qtplugin::expected<void, PluginError> deliver_message(const IMessage& message,
-                                                          const std::vector<std::string>& recipients);
-    std::vector<std::string> find_recipients(std::type_index message_type, 
-                                            const std::vector<std::string>& specific_recipients) const;
+    // Returns the number of addressed subscribers; all active ones when broadcasting
+    qtplugin::expected<std::size_t, PluginError> deliver_message(const IMessage& message, bool broadcast,
+                                                                 std::span<const SymbolId> recipients);
 };
 
 } // namespace qtplugin
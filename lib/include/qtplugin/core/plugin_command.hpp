@@ -0,0 +1,251 @@
+/**
+ * @file plugin_command.hpp
+ * @brief Plugin command types: handle-based fast path and batches
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "../utils/error_handling.hpp"
+#include "../utils/transparent_hash.hpp"
+#include <QCborValue>
+#include <QJsonObject>
+#include <QByteArray>
+#include <QString>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace qtplugin {
+
+/**
+ * @brief Integer handle of a command registered by a plugin
+ *
+ * Resolved once by name and then used for every call. Handles are only valid
+ * for the plugin instance that issued them; resolve again after a reload.
+ */
+struct CommandHandle {
+    static constexpr std::uint32_t invalid_value = 0xFFFFFFFFu;
+
+    std::uint32_t value = invalid_value;
+
+    constexpr bool is_valid() const noexcept { return value != invalid_value; }
+    friend constexpr bool operator==(CommandHandle, CommandHandle) = default;
+};
+
+/**
+ * @brief Result of a JSON command
+ */
+using CommandResult = qtplugin::expected<QJsonObject, PluginError>;
+
+/**
+ * @brief One command of a batch, as seen by the target plugin
+ *
+ * The command name refers to storage owned by the caller and is only valid
+ * for the duration of IPlugin::execute_commands().
+ */
+struct CommandCall {
+    std::string_view command;
+    QJsonObject parameters;
+};
+
+/**
+ * @brief One command of a cross-plugin batch sent through PluginManager
+ */
+struct CommandRequest {
+    std::string plugin_id;
+    std::string command;
+    QJsonObject parameters;
+};
+
+/**
+ * @brief Conversion of typed command parameters and results to CBOR
+ *
+ * Specialize for parameter structs with
+ * `static QCborValue encode(const T&)` and
+ * `static qtplugin::expected<T, PluginError> decode(const QCborValue&)`.
+ * Encoding structs positionally into a pre-sized QCborArray avoids key
+ * strings altogether.
+ */
+template<typename T>
+struct CommandCodec;
+
+/**
+ * @brief Type usable as typed command parameters or result
+ */
+template<typename T>
+concept CommandCodable = requires(const T& value, const QCborValue& cbor) {
+    { CommandCodec<T>::encode(value) } -> std::convertible_to<QCborValue>;
+    { CommandCodec<T>::decode(cbor) } -> std::same_as<qtplugin::expected<T, PluginError>>;
+};
+
+template<>
+struct CommandCodec<QCborValue> {
+    static QCborValue encode(const QCborValue& value) { return value; }
+    static qtplugin::expected<QCborValue, PluginError> decode(const QCborValue& value) { return value; }
+};
+
+template<>
+struct CommandCodec<bool> {
+    static QCborValue encode(bool value) { return QCborValue(value); }
+    static qtplugin::expected<bool, PluginError> decode(const QCborValue& value) {
+        if (!value.isBool()) {
+            return make_error<bool>(PluginErrorCode::InvalidParameters, "Expected a boolean");
+        }
+        return value.toBool();
+    }
+};
+
+template<std::integral T>
+struct CommandCodec<T> {
+    static QCborValue encode(T value) { return QCborValue(static_cast<qint64>(value)); }
+    static qtplugin::expected<T, PluginError> decode(const QCborValue& value) {
+        if (!value.isInteger()) {
+            return make_error<T>(PluginErrorCode::InvalidParameters, "Expected an integer");
+        }
+        return static_cast<T>(value.toInteger());
+    }
+};
+
+template<std::floating_point T>
+struct CommandCodec<T> {
+    static QCborValue encode(T value) { return QCborValue(static_cast<double>(value)); }
+    static qtplugin::expected<T, PluginError> decode(const QCborValue& value) {
+        if (!value.isDouble() && !value.isInteger()) {
+            return make_error<T>(PluginErrorCode::InvalidParameters, "Expected a number");
+        }
+        return static_cast<T>(value.toDouble());
+    }
+};
+
+template<>
+struct CommandCodec<QString> {
+    static QCborValue encode(const QString& value) { return QCborValue(value); }
+    static qtplugin::expected<QString, PluginError> decode(const QCborValue& value) {
+        if (!value.isString()) {
+            return make_error<QString>(PluginErrorCode::InvalidParameters, "Expected a string");
+        }
+        return value.toString();
+    }
+};
+
+template<>
+struct CommandCodec<QByteArray> {
+    static QCborValue encode(const QByteArray& value) { return QCborValue(value); }
+    static qtplugin::expected<QByteArray, PluginError> decode(const QCborValue& value) {
+        if (!value.isByteArray()) {
+            return make_error<QByteArray>(PluginErrorCode::InvalidParameters, "Expected a byte array");
+        }
+        return value.toByteArray();
+    }
+};
+
+/**
+ * @brief Per-plugin table of handle-addressed commands
+ *
+ * Plugins register their commands once, typically while initializing, and
+ * implement IPlugin::resolve_command() and IPlugin::invoke_command() by
+ * delegating to find() and invoke(). Registration is not synchronized;
+ * lookups and invocations may run concurrently once registration is done.
+ */
+class CommandTable {
+public:
+    using Handler = std::function<qtplugin::expected<QCborValue, PluginError>(const QCborValue&)>;
+
+    /**
+     * @brief Register a command taking and returning CBOR
+     * @param name Command name
+     * @param handler Command implementation
+     * @return Handle of the command; re-registering a name keeps its handle
+     */
+    CommandHandle register_command(std::string_view name, Handler handler);
+
+    /**
+     * @brief Register a command with typed parameters and result
+     * @tparam Params Parameter type, decoded with CommandCodec<Params>
+     * @tparam Result Result type, encoded with CommandCodec<Result>
+     * @param name Command name
+     * @param handler Callable taking const Params& and returning expected<Result, PluginError>
+     * @return Handle of the command
+     */
+    template<CommandCodable Params, CommandCodable Result, typename Callable>
+        requires std::is_invocable_r_v<qtplugin::expected<Result, PluginError>, Callable&, const Params&>
+    CommandHandle register_command(std::string_view name, Callable handler) {
+        return register_command(name, Handler([handler = std::move(handler)](const QCborValue& cbor) mutable
+                                                  -> qtplugin::expected<QCborValue, PluginError> {
+            auto params = CommandCodec<Params>::decode(cbor);
+            if (!params) {
+                return qtplugin::unexpected<PluginError>{params.error()};
+            }
+            auto result = handler(params.value());
+            if (!result) {
+                return qtplugin::unexpected<PluginError>{result.error()};
+            }
+            return CommandCodec<Result>::encode(result.value());
+        }));
+    }
+
+    /**
+     * @brief Look up a command by name
+     * @param name Command name
+     * @return Command handle, or std::nullopt if not registered
+     */
+    std::optional<CommandHandle> find(std::string_view name) const;
+
+    /**
+     * @brief Invoke a command by handle
+     * @param handle Handle returned by register_command() or find()
+     * @param params Command parameters
+     * @return Command result or error information
+     */
+    qtplugin::expected<QCborValue, PluginError> invoke(CommandHandle handle, const QCborValue& params) const;
+
+    /**
+     * @brief Get the name of a registered command
+     * @return Command name, or an empty view for unknown handles
+     */
+    std::string_view name(CommandHandle handle) const noexcept;
+
+    /**
+     * @brief Get all registered command names in handle order
+     */
+    std::vector<std::string> names() const;
+
+    /**
+     * @brief Get the number of registered commands
+     */
+    std::size_t size() const noexcept { return m_entries.size(); }
+
+private:
+    struct Entry {
+        std::string name;
+        Handler handler;
+    };
+
+    std::vector<Entry> m_entries;
+    StringMap<CommandHandle> m_handles;
+};
+
+/**
+ * @brief Encode typed command parameters
+ */
+template<CommandCodable T>
+QCborValue encode_command_value(const T& value) {
+    return CommandCodec<T>::encode(value);
+}
+
+/**
+ * @brief Decode a typed command result
+ */
+template<CommandCodable T>
+qtplugin::expected<T, PluginError> decode_command_value(const QCborValue& value) {
+    return CommandCodec<T>::decode(value);
+}
+
+} // namespace qtplugin
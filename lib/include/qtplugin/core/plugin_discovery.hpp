@@ -0,0 +1,142 @@
+/**
+ * @file plugin_discovery.hpp
+ * @brief Parallel, incremental plugin directory scanner
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "../utils/error_handling.hpp"
+#include "../utils/transparent_hash.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace qtplugin {
+
+/**
+ * @brief Result of sniffing a file header
+ */
+enum class PluginFileKind {
+    NotPlugin,       ///< Native binary without plugin metadata, or not a binary at all
+    QtPlugin,        ///< ELF shared object with Qt plugin metadata
+    NativeLibrary,   ///< PE or Mach-O binary; metadata presence not checked
+    Unknown          ///< Not a native library extension; needs the loader to decide
+};
+
+/**
+ * @brief Classify a file by its header without loading it
+ *
+ * Files with a native library extension (.so, .dll, .dylib) must start with
+ * the matching binary magic. ELF files are mapped and only qualify if
+ * find_qt_plugin_metadata() locates plugin metadata in them.
+ *
+ * @param file_path Path to the candidate file
+ * @return File classification
+ */
+PluginFileKind sniff_plugin_file(const std::filesystem::path& file_path);
+
+/**
+ * @brief Statistics of the most recent scan
+ */
+struct PluginScanStats {
+    std::size_t directories_scanned = 0;   ///< Directories listed from disk
+    std::size_t directories_reused = 0;    ///< Directories served from the index
+    std::size_t files_checked = 0;         ///< Files sniffed or passed to the loader
+    std::size_t candidates = 0;            ///< Plugin files found
+};
+
+/**
+ * @brief Plugin directory scanner
+ *
+ * Walks search paths and their subdirectories on a pool of worker threads.
+ * Each directory's candidate files and subdirectories are remembered together
+ * with the directory's modification time, so a rescan only lists directories
+ * whose entries changed. The index can be persisted between runs.
+ *
+ * A directory's modification time changes when entries are added, removed or
+ * renamed, which covers installing or replacing plugins; rewriting a file in
+ * place is not detected until the directory changes or the index is cleared.
+ */
+class PluginDiscovery {
+public:
+    /**
+     * @brief Predicate deciding whether a file that could not be sniffed is a plugin
+     */
+    using CandidateCheck = std::function<bool(const std::filesystem::path&)>;
+
+    /**
+     * @brief Constructor
+     * @param extensions Plugin file extensions including the dot
+     * @param check Fallback check for files sniff_plugin_file() cannot classify
+     */
+    PluginDiscovery(std::vector<std::string> extensions, CandidateCheck check);
+
+    PluginDiscovery(const PluginDiscovery&) = delete;
+    PluginDiscovery& operator=(const PluginDiscovery&) = delete;
+
+    /**
+     * @brief Scan directories for plugin files
+     * @param roots Directories to scan
+     * @param recursive Whether to descend into subdirectories
+     * @return Plugin file paths, sorted
+     */
+    std::vector<std::filesystem::path> scan(const std::vector<std::filesystem::path>& roots,
+                                            bool recursive = true);
+
+    /**
+     * @brief Set the number of worker threads
+     * @param threads Worker count, 0 for the hardware concurrency
+     */
+    void set_max_threads(std::size_t threads);
+
+    /**
+     * @brief Load a persisted directory index, merging it into the current one
+     * @param index_file Index file written by save_index()
+     * @return Success or error information
+     */
+    qtplugin::expected<void, PluginError> load_index(const std::filesystem::path& index_file);
+
+    /**
+     * @brief Persist the directory index
+     * @param index_file Destination file
+     * @return Success or error information
+     */
+    qtplugin::expected<void, PluginError> save_index(const std::filesystem::path& index_file) const;
+
+    /**
+     * @brief Forget all cached directories
+     */
+    void clear_index();
+
+    /**
+     * @brief Get statistics of the most recent scan
+     */
+    PluginScanStats last_scan_stats() const;
+
+private:
+    struct DirectoryEntry {
+        std::int64_t mtime = 0;
+        std::vector<std::string> candidates;      ///< File names
+        std::vector<std::string> subdirectories;  ///< Directory names
+    };
+
+    DirectoryEntry list_directory(const std::filesystem::path& directory, std::int64_t mtime,
+                                  std::size_t& files_checked) const;
+    bool has_plugin_extension(const std::filesystem::path& file_path) const;
+
+    std::vector<std::string> m_extensions;
+    CandidateCheck m_check;
+    std::atomic<std::size_t> m_max_threads{0};
+
+    mutable std::mutex m_index_mutex;
+    StringMap<DirectoryEntry> m_index;
+    PluginScanStats m_last_stats;
+};
+
+} // namespace qtplugin
@@ -8,9 +8,12 @@
 
 #include "../utils/error_handling.hpp"
 #include "../utils/version.hpp"
+#include "plugin_command.hpp"
+#include "plugin_metrics.hpp"
 #include <QObject>
 #include <QString>
 #include <QJsonObject>
+#include <QByteArray>
 #include <QUuid>
 #include <memory>
 #include <string>
@@ -18,6 +21,7 @@
 #include <vector>
 #include <optional>
 #include <chrono>
+#include <span>
 
 // Forward declarations
 class QWidget;
@@ -60,7 +64,8 @@ enum class PluginState {
     Stopping,       ///< Plugin is being stopped
     Stopped,        ///< Plugin is stopped
     Error,          ///< Plugin is in error state
-    Reloading       ///< Plugin is being reloaded
+    Reloading,      ///< Plugin is being reloaded
+    Discovered      ///< Plugin is registered from metadata but not loaded yet
 };
 
 /**
@@ -195,6 +200,10 @@ public:
     
     /**
      * @brief Initialize the plugin
+     *
+     * The plugin manager may call this on a worker thread to enforce the load
+     * timeout; QObjects created here belong to that thread unless moved.
+     *
      * @return Success or error information
      */
     virtual qtplugin::expected<void, PluginError> initialize() = 0;
@@ -247,6 +256,31 @@ public:
         shutdown();
         return initialize();
     }
+
+    // === State Transfer ===
+
+    /**
+     * @brief Capture the plugin's runtime state for hot reload
+     *
+     * The snapshot is handed to restore_state() of the replacement instance,
+     * which may be a newer build of the same plugin, so the format should be
+     * versioned by the plugin.
+     *
+     * @return Opaque binary snapshot or error information
+     */
+    virtual qtplugin::expected<QByteArray, PluginError> save_state() const {
+        return make_error<QByteArray>(PluginErrorCode::NotImplemented, "State snapshot not supported");
+    }
+
+    /**
+     * @brief Restore runtime state captured by save_state()
+     * @param state Snapshot produced by the instance being replaced
+     * @return Success or error information
+     */
+    virtual qtplugin::expected<void, PluginError> restore_state(const QByteArray& state) {
+        (void)state;
+        return make_error<void>(PluginErrorCode::NotImplemented, "State snapshot not supported");
+    }
     
     // === Capabilities ===
     
@@ -270,6 +304,22 @@ public:
      * @return Plugin priority level
      */
     virtual PluginPriority priority() const noexcept { return PluginPriority::Normal; }
+
+    // === Metrics ===
+
+    /**
+     * @brief Receive the slot to publish numeric metrics into
+     *
+     * Called by the plugin manager before configure() and initialize(), and
+     * again with the same slot for a reloaded instance. Register metric names
+     * while initializing and update them from any thread; the manager samples
+     * the slot in the background.
+     *
+     * @param slot Metrics slot of this plugin
+     */
+    virtual void attach_metrics(std::shared_ptr<PluginMetricsSlot> slot) {
+        Q_UNUSED(slot)
+    }
     
     // === Configuration ===
     
@@ -320,6 +370,24 @@ public:
     virtual qtplugin::expected<QJsonObject, PluginError>
     execute_command(std::string_view command, const QJsonObject& params = {}) = 0;
     
+    /**
+     * @brief Execute a batch of commands
+     *
+     * Override to amortize per-call setup such as a database transaction
+     * across the batch. The default runs execute_command() for each call.
+     *
+     * @param calls Commands in execution order
+     * @return One result per call, in the same order
+     */
+    virtual std::vector<CommandResult> execute_commands(std::span<const CommandCall> calls) {
+        std::vector<CommandResult> results;
+        results.reserve(calls.size());
+        for (const auto& call : calls) {
+            results.push_back(execute_command(call.command, call.parameters));
+        }
+        return results;
+    }
+    
     /**
      * @brief Get list of available commands
      * @return Vector of command names
@@ -335,6 +403,34 @@ public:
         auto commands = available_commands();
         return std::find(commands.begin(), commands.end(), command) != commands.end();
     }
+
+    /**
+     * @brief Resolve a command name to a handle for invoke_command()
+     *
+     * Plugins with high-rate commands register them in a CommandTable and
+     * delegate here, so callers pay for the name lookup once.
+     *
+     * @param command Command name
+     * @return Command handle, or std::nullopt if the command is only available
+     *         through execute_command()
+     */
+    virtual std::optional<CommandHandle> resolve_command(std::string_view command) const {
+        (void)command;
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Execute a command by handle
+     * @param command Handle returned by resolve_command()
+     * @param params Command parameters
+     * @return Command result or error information
+     */
+    virtual qtplugin::expected<QCborValue, PluginError>
+    invoke_command(CommandHandle command, const QCborValue& params = {}) {
+        (void)command;
+        (void)params;
+        return make_error<QCborValue>(PluginErrorCode::CommandNotFound, "Plugin has no handle-based commands");
+    }
     
     // === Dependencies ===
     
@@ -9,8 +9,10 @@
 #include "plugin_interface.hpp"
 #include "../utils/error_handling.hpp"
 #include "../utils/concepts.hpp"
+#include "../utils/transparent_hash.hpp"
 #include <QPluginLoader>
 #include <QJsonObject>
+#include <QTemporaryDir>
 #include <memory>
 #include <filesystem>
 #include <string>
@@ -21,6 +23,7 @@
 #include <mutex>
 #include <unordered_map>
 #include <functional>
+#include <atomic>
 
 namespace qtplugin {
 
@@ -52,6 +55,66 @@ public:
      * @return Success or error information
      */
     virtual qtplugin::expected<void, PluginError> unload(std::string_view plugin_id) = 0;
+
+    /**
+     * @brief Check applied to the file a reload is about to load
+     *
+     * Called with the path that will actually be loaded, which may be a
+     * private copy of the file given to stage_reload().
+     */
+    using ReloadValidator = std::function<qtplugin::expected<void, PluginError>(const std::filesystem::path&)>;
+
+    /**
+     * @brief Load a new build of a loaded plugin side by side with the current one
+     *
+     * The replacement stays pending and the current instance stays loaded
+     * until commit_reload() swaps them or abort_reload() drops the replacement.
+     *
+     * @param plugin_id Identifier of the loaded plugin to replace
+     * @param file_path Path to the new plugin file
+     * @param validate Check run before the new build is loaded; an error rejects the reload
+     * @return Replacement instance or error information
+     */
+    virtual qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+    stage_reload(std::string_view plugin_id, const std::filesystem::path& file_path,
+                 const ReloadValidator& validate = {}) {
+        (void)plugin_id;
+        (void)file_path;
+        (void)validate;
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::NotImplemented,
+                                                   "Loader does not support side-by-side reload");
+    }
+
+    /**
+     * @brief Make the staged replacement the loaded instance and release the old one
+     * @param plugin_id Plugin identifier
+     * @return Success or error information
+     */
+    virtual qtplugin::expected<void, PluginError> commit_reload(std::string_view plugin_id) {
+        (void)plugin_id;
+        return make_error<void>(PluginErrorCode::NotImplemented,
+                               "Loader does not support side-by-side reload");
+    }
+
+    /**
+     * @brief Discard a staged replacement, keeping the current instance
+     * @param plugin_id Plugin identifier
+     */
+    virtual void abort_reload(std::string_view plugin_id) {
+        (void)plugin_id;
+    }
+
+    /**
+     * @brief Read plugin metadata without loading the plugin library
+     * @param file_path Path to the plugin file
+     * @return Raw plugin metadata (IID, className, MetaData) or error information
+     */
+    virtual qtplugin::expected<QJsonObject, PluginError>
+    read_plugin_metadata(const std::filesystem::path& file_path) const {
+        (void)file_path;
+        return make_error<QJsonObject>(PluginErrorCode::NotImplemented,
+                                       "Loader cannot read metadata without loading the plugin");
+    }
     
     /**
      * @brief Get supported file extensions
@@ -85,6 +148,13 @@ public:
     qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
     load(const std::filesystem::path& file_path) override;
     qtplugin::expected<void, PluginError> unload(std::string_view plugin_id) override;
+    qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+    stage_reload(std::string_view plugin_id, const std::filesystem::path& file_path,
+                 const ReloadValidator& validate = {}) override;
+    qtplugin::expected<void, PluginError> commit_reload(std::string_view plugin_id) override;
+    void abort_reload(std::string_view plugin_id) override;
+    qtplugin::expected<QJsonObject, PluginError>
+    read_plugin_metadata(const std::filesystem::path& file_path) const override;
     std::vector<std::string> supported_extensions() const override;
     std::string_view name() const noexcept override;
     bool supports_hot_reload() const noexcept override;
@@ -112,19 +182,33 @@ private:
     struct LoadedPlugin {
         std::string id;
         std::filesystem::path file_path;
-        std::unique_ptr<QPluginLoader> qt_loader;
+        std::shared_ptr<QPluginLoader> qt_loader;  ///< Library lease shared with instance
         std::shared_ptr<IPlugin> instance;
     };
     
-    std::unordered_map<std::string, std::unique_ptr<LoadedPlugin>> m_loaded_plugins;
+    StringMap<std::unique_ptr<LoadedPlugin>> m_loaded_plugins;
+    StringMap<std::unique_ptr<LoadedPlugin>> m_staged_plugins;
     mutable std::shared_mutex m_plugins_mutex;
+    std::mutex m_shadow_mutex;
+    std::unique_ptr<QTemporaryDir> m_shadow_dir;   ///< Private directory for staged reloads
+    std::atomic<unsigned> m_shadow_counter{0};
     
     // Helper methods
+    qtplugin::expected<std::filesystem::path, PluginError> reload_directory();
+    qtplugin::expected<std::unique_ptr<LoadedPlugin>, PluginError>
+    open_library(const std::filesystem::path& library_path, const std::filesystem::path& source_path) const;
     qtplugin::expected<QJsonObject, PluginError> read_metadata(const std::filesystem::path& file_path) const;
     qtplugin::expected<std::string, PluginError> extract_plugin_id(const QJsonObject& metadata) const;
     bool is_valid_plugin_file(const std::filesystem::path& file_path) const;
 };
 
+/**
+ * @brief Extract the plugin identifier from raw Qt plugin metadata
+ * @param metadata Raw metadata as returned by read_plugin_metadata()
+ * @return Plugin ID (MetaData.id, MetaData.name or IID) or error information
+ */
+qtplugin::expected<std::string, PluginError> plugin_id_from_metadata(const QJsonObject& metadata);
+
 /**
  * @brief Plugin loader factory
  */
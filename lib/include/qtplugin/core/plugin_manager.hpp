@@ -8,6 +8,10 @@
 
 #include "plugin_interface.hpp"
 #include "plugin_loader.hpp"
+#include "plugin_discovery.hpp"
+#include "plugin_metrics.hpp"
+#include "plugin_usage_profile.hpp"
+#include "static_plugin_registry.hpp"
 #include "../communication/message_bus.hpp"
 #include "../security/security_manager.hpp"
 #include "../managers/configuration_manager.hpp"
@@ -17,13 +21,22 @@
 #include "../managers/resource_monitor.hpp"
 #include "../utils/error_handling.hpp"
 #include "../utils/concepts.hpp"
+#include "../utils/atomic_shared_ptr.hpp"
+#include "../utils/transparent_hash.hpp"
+#include "../utils/file_fingerprint.hpp"
+#include "../utils/epoch.hpp"
+#include "../utils/id_interner.hpp"
 #include <QObject>
 #include <QString>
 #include <QFileSystemWatcher>
 #include <QTimer>
+#include <QThreadPool>
+#include <QByteArray>
 #include <QJsonObject>
 #include <QJsonDocument>
+#include <array>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -34,8 +47,11 @@
 #include <shared_mutex>
 #include <atomic>
 #include <chrono>
+#include <concepts>
 #include <functional>
 #include <mutex>
+#include <optional>
+#include <set>
 
 namespace qtplugin {
 
@@ -57,11 +73,20 @@ struct PluginLoadOptions {
     bool check_dependencies = true;        ///< Check plugin dependencies
     bool initialize_immediately = true;    ///< Initialize plugin after loading
     bool enable_hot_reload = false;        ///< Enable hot reloading for this plugin
+    bool lazy_activation = false;          ///< Register from metadata only, load on first use
     SecurityLevel security_level = SecurityLevel::Basic;  ///< Security level to apply
-    std::chrono::milliseconds timeout = std::chrono::seconds{30};  ///< Loading timeout
+    std::chrono::milliseconds timeout = std::chrono::seconds{30};  ///< Deadline for configure() and initialize(); zero runs them inline
     QJsonObject configuration;             ///< Initial plugin configuration
 };
 
+/**
+ * @brief Once-only latch guarding the deferred activation of a plugin
+ */
+struct PluginActivationLatch {
+    std::once_flag flag;
+    std::optional<PluginError> error;    ///< Set if activation failed
+};
+
 /**
  * @brief Plugin information structure
  */
@@ -73,11 +98,16 @@ struct PluginInfo {
     std::chrono::system_clock::time_point load_time;
     std::chrono::system_clock::time_point last_activity;
     std::shared_ptr<IPlugin> instance;
-    std::unique_ptr<QPluginLoader> loader;
+    std::shared_ptr<QPluginLoader> loader;
     QJsonObject configuration;
     std::vector<std::string> error_log;
     QJsonObject metrics;
     bool hot_reload_enabled = false;
+    PluginLoadOptions load_options;                            ///< Options the plugin was loaded or registered with
+    std::optional<FileIdentity> file_identity;                 ///< Plugin file as it was validated
+    std::shared_ptr<PluginMetricsSlot> metrics_slot;           ///< Numeric metrics, kept across reloads
+    std::shared_ptr<PluginActivationLatch> activation_latch;   ///< Set while the plugin is Discovered
+    const StaticPluginEntry* static_entry = nullptr;           ///< Set for statically linked plugins
     
     /**
      * @brief Convert to JSON representation
@@ -85,6 +115,66 @@ struct PluginInfo {
     QJsonObject to_json() const;
 };
 
+/**
+ * @brief Immutable view of all registered plugins
+ *
+ * Published by PluginManager as a whole; entries are never modified after
+ * publication; a change replaces the entry and republishes the registry.
+ */
+using PluginRegistry = StringMap<std::shared_ptr<const PluginInfo>>;
+
+/**
+ * @brief Sampled metrics of one plugin
+ */
+struct PluginMetricsSample {
+    PluginState state = PluginState::Unloaded;
+    qint64 uptime_ms = 0;
+    std::uint64_t commands = 0;
+    std::uint64_t command_errors = 0;
+    std::size_t error_count = 0;
+    std::size_t estimated_memory_bytes = 0;
+    std::chrono::system_clock::time_point load_time;
+    std::vector<std::pair<std::string, double>> values;   ///< Metrics published by the plugin
+};
+
+/**
+ * @brief Metrics of all plugins taken in one sampling pass
+ */
+struct MetricsSnapshot {
+    std::chrono::system_clock::time_point taken_at;
+    std::chrono::nanoseconds sampling_cost{0};
+    StringMap<PluginMetricsSample> plugins;
+};
+
+/**
+ * @brief Outcome of PluginManager::restore_snapshot()
+ */
+struct SnapshotRestoreResult {
+    std::vector<std::string> restored;      ///< Verified unchanged plugins, loaded without validation
+    std::vector<std::string> revalidated;   ///< Changed plugins, loaded through the full pipeline
+    std::vector<std::string> failed;        ///< Plugins that could not be loaded
+};
+
+/**
+ * @brief Options for stopping all plugins or services
+ */
+struct ShutdownOptions {
+    std::chrono::milliseconds plugin_timeout = std::chrono::seconds{5};   ///< Deadline for one plugin to stop
+    std::chrono::milliseconds total_timeout = std::chrono::seconds{30};   ///< Deadline for the whole shutdown
+    std::size_t max_parallelism = 0;   ///< Plugins stopped concurrently; 0 uses the hardware concurrency
+};
+
+/**
+ * @brief Outcome of stopping all plugins or services
+ */
+struct ShutdownReport {
+    std::vector<std::string> stopped;    ///< Plugins that stopped in time
+    std::vector<std::string> failed;     ///< Plugins that reported an error or threw
+    std::vector<std::string> detached;   ///< Plugins abandoned at a deadline, still running or never stopped
+    std::vector<std::string> skipped;    ///< Dependencies of detached plugins, left running for them
+    std::chrono::milliseconds elapsed{0};
+};
+
 /**
  * @brief Plugin dependency graph node
  */
@@ -136,6 +226,17 @@ public:
     
     /**
      * @brief Load a plugin from file
+     *
+     * With a non-zero options.timeout, configure() and initialize() run on a
+     * worker thread, so a hung plugin cannot block the caller. A QObject
+     * plugin is moved to a QThread of its own for the duration and moved back,
+     * with the timers and children it created, once initialize() returns. A
+     * plugin that overruns the deadline is registered in the Error state
+     * without an instance and TimeoutError is returned, so callers such as
+     * load_all_plugins() carry on; its thread is abandoned. A zero timeout
+     * runs both inline on the calling thread. The latency of initialization
+     * is reported as the "init_latency_us" metric.
+     *
      * @param file_path Path to the plugin file
      * @param options Loading options
      * @return Plugin ID or error information
@@ -144,6 +245,18 @@ public:
     load_plugin(const std::filesystem::path& file_path,
                const PluginLoadOptions& options = {});
 
+    /**
+     * @brief Activate a lazily registered plugin
+     *
+     * Loads, configures and initializes a plugin registered with
+     * PluginLoadOptions::lazy_activation. Concurrent callers share a single
+     * activation; plugins that are already active are returned as is.
+     * @param plugin_id Plugin identifier
+     * @return Plugin instance or error information
+     */
+    qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+    activate_plugin(std::string_view plugin_id);
+
     /**
      * @brief Load plugin asynchronously
      * @param file_path Path to the plugin file
@@ -156,15 +269,35 @@ public:
 
     /**
      * @brief Unload a plugin
+     *
+     * The plugin is unpublished first, so new calls no longer reach it, then
+     * unload waits for calls already in flight through the manager before
+     * shutting the plugin down. The library stays mapped until the last
+     * outstanding get_plugin() reference is released.
+     *
      * @param plugin_id Plugin identifier
      * @param force Force unload even if other plugins depend on it
-     * @return Success or error information
+     * @return Success or error information; StateError when called from
+     *         inside a plugin call dispatched by this manager
      */
     qtplugin::expected<void, PluginError> unload_plugin(std::string_view plugin_id,
                                                         bool force = false);
 
     /**
      * @brief Reload a plugin
+     *
+     * When the loader supports it, the new build is loaded and initialized
+     * side by side while the current instance keeps serving; state is then
+     * handed over (IPlugin::save_state/restore_state, falling back to the
+     * "save_state"/"restore_state" commands) and the new instance is
+     * published atomically. The length of that hand-over window is recorded
+     * in the plugin metrics as "last_reload_interruption_us".
+     *
+     * The new build is staged on the calling thread, but configured,
+     * initialized and published on the manager's thread, which also shuts
+     * the old instance down; QObject plugins are moved there first. Calling
+     * from another thread blocks until the manager's event loop has done so.
+     *
      * @param plugin_id Plugin identifier
      * @param preserve_state Whether to preserve plugin state
      * @return Success or error information
@@ -176,6 +309,10 @@ public:
     
     /**
      * @brief Discover plugins in a directory
+     *
+     * Subdirectories are scanned in parallel and directories unchanged since
+     * the previous scan are served from the discovery index.
+     *
      * @param directory Directory to search
      * @param recursive Whether to search recursively
      * @return Vector of discovered plugin file paths
@@ -203,19 +340,150 @@ public:
     
     /**
      * @brief Load all plugins from search paths
+     *
+     * With signature validation the discovered files are validated as one
+     * batch first, see ISecurityManager::validate_plugins().
+     *
      * @param options Loading options to apply to all plugins
      * @return Number of successfully loaded plugins
      */
     int load_all_plugins(const PluginLoadOptions& options = {});
+
+    /**
+     * @brief Persist the discovery index so rescans after a restart skip unchanged directories
+     * @param index_file Index file; loaded now if it exists and rewritten after each load_all_plugins()
+     */
+    void set_discovery_index_path(const std::filesystem::path& index_file);
+
+    /**
+     * @brief Get statistics of the most recent directory scan
+     */
+    PluginScanStats last_discovery_stats() const;
+
+    // === Static Plugins ===
+
+    /**
+     * @brief Load statically linked plugins from a table
+     *
+     * Plugins are created by the table's factories in dependency order; no
+     * file is read, so file and signature validation do not apply. With lazy
+     * activation they are registered from their declared metadata and
+     * created on first use.
+     *
+     * @param table Table created with make_static_plugin_table()
+     * @param options Loading options to apply to all plugins
+     * @return Number of successfully loaded plugins
+     */
+    int load_static_plugins(std::span<const StaticPluginEntry> table, const PluginLoadOptions& options = {});
+
+    /**
+     * @brief Load all plugins registered with QTPLUGIN_REGISTER_STATIC_PLUGINS
+     * @param options Loading options to apply to all plugins
+     * @return Number of successfully loaded plugins
+     */
+    int load_static_plugins(const PluginLoadOptions& options = {});
+
+    /**
+     * @brief Load one statically linked plugin
+     * @param entry Table entry; must outlive the plugin manager
+     * @param options Loading options
+     * @return Plugin ID on success, error information on failure
+     */
+    qtplugin::expected<std::string, PluginError> load_static_plugin(const StaticPluginEntry& entry,
+                                                                    const PluginLoadOptions& options = {});
+
+    // === Usage Profile ===
+
+    /**
+     * @brief Persist which plugins are used, so later runs can preload them
+     *
+     * A plugin counts as used when a command is sent to it through the
+     * manager. The profile is loaded now if the file exists, and rewritten by
+     * save_usage_profile() and on destruction.
+     *
+     * @param profile_file Profile file
+     */
+    void set_usage_profile_path(const std::filesystem::path& profile_file);
+
+    /**
+     * @brief Write the usage profile including the current run
+     * @return Success or error information; NotImplemented if no path is set
+     */
+    qtplugin::expected<void, PluginError> save_usage_profile() const;
+
+    /**
+     * @brief Get the usage profile as loaded, without the current run
+     */
+    PluginUsageProfile usage_profile() const;
+
+    /**
+     * @brief Activate the plugins a run is likely to use, in the background
+     *
+     * Lazily registered plugins in the profile's hot set are activated one
+     * after another in predicted order of first use; all others stay
+     * deferred until used.
+     *
+     * @param min_score Minimum usage score, see PluginUsageRecord::usage_score
+     * @return Future of the IDs of the activated plugins
+     */
+    std::future<std::vector<std::string>> preload_hot_plugins(double min_score = 0.5);
+
+    /**
+     * @brief Save a warm-restart snapshot of the loaded plugins
+     *
+     * Records, in dependency order, each plugin's file identity and SHA-256
+     * digest, the options and security level it was validated with, its
+     * metadata and its current configuration, as a CBOR file readable only by
+     * the current user. A plugin whose file changed since it was validated is
+     * recorded without identity and digest.
+     *
+     * @param snapshot_file Destination file
+     * @return Success or error information
+     */
+    qtplugin::expected<void, PluginError> save_snapshot(const std::filesystem::path& snapshot_file) const;
+
+    /**
+     * @brief Load the plugins recorded in a snapshot
+     *
+     * Plugins whose file still has the recorded identity and digest are
+     * loaded in the recorded order without discovery, file and security
+     * validation or dependency checks; lazily activated ones are registered
+     * from the recorded metadata. Any mismatch, and every plugin of a snapshot
+     * that other users can write, goes through load_plugin().
+     *
+     * @param snapshot_file Snapshot written by save_snapshot()
+     * @return Per-plugin outcome, or error information if the snapshot is unreadable
+     */
+    qtplugin::expected<SnapshotRestoreResult, PluginError> restore_snapshot(const std::filesystem::path& snapshot_file);
     
     // === Plugin Access ===
     
     /**
      * @brief Get plugin by ID
+     *
+     * Plugins registered with lazy activation are loaded on first access.
      * @param plugin_id Plugin identifier
-     * @return Shared pointer to plugin, or nullptr if not found
+     * @return Shared pointer to plugin, or nullptr if not found or activation failed
      */
     std::shared_ptr<IPlugin> get_plugin(std::string_view plugin_id) const;
+
+    /**
+     * @brief Get plugin by handle
+     * @param plugin Handle returned by plugin_handle()
+     * @return Shared pointer to plugin, or nullptr if not found or activation failed
+     */
+    std::shared_ptr<IPlugin> get_plugin(PluginHandle plugin) const { return get_plugin(plugin.id()); }
+
+    /**
+     * @brief Intern a plugin ID for the handle overloads
+     *
+     * Handles stay valid for the lifetime of the process, also across
+     * unloading and reloading the plugin.
+     *
+     * @param plugin_id Plugin identifier
+     * @return Handle of the plugin ID
+     */
+    static PluginHandle plugin_handle(std::string_view plugin_id) { return PluginHandle(plugin_id); }
     
     /**
      * @brief Get plugin with specific interface type
@@ -228,10 +496,30 @@ public:
         auto plugin = get_plugin(plugin_id);
         return std::dynamic_pointer_cast<PluginType>(plugin);
     }
+
+    /**
+     * @brief Get a statically linked plugin as its concrete type
+     *
+     * The type is checked against the factory the plugin was created by, so
+     * no dynamic_cast is needed, and calls through the result can be
+     * devirtualised.
+     *
+     * @tparam PluginType Plugin type listed in the static plugin table
+     * @return Shared pointer to the plugin, or nullptr if it is not loaded as PluginType
+     */
+    template<concepts::StaticPlugin PluginType>
+    std::shared_ptr<PluginType> get_static_plugin() const {
+        constexpr std::string_view plugin_id = PluginType::static_info.id;
+        auto info = plugin_info_view(plugin_id);
+        if (!info || !info->static_entry || info->static_entry->create != &create_static_plugin<PluginType>) {
+            return nullptr;
+        }
+        return std::static_pointer_cast<PluginType>(get_plugin(plugin_id));
+    }
     
     /**
      * @brief Get all loaded plugins
-     * @return Vector of plugin IDs
+     * @return Vector of plugin IDs, including plugins still awaiting lazy activation
      */
     std::vector<std::string> loaded_plugins() const;
     
@@ -261,6 +549,34 @@ public:
      * @return Vector of plugin information for all loaded plugins
      */
     std::vector<PluginInfo> all_plugin_info() const;
+
+    /**
+     * @brief Get the current registry snapshot
+     *
+     * The snapshot is immutable and stays valid while it is held, regardless
+     * of plugins being loaded or unloaded in the meantime.
+     * @return Shared pointer to the published registry
+     */
+    std::shared_ptr<const PluginRegistry> registry_snapshot() const noexcept;
+
+    /**
+     * @brief Get plugin information without copying it
+     * @param plugin_id Plugin identifier
+     * @return Shared pointer to the immutable entry, or nullptr if not found
+     */
+    std::shared_ptr<const PluginInfo> plugin_info_view(std::string_view plugin_id) const;
+
+    /**
+     * @brief Visit every registered plugin without copying
+     * @param visitor Callable invoked with each plugin's information
+     */
+    template<std::invocable<const PluginInfo&> Visitor>
+    void for_each_plugin(Visitor&& visitor) const {
+        auto registry = registry_snapshot();
+        for (const auto& [id, info] : *registry) {
+            visitor(*info);
+        }
+    }
     
     // === Plugin State Management ===
     
@@ -271,9 +587,25 @@ public:
     int initialize_all_plugins();
     
     /**
-     * @brief Shutdown all plugins
+     * @brief Shutdown all plugins with the default ShutdownOptions
      */
     void shutdown_all_plugins();
+
+    /**
+     * @brief Shutdown all plugins in reverse dependency order
+     *
+     * All plugins are unpublished first. They are then stopped level by level,
+     * dependents before their dependencies, with the plugins of one level
+     * stopped concurrently. A plugin that misses its deadline is detached: its
+     * shutdown() keeps running on its own thread while the shutdown moves on.
+     * The dependencies of a detached plugin are skipped rather than stopped
+     * underneath it, and are released once its shutdown() returns.
+     * plugin_unloaded is emitted for every plugin removed from the registry.
+     *
+     * @param options Deadlines and parallelism
+     * @return Which plugins stopped, failed or were detached
+     */
+    ShutdownReport shutdown_all_plugins(const ShutdownOptions& options);
     
     /**
      * @brief Start all service plugins
@@ -286,6 +618,17 @@ public:
      * @return Number of successfully stopped services
      */
     int stop_all_services();
+
+    /**
+     * @brief Stop all service plugins in reverse dependency order
+     *
+     * Scheduled like shutdown_all_plugins(const ShutdownOptions&); the
+     * plugins stay loaded.
+     *
+     * @param options Deadlines and parallelism
+     * @return Which services stopped, failed or were detached
+     */
+    ShutdownReport stop_all_services(const ShutdownOptions& options);
     
     // === Dependency Management ===
     
@@ -346,6 +689,18 @@ public:
      * @brief Disable global hot reloading
      */
     void disable_global_hot_reload();
+
+    /**
+     * @brief Set how long a plugin file must stay unchanged before it is reloaded
+     * @param quiet_period Quiet period applied to file change events
+     */
+    void set_hot_reload_quiet_period(std::chrono::milliseconds quiet_period);
+
+    /**
+     * @brief Get the hot reload quiet period
+     * @return Current quiet period
+     */
+    std::chrono::milliseconds hot_reload_quiet_period() const;
     
     // === Configuration Management ===
     
@@ -421,6 +776,94 @@ public:
     qtplugin::expected<QJsonObject, PluginError> send_command(std::string_view plugin_id,
                                                               std::string_view command,
                                                               const QJsonObject& parameters = {});
+
+    /**
+     * @brief Send command to a plugin by handle
+     * @param plugin Handle returned by plugin_handle()
+     * @param command Command name
+     * @param parameters Command parameters
+     * @return Command result or error information
+     */
+    qtplugin::expected<QJsonObject, PluginError> send_command(PluginHandle plugin,
+                                                              std::string_view command,
+                                                              const QJsonObject& parameters = {}) {
+        return send_command(plugin.id(), command, parameters);
+    }
+
+    /**
+     * @brief Send a batch of commands to one or more plugins
+     *
+     * Requests are grouped by target plugin and each group is handed to the
+     * plugin's IPlugin::execute_commands() in request order. Groups of plugins
+     * that do not depend on each other run in parallel on the calling thread
+     * and idle threads of QThreadPool::globalInstance().
+     *
+     * @param requests Commands to execute
+     * @return One result per request, in request order
+     */
+    std::vector<CommandResult> send_commands(std::span<const CommandRequest> requests);
+
+    /**
+     * @brief Send a batch of commands, receiving results as they complete
+     * @param requests Commands to execute
+     * @param on_result Called once per request with its index; may be called
+     *        from worker threads, but never concurrently
+     */
+    void send_commands(std::span<const CommandRequest> requests,
+                       const std::function<void(std::size_t index, CommandResult result)>& on_result);
+
+    /**
+     * @brief Resolve a plugin command to a handle for the binary fast path
+     * @param plugin_id Plugin identifier
+     * @param command Command name
+     * @return Command handle, or CommandNotFound if the plugin only supports
+     *         JSON commands
+     */
+    qtplugin::expected<CommandHandle, PluginError> resolve_command(std::string_view plugin_id,
+                                                                   std::string_view command);
+
+    /**
+     * @brief Send a command by handle with CBOR parameters
+     * @param plugin_id Plugin identifier
+     * @param command Handle returned by resolve_command()
+     * @param parameters Command parameters
+     * @return Command result or error information
+     */
+    qtplugin::expected<QCborValue, PluginError> send_command(std::string_view plugin_id,
+                                                             CommandHandle command,
+                                                             const QCborValue& parameters = {});
+
+    /**
+     * @brief Send a command by plugin handle and command handle with CBOR parameters
+     * @param plugin Handle returned by plugin_handle()
+     * @param command Handle returned by resolve_command()
+     * @param parameters Command parameters
+     * @return Command result or error information
+     */
+    qtplugin::expected<QCborValue, PluginError> send_command(PluginHandle plugin,
+                                                             CommandHandle command,
+                                                             const QCborValue& parameters = {}) {
+        return send_command(plugin.id(), command, parameters);
+    }
+
+    /**
+     * @brief Send a command by handle with typed parameters and result
+     * @tparam Result Result type, decoded with CommandCodec<Result>
+     * @param plugin_id Plugin identifier
+     * @param command Handle returned by resolve_command()
+     * @param parameters Parameters, encoded with CommandCodec<Params>
+     * @return Command result or error information
+     */
+    template<CommandCodable Result, CommandCodable Params>
+    qtplugin::expected<Result, PluginError> send_command(std::string_view plugin_id,
+                                                         CommandHandle command,
+                                                         const Params& parameters) {
+        auto result = send_command(plugin_id, command, encode_command_value(parameters));
+        if (!result) {
+            return qtplugin::unexpected<PluginError>{result.error()};
+        }
+        return decode_command_value<Result>(result.value());
+    }
     
     /**
      * @brief Broadcast message to all plugins
@@ -440,19 +883,38 @@ public:
     
     /**
      * @brief Get system metrics
+     *
+     * Built from aggregates maintained on every registry change, so the cost
+     * does not depend on the number of plugins and no mutex is taken.
+     *
      * @return System-wide plugin metrics
      */
     QJsonObject system_metrics() const;
     
     /**
      * @brief Get plugin metrics
+     *
+     * Combines the latest sample with event metrics such as reload statistics;
+     * values published through the plugin's PluginMetricsSlot appear under
+     * "plugin_metrics".
+     *
      * @param plugin_id Plugin identifier
      * @return Plugin-specific metrics
      */
     QJsonObject plugin_metrics(std::string_view plugin_id) const;
+
+    /**
+     * @brief Get the latest metrics sample
+     * @return Sample taken by the background sampler, or nullptr if monitoring never ran
+     */
+    std::shared_ptr<const MetricsSnapshot> latest_metrics() const { return m_metrics_snapshot.load(); }
     
     /**
      * @brief Start performance monitoring
+     *
+     * Samples all plugins' metric slots on a background thread. Sampling only
+     * reads atomics from the published registry and never calls into plugins.
+     *
      * @param interval Monitoring interval
      */
     void start_monitoring(std::chrono::milliseconds interval = std::chrono::seconds{60});
@@ -524,9 +986,14 @@ signals:
      */
     void plugin_metrics_updated(const QString& plugin_id, const QJsonObject& metrics);
 
+    /**
+     * @brief Emitted when a plugin has been replaced by a reloaded instance
+     * @param plugin_id Plugin identifier
+     */
+    void plugin_reloaded(const QString& plugin_id);
+
 private slots:
     void on_file_changed(const QString& path);
-    void on_monitoring_timer();
 
 private:
     // Core components
@@ -539,34 +1006,131 @@ private:
     std::unique_ptr<IResourceLifecycleManager> m_resource_lifecycle_manager;
     std::unique_ptr<IResourceMonitor> m_resource_monitor;
     
-    // Plugin storage
-    mutable std::shared_mutex m_plugins_mutex;
-    std::unordered_map<std::string, std::unique_ptr<PluginInfo>> m_plugins;
+    // Plugin storage: readers load the published registry, writers serialize
+    // on m_registry_write_mutex and publish a modified copy
+    AtomicSharedPtr<const PluginRegistry> m_registry{std::make_shared<const PluginRegistry>()};
+    std::mutex m_registry_write_mutex;
+
+    // Registry aggregates, republished with every registry change so that
+    // system_metrics() never iterates plugins
+    static constexpr std::size_t plugin_state_count = static_cast<std::size_t>(PluginState::Discovered) + 1;
+    struct RegistryStats {
+        std::array<int, plugin_state_count> state_counts{};
+        int total = 0;
+        qint64 error_count = 0;
+        qint64 estimated_memory_bytes = 0;
+        std::optional<std::chrono::system_clock::time_point> earliest_load_time;
+    };
+    AtomicSharedPtr<const RegistryStats> m_registry_stats{std::make_shared<const RegistryStats>()};
+    std::multiset<std::chrono::system_clock::time_point> m_load_times;   // Guarded by m_registry_write_mutex
+    std::atomic<std::uint64_t> m_command_count{0};
+    std::atomic<std::uint64_t> m_command_error_count{0};
+    std::atomic<int> m_dependency_node_count{0};
+    // Read-side sections around calls into plugin code; unload waits on it
+    EpochDomain m_call_epoch;
+    mutable std::shared_mutex m_dependency_mutex;
     std::unordered_map<std::string, DependencyNode> m_dependency_graph;
     
     // Search paths
     mutable std::shared_mutex m_search_paths_mutex;
     std::unordered_set<std::filesystem::path> m_search_paths;
+    std::unique_ptr<PluginDiscovery> m_discovery;
+    std::filesystem::path m_discovery_index_path;
     
     // Hot reloading
     std::unique_ptr<QFileSystemWatcher> m_file_watcher;
     std::unordered_map<std::string, std::filesystem::path> m_watched_files;
+
+    // Change events are coalesced per file until it has been stable for the
+    // quiet period (GUI thread only); unchanged builds are then filtered out
+    // off the GUI thread, and the reload itself runs back on the GUI thread
+    struct PendingReload {
+        std::unique_ptr<QTimer> timer;
+        qint64 size = -1;
+        qint64 modified_ms = -1;
+        int unstable_checks = 0;
+    };
+    StringMap<PendingReload> m_pending_reloads;
+    std::atomic<std::chrono::milliseconds::rep> m_reload_quiet_period_ms{250};
+    QThreadPool m_reload_pool;
+    std::mutex m_reload_hash_mutex;
+    StringMap<QByteArray> m_reloaded_file_hashes;
     
+    // Initializations that overran their timeout; the plugin library stays
+    // loaded until the abandoned initialize() returns
+    struct PluginInitTask;
+    std::mutex m_abandoned_inits_mutex;
+    StringMap<std::shared_ptr<PluginInitTask>> m_abandoned_inits;
+
+    // Usage profile: the profile as loaded plus the first uses of this run
+    mutable std::mutex m_usage_mutex;
+    std::filesystem::path m_usage_profile_path;
+    PluginUsageProfile m_usage_profile;
+    std::vector<PluginFirstUse> m_first_uses;
+
     // Monitoring
     std::atomic<bool> m_monitoring_active{false};
-    std::unique_ptr<QTimer> m_monitoring_timer;
+    AtomicSharedPtr<const MetricsSnapshot> m_metrics_snapshot;
+    MetricsSampler m_metrics_sampler;
     
     // Security
     SecurityLevel m_security_level = SecurityLevel::Basic;
     
     // Helper methods
     qtplugin::expected<void, PluginError> validate_plugin_file(const std::filesystem::path& file_path) const;
+    qtplugin::expected<void, PluginError> validate_plugin_security(const std::filesystem::path& file_path,
+                                                                   SecurityLevel level) const;
+    qtplugin::expected<std::string, PluginError> register_discovered_plugin(const std::filesystem::path& file_path,
+                                                                            const PluginLoadOptions& options,
+                                                                            std::optional<FileIdentity> identity);
+    qtplugin::expected<std::string, PluginError> register_lazy_plugin(const std::string& plugin_id,
+                                                                      const std::filesystem::path& file_path,
+                                                                      PluginMetadata metadata,
+                                                                      const PluginLoadOptions& options,
+                                                                      std::optional<FileIdentity> identity,
+                                                                      bool check_dependencies,
+                                                                      const StaticPluginEntry* static_entry = nullptr);
+    qtplugin::expected<std::string, PluginError> register_loaded_plugin(std::shared_ptr<IPlugin> plugin,
+                                                                        const std::string& plugin_id,
+                                                                        const std::filesystem::path& file_path,
+                                                                        const PluginLoadOptions& options,
+                                                                        std::optional<FileIdentity> identity,
+                                                                        bool check_dependencies,
+                                                                        const StaticPluginEntry* static_entry);
+    int load_static_plugin_set(std::vector<const StaticPluginEntry*> pending, const PluginLoadOptions& options);
+    qtplugin::expected<std::string, PluginError> load_plugin_impl(const std::filesystem::path& file_path,
+                                                                  const PluginLoadOptions& options,
+                                                                  std::optional<FileIdentity> trusted_identity,
+                                                                  std::optional<FileIdentity> validated_identity = std::nullopt);
+    qtplugin::expected<std::chrono::microseconds, PluginError> configure_and_initialize(
+        const std::shared_ptr<IPlugin>& plugin, const std::string& plugin_id, const PluginLoadOptions& options,
+        const std::shared_ptr<PluginMetricsSlot>& metrics_slot);
+    bool release_abandoned_init(std::string_view plugin_id);
+    static ShutdownReport run_shutdown_schedule(const PluginRegistry& registry, const ShutdownOptions& options,
+                                                const std::function<bool(const PluginInfo&)>& select,
+                                                const std::function<bool(IPlugin&)>& stop);
     qtplugin::expected<void, PluginError> check_plugin_dependencies(const PluginInfo& info) const;
     void update_dependency_graph();
     std::vector<std::string> topological_sort() const;
     void cleanup_plugin(const std::string& plugin_id);
-    void update_plugin_metrics(const std::string& plugin_id);
+    std::shared_ptr<const MetricsSnapshot> take_metrics_snapshot() const;
+    static PluginMetricsSample sample_plugin(const PluginInfo& info, std::chrono::system_clock::time_point now);
+    void on_reload_quiet_period_elapsed(const QString& path);
+    void run_scheduled_reload(const std::string& plugin_id, const QString& path);
+    void finish_scheduled_reload(const std::string& plugin_id, const QByteArray& file_hash);
+    qtplugin::expected<void, PluginError> activate_reloaded_plugin(const std::string& id,
+                                                                   const std::shared_ptr<IPlugin>& old_instance,
+                                                                   const std::shared_ptr<IPlugin>& new_instance,
+                                                                   bool preserve_state);
+    qtplugin::expected<void, PluginError> reload_plugin_in_place(std::string_view plugin_id, bool preserve_state);
 
+    // Registry copy-on-write helpers
+    bool update_plugin_info(std::string_view plugin_id, const std::function<void(PluginInfo&)>& mutate);
+    bool insert_plugin_info(std::shared_ptr<const PluginInfo> info);
+    std::shared_ptr<const PluginInfo> remove_plugin_info(std::string_view plugin_id);
+    void publish_registry(std::shared_ptr<const PluginRegistry> registry,
+                          const PluginInfo* removed, const PluginInfo* added);
+    void record_command(const PluginInfo* info, bool failed);
     // Dependency graph helpers
     int calculate_dependency_level(const std::string& plugin_id, const std::vector<std::string>& dependencies) const;
     void detect_circular_dependencies() const;
@@ -0,0 +1,63 @@
+/**
+ * @file plugin_metadata_reader.hpp
+ * @brief Reads Qt plugin metadata from library files without loading them
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "../utils/error_handling.hpp"
+#include <QJsonObject>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace qtplugin {
+
+/**
+ * @brief Upper bound of the magic string search in files without usable ELF section headers
+ */
+inline constexpr std::size_t metadata_scan_limit = std::size_t{64} << 20;
+
+/**
+ * @brief Find a section by name through the ELF section header table
+ * @param image Complete ELF file contents
+ * @param name Section name, e.g. ".qtmetadata"
+ * @return Section contents, or std::nullopt if the image is not ELF, has no
+ *         usable section headers or no such section
+ */
+std::optional<std::span<const char>> find_elf_section(std::span<const char> image, std::string_view name);
+
+/**
+ * @brief Locate the plugin metadata blob written by moc
+ *
+ * ELF images are searched in their .qtmetadata section; other images, and
+ * ELF images without section headers, by scanning the first
+ * metadata_scan_limit bytes for the metadata magic string.
+ *
+ * @param image Complete library file contents
+ * @return Blob starting at the magic string, or std::nullopt if none was found
+ */
+std::optional<std::span<const char>> find_qt_plugin_metadata(std::span<const char> image);
+
+/**
+ * @brief Decode a plugin metadata blob
+ * @param blob Blob returned by find_qt_plugin_metadata()
+ * @return Metadata in the form returned by QPluginLoader::metaData(), or error information
+ */
+qtplugin::expected<QJsonObject, PluginError> decode_qt_plugin_metadata(std::span<const char> blob);
+
+/**
+ * @brief Read the metadata of a plugin library
+ *
+ * The file is memory-mapped and parsed in place; the dynamic loader is never
+ * involved, so no library code runs and nothing stays mapped afterwards.
+ *
+ * @param file_path Plugin library
+ * @return Metadata in the form returned by QPluginLoader::metaData(), or error information
+ */
+qtplugin::expected<QJsonObject, PluginError> read_qt_plugin_metadata(const std::filesystem::path& file_path);
+
+} // namespace qtplugin
@@ -0,0 +1,157 @@
+/**
+ * @file plugin_metrics.hpp
+ * @brief Lock-free per-plugin metric slots and the background sampler
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace qtplugin {
+
+/**
+ * @brief Preallocated numeric metrics of one plugin
+ *
+ * A plugin registers metric names once, typically while initializing, and
+ * then updates values from any thread. Updates and reads are single relaxed
+ * atomic operations; only registration takes a lock. The manager samples the
+ * slot in the background, so publishing a value never calls into the manager.
+ *
+ * The slot also carries the command counters maintained by PluginManager.
+ */
+class PluginMetricsSlot {
+public:
+    /**
+     * @brief Maximum number of metrics per plugin
+     */
+    static constexpr std::size_t capacity = 32;
+
+    PluginMetricsSlot() = default;
+    PluginMetricsSlot(const PluginMetricsSlot&) = delete;
+    PluginMetricsSlot& operator=(const PluginMetricsSlot&) = delete;
+
+    /**
+     * @brief Register a metric
+     * @param name Metric name
+     * @return Index for set() and add(); the existing index if the name is
+     *         already registered, std::nullopt if the slot is full
+     */
+    std::optional<std::size_t> register_metric(std::string_view name);
+
+    /**
+     * @brief Set a gauge
+     */
+    void set(std::size_t index, double value) noexcept {
+        if (index < capacity) {
+            m_values[index].store(value, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Add to a counter
+     */
+    void add(std::size_t index, double delta = 1.0) noexcept {
+        if (index < capacity) {
+            m_values[index].fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Get the number of registered metrics
+     */
+    std::size_t size() const noexcept { return m_size.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Get the name of a registered metric
+     */
+    std::string_view name(std::size_t index) const noexcept {
+        return index < size() ? std::string_view(m_names[index]) : std::string_view();
+    }
+
+    /**
+     * @brief Get the current value of a registered metric
+     */
+    double value(std::size_t index) const noexcept {
+        return index < capacity ? m_values[index].load(std::memory_order_relaxed) : 0.0;
+    }
+
+    /**
+     * @brief Count a command sent through PluginManager
+     */
+    void record_command(bool failed) noexcept {
+        m_commands.fetch_add(1, std::memory_order_relaxed);
+        if (failed) {
+            m_command_errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Mark the plugin as used
+     * @return true only for the first call
+     */
+    bool mark_used() noexcept {
+        return !m_used.load(std::memory_order_relaxed) && !m_used.exchange(true, std::memory_order_relaxed);
+    }
+
+    std::uint64_t commands() const noexcept { return m_commands.load(std::memory_order_relaxed); }
+    std::uint64_t command_errors() const noexcept { return m_command_errors.load(std::memory_order_relaxed); }
+
+private:
+    std::array<std::atomic<double>, capacity> m_values{};
+    std::array<std::string, capacity> m_names;   ///< Entries below m_size are immutable
+    std::atomic<std::size_t> m_size{0};
+    std::mutex m_register_mutex;
+    std::atomic<std::uint64_t> m_commands{0};
+    std::atomic<std::uint64_t> m_command_errors{0};
+    std::atomic<bool> m_used{false};
+};
+
+/**
+ * @brief Runs a callback periodically on a dedicated thread
+ */
+class MetricsSampler {
+public:
+    MetricsSampler() = default;
+    ~MetricsSampler();
+
+    MetricsSampler(const MetricsSampler&) = delete;
+    MetricsSampler& operator=(const MetricsSampler&) = delete;
+
+    /**
+     * @brief Start sampling; the callback runs immediately and then once per interval
+     * @return false if already running
+     */
+    bool start(std::chrono::milliseconds interval, std::function<void()> sample);
+
+    /**
+     * @brief Stop sampling and wait for a running callback to finish
+     */
+    void stop();
+
+    /**
+     * @brief Check whether the sampler thread is running
+     */
+    bool is_running() const noexcept { return m_running.load(std::memory_order_acquire); }
+
+private:
+    std::mutex m_control_mutex;   ///< Serializes start() and stop()
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_stop_requested = false;
+    std::atomic<bool> m_running{false};
+};
+
+} // namespace qtplugin
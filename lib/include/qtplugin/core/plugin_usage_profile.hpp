@@ -0,0 +1,101 @@
+/**
+ * @file plugin_usage_profile.hpp
+ * @brief Persisted per-plugin usage statistics for guided preloading
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "../utils/error_handling.hpp"
+#include "../utils/transparent_hash.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace qtplugin {
+
+/**
+ * @brief First use of a plugin during one run
+ */
+struct PluginFirstUse {
+    std::string plugin_id;
+    std::int64_t latency_us = 0;   ///< Loading time the first use waited for; 0 if the plugin was ready
+};
+
+/**
+ * @brief Usage history of one plugin
+ */
+struct PluginUsageRecord {
+    double usage_score = 0.0;              ///< Decayed share of recent runs that used the plugin
+    double first_use_rank = 0.0;           ///< Decayed position among the first uses of a run
+    std::int64_t first_use_latency_us = 0; ///< Latency of the most recent first use
+    std::uint64_t runs_used = 0;           ///< Runs that used the plugin
+};
+
+/**
+ * @brief Usage profile accumulated across runs
+ *
+ * Every run contributes the plugins it used in order of first use. Older runs
+ * lose weight geometrically, so a plugin that stops being used drops out of
+ * the hot set after a few runs and is eventually forgotten.
+ */
+class PluginUsageProfile {
+public:
+    /**
+     * @brief Weight the history keeps when a run is recorded
+     */
+    static constexpr double decay = 0.75;
+
+    /**
+     * @brief Records whose score falls below this are dropped
+     */
+    static constexpr double forget_below = 0.01;
+
+    /**
+     * @brief Account one run
+     * @param first_uses Plugins used by the run, in order of first use
+     */
+    void record_run(std::span<const PluginFirstUse> first_uses);
+
+    /**
+     * @brief Get the plugins worth loading ahead of their first use
+     * @param min_score Minimum usage score
+     * @return Plugin IDs in predicted order of first use
+     */
+    std::vector<std::string> hot_set(double min_score) const;
+
+    /**
+     * @brief Get the record of a plugin, or nullptr if it has none
+     */
+    const PluginUsageRecord* find(std::string_view plugin_id) const;
+
+    /**
+     * @brief Get the number of recorded runs
+     */
+    std::uint64_t runs() const noexcept { return m_runs; }
+
+    /**
+     * @brief Load a profile written by save()
+     * @param file_path Profile file
+     * @return Profile or error information
+     */
+    static qtplugin::expected<PluginUsageProfile, PluginError> load(const std::filesystem::path& file_path);
+
+    /**
+     * @brief Persist the profile
+     * @param file_path Destination file, replaced atomically
+     * @return Success or error information
+     */
+    qtplugin::expected<void, PluginError> save(const std::filesystem::path& file_path) const;
+
+private:
+    static constexpr int format_version = 1;
+
+    std::uint64_t m_runs = 0;
+    StringMap<PluginUsageRecord> m_records;
+};
+
+} // namespace qtplugin
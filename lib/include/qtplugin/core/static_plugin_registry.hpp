@@ -0,0 +1,163 @@
+/**
+ * @file static_plugin_registry.hpp
+ * @brief Compile-time registration of statically linked plugins
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "plugin_interface.hpp"
+#include "../utils/concepts.hpp"
+#include <array>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace qtplugin {
+
+/**
+ * @brief Metadata of a statically linked plugin, known at compile time
+ *
+ * Plugin types declare it as `static constexpr StaticPluginInfo static_info`.
+ */
+struct StaticPluginInfo {
+    std::string_view id;
+    std::string_view name;
+    std::string_view description;
+    std::string_view author;
+    std::array<int, 3> version{1, 0, 0};              ///< Major, minor and patch version
+    std::span<const std::string_view> dependencies;   ///< IDs of required plugins
+
+    /**
+     * @brief Convert to the metadata PluginManager registers
+     */
+    PluginMetadata metadata() const;
+};
+
+/**
+ * @brief Entry of a static plugin table
+ */
+struct StaticPluginEntry {
+    StaticPluginInfo info;
+    std::shared_ptr<IPlugin> (*create)() = nullptr;   ///< Creates a new plugin instance
+};
+
+/**
+ * @brief Factory used by static plugin tables
+ */
+template<concepts::StaticPlugin PluginType>
+std::shared_ptr<IPlugin> create_static_plugin() {
+    return std::make_shared<PluginType>();
+}
+
+/**
+ * @brief Create the table entry of a statically linked plugin type
+ */
+template<concepts::StaticPlugin PluginType>
+constexpr StaticPluginEntry make_static_plugin_entry() noexcept {
+    return StaticPluginEntry{PluginType::static_info, &create_static_plugin<PluginType>};
+}
+
+/**
+ * @brief Create a constant table of statically linked plugin types
+ *
+ * The table can be passed to PluginManager::load_static_plugins() directly,
+ * or registered process-wide with QTPLUGIN_REGISTER_STATIC_PLUGINS.
+ */
+template<concepts::StaticPlugin... PluginTypes>
+constexpr std::array<StaticPluginEntry, sizeof...(PluginTypes)> make_static_plugin_table() noexcept {
+    return {make_static_plugin_entry<PluginTypes>()...};
+}
+
+/**
+ * @brief Link of a static plugin table in the process-wide list
+ */
+struct StaticPluginTableNode {
+    std::span<const StaticPluginEntry> entries;
+    StaticPluginTableNode* next = nullptr;
+};
+
+/**
+ * @brief Adds a static plugin table to the process-wide list on construction
+ *
+ * Safe during static initialization of any translation unit; tables are
+ * never removed.
+ */
+class StaticPluginRegistrar {
+public:
+    explicit StaticPluginRegistrar(StaticPluginTableNode& node) noexcept;
+};
+
+/**
+ * @brief Get all plugins registered with QTPLUGIN_REGISTER_STATIC_PLUGINS
+ * @return Entries of all registered tables; the order across translation units is unspecified
+ */
+std::vector<const StaticPluginEntry*> registered_static_plugins();
+
+/**
+ * @brief CRTP base of statically linked plugins with devirtualised commands
+ *
+ * Implements the IPlugin metadata accessors from Derived::static_info and
+ * forwards execute_command() to the non-virtual Derived::handle_command().
+ * Code holding the concrete type, e.g. from PluginManager::get_static_plugin(),
+ * calls handle_command() directly and the compiler can inline it; callers
+ * going through IPlugin take one virtual call as before.
+ */
+template<typename Derived>
+class StaticPluginAdapter : public IPlugin {
+public:
+    std::string_view name() const noexcept override { return Derived::static_info.name; }
+    std::string_view description() const noexcept override { return Derived::static_info.description; }
+    std::string_view author() const noexcept override { return Derived::static_info.author; }
+    std::string id() const noexcept override { return std::string(Derived::static_info.id); }
+
+    Version version() const noexcept override {
+        const auto& version = Derived::static_info.version;
+        return Version(version[0], version[1], version[2]);
+    }
+
+    std::vector<std::string> dependencies() const override {
+        return {Derived::static_info.dependencies.begin(), Derived::static_info.dependencies.end()};
+    }
+
+    PluginMetadata metadata() const override {
+        auto meta = IPlugin::metadata();
+        meta.dependencies = dependencies();
+        return meta;
+    }
+
+    qtplugin::expected<QJsonObject, PluginError>
+    execute_command(std::string_view command, const QJsonObject& params = {}) final {
+        static_assert(concepts::StaticCommandHandler<Derived>,
+                      "Derived must implement handle_command(std::string_view, const QJsonObject&)");
+        return derived().handle_command(command, params);
+    }
+
+protected:
+    StaticPluginAdapter() = default;
+
+    Derived& derived() noexcept { return static_cast<Derived&>(*this); }
+    const Derived& derived() const noexcept { return static_cast<const Derived&>(*this); }
+};
+
+} // namespace qtplugin
+
+/**
+ * @brief Register statically linked plugin types with the process-wide list
+ *
+ * Use once per translation unit, at namespace scope outside any namespace:
+ * @code
+ * QTPLUGIN_REGISTER_STATIC_PLUGINS(CorePlugin, NetworkPlugin)
+ * @endcode
+ * PluginManager::load_static_plugins() then loads them without touching disk.
+ * The object file must be linked; from a static library it has to be
+ * referenced or linked as a whole archive.
+ */
+#define QTPLUGIN_REGISTER_STATIC_PLUGINS(...)                                                          \
+    namespace {                                                                                        \
+    constexpr auto qtplugin_static_plugin_table = ::qtplugin::make_static_plugin_table<__VA_ARGS__>(); \
+    ::qtplugin::StaticPluginTableNode qtplugin_static_plugin_node{qtplugin_static_plugin_table};       \
+    const ::qtplugin::StaticPluginRegistrar qtplugin_static_plugin_registrar{qtplugin_static_plugin_node}; \
+    }
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "../utils/error_handling.hpp"
+#include "configuration_tree.hpp"
 #include <QObject>
 #include <QJsonObject>
 #include <QJsonValue>
@@ -22,8 +23,10 @@
 #include <functional>
 #include <optional>
 #include <filesystem>
+#include <span>
 #include <shared_mutex>
 #include <atomic>
+#include <cstdint>
 
 namespace qtplugin {
 
@@ -90,6 +93,74 @@ struct ConfigurationSchema {
         : schema(s), strict_mode(strict) {}
 };
 
+/**
+ * @brief Precompiled configuration key
+ *
+ * Splits a dotted key and hashes its segments once, so a lookup walks the
+ * configuration tree without parsing or hashing the key on every access.
+ * Create handles once, e.g. as members of a plugin, and reuse them.
+ */
+class ConfigKey {
+public:
+    ConfigKey() = default;
+    explicit ConfigKey(std::string_view key);
+
+    /**
+     * @brief Get the dotted key
+     */
+    const std::string& str() const noexcept { return m_key; }
+
+    /**
+     * @brief Get the pre-hashed key segments
+     */
+    std::span<const ConfigKeySegment> segments() const noexcept { return m_segments; }
+
+    bool empty() const noexcept { return m_segments.empty(); }
+
+private:
+    std::string m_key;
+    std::vector<ConfigKeySegment> m_segments;
+};
+
+/**
+ * @brief Immutable, versioned configuration of one scope
+ *
+ * Obtained from IConfigurationManager::snapshot(). All reads see the same
+ * version however the scope changes meanwhile, and take no mutex; hold the
+ * snapshot for the duration of a request and release it afterwards.
+ */
+class ConfigurationSnapshot {
+public:
+    ConfigurationSnapshot() = default;
+    ConfigurationSnapshot(ConfigurationTree tree, std::uint64_t version) noexcept
+        : m_tree(std::move(tree)), m_version(version) {}
+
+    /**
+     * @brief Get the version; increases with every change of the scope
+     */
+    std::uint64_t version() const noexcept { return m_version; }
+
+    qtplugin::expected<QJsonValue, PluginError> get_value(std::string_view key) const;
+    qtplugin::expected<QJsonValue, PluginError> get_value(const ConfigKey& key) const;
+
+    QJsonValue get_value_or_default(std::string_view key, const QJsonValue& default_value) const;
+    QJsonValue get_value_or_default(const ConfigKey& key, const QJsonValue& default_value) const;
+
+    bool has_key(std::string_view key) const { return m_tree.contains(key); }
+    bool has_key(const ConfigKey& key) const { return m_tree.contains(key.segments()); }
+
+    /**
+     * @brief Convert the whole configuration to a JSON object
+     */
+    QJsonObject to_json() const { return m_tree.to_json(); }
+
+    const ConfigurationTree& tree() const noexcept { return m_tree; }
+
+private:
+    ConfigurationTree m_tree;
+    std::uint64_t m_version = 0;
+};
+
 /**
  * @brief Configuration manager interface
  * 
@@ -124,6 +195,19 @@ public:
     virtual QJsonValue get_value_or_default(std::string_view key, const QJsonValue& default_value,
                                            ConfigurationScope scope = ConfigurationScope::Global,
                                            std::string_view plugin_id = {}) const = 0;
+
+    /**
+     * @brief Get configuration value by precompiled key
+     * @param key Configuration key handle
+     * @param scope Configuration scope
+     * @param plugin_id Plugin ID (required for Plugin scope)
+     * @return Configuration value or error
+     */
+    virtual qtplugin::expected<QJsonValue, PluginError>
+    get_value(const ConfigKey& key, ConfigurationScope scope = ConfigurationScope::Global,
+              std::string_view plugin_id = {}) const {
+        return get_value(std::string_view(key.str()), scope, plugin_id);
+    }
     
     /**
      * @brief Set configuration value
@@ -137,6 +221,21 @@ public:
     set_value(std::string_view key, const QJsonValue& value,
               ConfigurationScope scope = ConfigurationScope::Global,
               std::string_view plugin_id = {}) = 0;
+
+    /**
+     * @brief Set configuration value by precompiled key
+     * @param key Configuration key handle
+     * @param value Configuration value
+     * @param scope Configuration scope
+     * @param plugin_id Plugin ID (required for Plugin scope)
+     * @return Success or error information
+     */
+    virtual qtplugin::expected<void, PluginError>
+    set_value(const ConfigKey& key, const QJsonValue& value,
+              ConfigurationScope scope = ConfigurationScope::Global,
+              std::string_view plugin_id = {}) {
+        return set_value(std::string_view(key.str()), value, scope, plugin_id);
+    }
     
     /**
      * @brief Remove configuration key
@@ -159,6 +258,21 @@ public:
     virtual bool has_key(std::string_view key, ConfigurationScope scope = ConfigurationScope::Global,
                         std::string_view plugin_id = {}) const = 0;
     
+    /**
+     * @brief Get a consistent, immutable view of a scope
+     * @param scope Configuration scope
+     * @param plugin_id Plugin ID (required for Plugin scope)
+     * @return Snapshot of the current version or error
+     */
+    virtual qtplugin::expected<std::shared_ptr<const ConfigurationSnapshot>, PluginError>
+    snapshot(ConfigurationScope scope = ConfigurationScope::Global, std::string_view plugin_id = {}) const {
+        auto configuration = get_configuration(scope, plugin_id);
+        if (!configuration) {
+            return qtplugin::unexpected<PluginError>{configuration.error()};
+        }
+        return std::make_shared<const ConfigurationSnapshot>(ConfigurationTree(configuration.value()), 0);
+    }
+
     // === Bulk Operations ===
     
     /**
@@ -317,6 +431,14 @@ public:
      * @return true if auto-persistence is enabled
      */
     virtual bool is_auto_persist_enabled() const = 0;
+
+    /**
+     * @brief Write auto-persisted changes that are still pending
+     *
+     * Implementations that persist in the background write them now; the
+     * default has nothing pending.
+     */
+    virtual void flush_pending_writes() {}
 };
 
 } // namespace qtplugin
@@ -7,6 +7,10 @@
 #pragma once
 
 #include "configuration_manager.hpp"
+#include "configuration_persister.hpp"
+#include "configuration_tree.hpp"
+#include "../utils/atomic_shared_ptr.hpp"
+#include "../utils/transparent_hash.hpp"
 #include <QObject>
 #include <QRegularExpression>
 #include <QString>
@@ -32,6 +36,10 @@ public:
     get_value(std::string_view key, ConfigurationScope scope = ConfigurationScope::Global,
               std::string_view plugin_id = {}) const override;
 
+    qtplugin::expected<QJsonValue, PluginError>
+    get_value(const ConfigKey& key, ConfigurationScope scope = ConfigurationScope::Global,
+              std::string_view plugin_id = {}) const override;
+
     QJsonValue get_value_or_default(std::string_view key, const QJsonValue& default_value,
                                    ConfigurationScope scope = ConfigurationScope::Global,
                                    std::string_view plugin_id = {}) const override;
@@ -41,6 +49,11 @@ public:
               ConfigurationScope scope = ConfigurationScope::Global,
               std::string_view plugin_id = {}) override;
 
+    qtplugin::expected<void, PluginError>
+    set_value(const ConfigKey& key, const QJsonValue& value,
+              ConfigurationScope scope = ConfigurationScope::Global,
+              std::string_view plugin_id = {}) override;
+
     qtplugin::expected<void, PluginError>
     remove_key(std::string_view key, ConfigurationScope scope = ConfigurationScope::Global,
                std::string_view plugin_id = {}) override;
@@ -104,20 +117,39 @@ public:
 
     void set_auto_persist(bool enabled) override;
     bool is_auto_persist_enabled() const override;
+    void flush_pending_writes() override;
+
+    qtplugin::expected<std::shared_ptr<const ConfigurationSnapshot>, PluginError>
+    snapshot(ConfigurationScope scope = ConfigurationScope::Global,
+             std::string_view plugin_id = {}) const override;
+
+    /**
+     * @brief Set how long auto-persisted changes are coalesced before a scope is written
+     */
+    void set_persist_delay(std::chrono::milliseconds delay);
+    std::chrono::milliseconds persist_delay() const;
 
 signals:
     void configuration_changed(const QString& key, const QJsonValue& old_value, 
                               const QJsonValue& new_value, int scope, const QString& plugin_id);
     void configuration_loaded(int scope, const QString& plugin_id);
+    /// Delivered on the manager's thread, including for write-behind saves
     void configuration_saved(int scope, const QString& plugin_id);
 
 private:
     struct ConfigurationData {
-        QJsonObject data;
+        // Published version; read without the mutex, replaced by writers
+        AtomicSharedPtr<const ConfigurationSnapshot> current{std::make_shared<const ConfigurationSnapshot>()};
         std::optional<ConfigurationSchema> schema;
         std::filesystem::path file_path;
         bool is_dirty = false;
-        mutable std::shared_mutex mutex;
+        mutable std::shared_mutex mutex;   ///< Serializes writers; guards the fields other than current
+    };
+
+    // Immutable index of the scopes, republished when a scope is created
+    struct ConfigurationDirectory {
+        std::unordered_map<ConfigurationScope, ConfigurationData*> scopes;
+        StringMap<ConfigurationData*> plugins;
     };
 
     struct ChangeSubscription {
@@ -133,6 +165,7 @@ private:
     mutable std::shared_mutex m_global_mutex;
     std::unordered_map<ConfigurationScope, std::unique_ptr<ConfigurationData>> m_global_configs;
     std::unordered_map<std::string, std::unordered_map<ConfigurationScope, std::unique_ptr<ConfigurationData>>> m_plugin_configs;
+    AtomicSharedPtr<const ConfigurationDirectory> m_directory;
 
     // Change notifications
     mutable std::shared_mutex m_subscriptions_mutex;
@@ -143,18 +176,22 @@ private:
     std::atomic<size_t> m_change_count{0};
     std::atomic<size_t> m_access_count{0};
 
+    // Writes dirty scopes behind mutations; uses the members above
+    ConfigurationPersister m_persister;
+
     // Helper methods
     ConfigurationData* get_config_data(ConfigurationScope scope, std::string_view plugin_id) const;
     ConfigurationData* get_or_create_config_data(ConfigurationScope scope, std::string_view plugin_id);
+    void publish_directory();
+    std::shared_ptr<const ConfigurationSnapshot> current_snapshot(ConfigurationScope scope, std::string_view plugin_id) const;
+    void publish_version(ConfigurationData& config, ConfigurationTree tree);
     std::string generate_subscription_id() const;
-    QJsonValue get_nested_value(const QJsonObject& obj, std::string_view key) const;
-    bool set_nested_value(QJsonObject& obj, std::string_view key, const QJsonValue& value);
-    bool remove_nested_key(QJsonObject& obj, std::string_view key);
     void collect_keys(const QJsonObject& obj, std::vector<std::string>& keys, const std::string& prefix = {}) const;
     void notify_change(const ConfigurationChangeEvent& event);
     bool matches_filter(const ChangeSubscription& subscription, const ConfigurationChangeEvent& event) const;
     std::filesystem::path get_default_config_path(ConfigurationScope scope, std::string_view plugin_id) const;
     qtplugin::expected<void, PluginError> persist_if_needed(ConfigurationScope scope, std::string_view plugin_id);
+    void write_scope(ConfigurationScope scope, const std::string& plugin_id);
     ConfigurationValidationResult validate_property(const QJsonValue& value, const QJsonObject& schema, const std::string& property_name) const;
     QString json_value_type_name(const QJsonValue& value) const;
 };
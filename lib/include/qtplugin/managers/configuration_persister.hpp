@@ -0,0 +1,95 @@
+/**
+ * @file configuration_persister.hpp
+ * @brief Write-behind persistence of configuration scopes
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "configuration_manager.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+namespace qtplugin {
+
+/**
+ * @brief Coalesces configuration writes on a background thread
+ *
+ * Mutations only mark their scope dirty. The first mark opens a window of
+ * delay(); when it closes, each dirty scope is written once, however many
+ * changes it received. flush() writes pending scopes on the calling thread
+ * and stop() flushes before joining the thread, so no marked change is lost
+ * on shutdown.
+ */
+class ConfigurationPersister {
+public:
+    /**
+     * @brief Writes one scope; called without the persister's lock held
+     */
+    using WriteFunction = std::function<void(ConfigurationScope scope, const std::string& plugin_id)>;
+
+    static constexpr std::chrono::milliseconds default_delay{500};
+
+    explicit ConfigurationPersister(WriteFunction write, std::chrono::milliseconds delay = default_delay);
+    ~ConfigurationPersister();
+
+    ConfigurationPersister(const ConfigurationPersister&) = delete;
+    ConfigurationPersister& operator=(const ConfigurationPersister&) = delete;
+
+    /**
+     * @brief Schedule a write of a scope; starts the thread on first use
+     */
+    void mark_dirty(ConfigurationScope scope, std::string_view plugin_id);
+
+    /**
+     * @brief Write all pending scopes now, waiting for an in-flight write first
+     */
+    void flush();
+
+    /**
+     * @brief Flush and stop the thread; later marks are written synchronously
+     */
+    void stop();
+
+    void set_delay(std::chrono::milliseconds delay);
+    std::chrono::milliseconds delay() const;
+
+    /**
+     * @brief Get the number of scope writes performed
+     */
+    std::uint64_t writes() const noexcept { return m_writes.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get the number of scopes waiting to be written
+     */
+    std::size_t pending() const;
+
+private:
+    using ScopeKey = std::pair<ConfigurationScope, std::string>;
+
+    void run();
+    void write_pending(std::unique_lock<std::mutex>& lock);
+
+    WriteFunction m_write;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::condition_variable m_idle;
+    std::set<ScopeKey> m_pending;
+    std::chrono::steady_clock::time_point m_first_pending;
+    std::chrono::milliseconds m_delay;
+    std::thread m_thread;
+    bool m_writing = false;
+    bool m_stop_requested = false;
+    std::atomic<std::uint64_t> m_writes{0};
+};
+
+} // namespace qtplugin
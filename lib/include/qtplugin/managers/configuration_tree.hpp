@@ -0,0 +1,145 @@
+/**
+ * @file configuration_tree.hpp
+ * @brief Configuration storage keyed by pre-hashed key segments
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "../utils/transparent_hash.hpp"
+#include <QJsonObject>
+#include <QJsonValue>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace qtplugin {
+
+/**
+ * @brief One segment of a dotted configuration key, hashed once
+ */
+struct ConfigKeySegment {
+    std::string name;
+    std::size_t hash = 0;
+
+    explicit ConfigKeySegment(std::string_view segment)
+        : name(segment), hash(TransparentStringHash{}(segment)) {}
+
+    friend bool operator==(const ConfigKeySegment& segment, const std::string& name) noexcept {
+        return segment.name == name;
+    }
+};
+
+/**
+ * @brief Tree of configuration values addressed by key segments
+ *
+ * Each JSON object is a node whose members are keyed by their name, so a
+ * nested key is resolved by walking the tree. The names belong to the tree
+ * and go away with the values; nothing is interned process-wide, so data
+ * with arbitrary keys costs only what it stores. Reading a leaf copies only
+ * that value; objects are converted to QJsonObject when read as a whole.
+ *
+ * Nodes are immutable and shared between copies: copying a tree is O(1), and
+ * a change copies only the nodes on its path, leaving other copies untouched.
+ * This is what lets ConfigurationSnapshot versions share their structure.
+ */
+class ConfigurationTree {
+public:
+    ConfigurationTree();
+    ~ConfigurationTree();
+
+    ConfigurationTree(const ConfigurationTree&);
+    ConfigurationTree& operator=(const ConfigurationTree&);
+    ConfigurationTree(ConfigurationTree&&) noexcept;
+    ConfigurationTree& operator=(ConfigurationTree&&) noexcept;
+
+    /**
+     * @brief Build a tree from a JSON object
+     */
+    explicit ConfigurationTree(const QJsonObject& object);
+
+    /**
+     * @brief Get the value at a path of segments
+     * @return Value, or an undefined QJsonValue if the path does not exist
+     */
+    QJsonValue value(std::span<const ConfigKeySegment> path) const;
+
+    /**
+     * @brief Get the value of a dotted key, splitting it on the fly
+     */
+    QJsonValue value(std::string_view key) const;
+
+    bool contains(std::span<const ConfigKeySegment> path) const;
+    bool contains(std::string_view key) const;
+
+    /**
+     * @brief Set the value at a path, creating or replacing intermediate objects
+     *
+     * Object values are stored as nodes, so their members can be addressed
+     * by nested keys afterwards.
+     */
+    void set(std::span<const ConfigKeySegment> path, const QJsonValue& value);
+
+    /**
+     * @brief Remove the value at a path
+     * @return true if the path existed
+     */
+    bool remove(std::span<const ConfigKeySegment> path);
+
+    /**
+     * @brief Remove the value of a dotted key
+     * @return true if the key existed
+     */
+    bool remove(std::string_view key);
+
+    /**
+     * @brief Replace the whole tree with a JSON object
+     */
+    void assign(const QJsonObject& object);
+
+    /**
+     * @brief Replace the top-level members present in a JSON object
+     */
+    void merge(const QJsonObject& object);
+
+    void clear();
+
+    /**
+     * @brief Convert the whole tree to a JSON object
+     */
+    QJsonObject to_json() const;
+
+private:
+    // Member names hash like TransparentStringHash; a ConfigKeySegment brings
+    // its hash along, so handle lookups never rehash the name
+    struct MemberHash {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view name) const noexcept { return TransparentStringHash{}(name); }
+        std::size_t operator()(const std::string& name) const noexcept { return TransparentStringHash{}(name); }
+        std::size_t operator()(const ConfigKeySegment& segment) const noexcept { return segment.hash; }
+    };
+
+    struct Node {
+        QJsonValue value;   ///< Value of a leaf; unused for objects
+        std::unordered_map<std::string, std::shared_ptr<const Node>, MemberHash, std::equal_to<>> children;
+        bool is_object = false;
+    };
+
+    static std::shared_ptr<const Node> make_node(const QJsonValue& value);
+    static std::shared_ptr<const Node> with_value(const Node* node, std::span<const ConfigKeySegment> path,
+                                                  const QJsonValue& value);
+    static std::shared_ptr<const Node> without(const Node& node, std::span<const ConfigKeySegment> path);
+    static QJsonValue node_value(const Node& node);
+    static QJsonObject node_object(const Node& node);
+    const Node* find(std::span<const ConfigKeySegment> path) const;
+    const Node* find(std::string_view key) const;
+
+    std::shared_ptr<const Node> m_root;
+};
+
+} // namespace qtplugin
@@ -48,10 +48,10 @@ namespace qtplugin {
  * @brief Platform-specific loading strategies
  */
 enum class PlatformLoadingStrategy {
-    Default,                ///< Default Qt loading
-    MemoryMapped,           ///< Memory-mapped file loading
-    LazyLoading,            ///< Lazy symbol resolution
-    PreloadSymbols,         ///< Preload all symbols
+    Default,                ///< Default Qt loading (lazy symbol binding)
+    MemoryMapped,           ///< Prefetch the file image into the page cache, then load lazily
+    LazyLoading,            ///< Lazy symbol resolution (RTLD_LAZY)
+    PreloadSymbols,         ///< Preload all symbols (RTLD_NOW)
     OptimizedSearch,        ///< Optimized library search
     CachedMetadata          ///< Cached plugin metadata
 };
@@ -63,10 +63,10 @@ enum class PlatformOptimization : uint32_t {
     None = 0x0000,
     FastDiscovery = 0x0001,     ///< Fast plugin discovery
     MemoryMapping = 0x0002,     ///< Memory-mapped loading
-    SymbolCaching = 0x0004,     ///< Symbol caching
+    SymbolCaching = 0x0004,     ///< Keep libraries resident after unload so reloads reuse their symbols
     MetadataCaching = 0x0008,   ///< Metadata caching
-    ParallelLoading = 0x0010,   ///< Parallel plugin loading
-    LazyInitialization = 0x0020, ///< Lazy initialization
+    ParallelLoading = 0x0010,   ///< Parallel plugin loading in load_parallel()
+    LazyInitialization = 0x0020, ///< Lazy symbol binding, overriding PreloadSymbols
     CompressedStorage = 0x0040, ///< Compressed plugin storage
     SecurityValidation = 0x0080, ///< Enhanced security validation
     PerformanceMonitoring = 0x0100 ///< Performance monitoring
@@ -151,8 +151,16 @@ struct PlatformLoadingStatistics {
  * 
  * This class provides platform-specific optimizations for plugin loading
  * including memory-mapped files, symbol caching, and parallel loading.
+ *
+ * The Linux implementation opens plugins with dlopen() directly: the loading
+ * strategy selects lazy or immediate symbol binding, MemoryMapped prefetches
+ * the file image with readahead() (madvise(MADV_WILLNEED) where unsupported)
+ * and load_parallel() opens libraries on up to max_parallel_loads threads.
+ * Plugin instances are always created on the calling thread. Per-phase
+ * timings are collected in PlatformLoadingStatistics::platform_stats so
+ * strategies can be compared on a given plugin set.
  */
-class PlatformPluginLoader : public IPluginLoader {
+class PlatformPluginLoader : public QObject, public IPluginLoader {
     Q_OBJECT
     
 public:
@@ -169,6 +177,9 @@ public:
     qtplugin::expected<void, PluginError>
     unload(std::string_view plugin_id) override;
     
+    qtplugin::expected<QJsonObject, PluginError>
+    read_plugin_metadata(const std::filesystem::path& file_path) const override;
+    
     std::vector<std::string> supported_extensions() const override;
     
     std::string_view name() const noexcept override;
@@ -244,9 +255,12 @@ public:
     
     /**
      * @brief Load multiple plugins in parallel
+     *
+     * Without ParallelLoading the files are loaded one after another.
+     *
      * @param file_paths Vector of plugin file paths
-     * @param max_parallel Maximum parallel loads
-     * @return Vector of loading results
+     * @param max_parallel Maximum parallel loads, further bounded by max_parallel_loads
+     * @return Vector of loading results, in the order of file_paths
      */
     std::vector<qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>>
     load_parallel(const std::vector<std::filesystem::path>& file_paths, int max_parallel = 4);
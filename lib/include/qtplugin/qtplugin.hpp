@@ -71,6 +71,8 @@
 #include "utils/version.hpp"
 #include "utils/error_handling.hpp"
 #include "utils/concepts.hpp"
+#include "utils/trace.hpp"
+#include "utils/id_interner.hpp"
 
 // Security (always available)
 #include "security/security_manager.hpp"
@@ -7,14 +7,21 @@
 #pragma once
 
 #include "../utils/error_handling.hpp"
+#include "../utils/file_fingerprint.hpp"
+#include "../utils/transparent_hash.hpp"
+#include <QByteArray>
 #include <QJsonObject>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <filesystem>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <shared_mutex>
+#include <mutex>
 #include <atomic>
 
 namespace qtplugin {
@@ -41,6 +48,7 @@ struct SecurityValidationResult {
     std::vector<std::string> warnings;
     std::vector<std::string> errors;
     QJsonObject details;
+    std::optional<FileIdentity> file_identity;   ///< File that was validated, identified before it was read
     
     /**
      * @brief Check if validation passed
@@ -58,6 +66,13 @@ struct SecurityValidationResult {
     bool has_errors() const noexcept { return !errors.empty(); }
 };
 
+/**
+ * @brief Receives batch validation results as they complete
+ * @param index Position of the file in the batch
+ * @param result Validation result of that file
+ */
+using SecurityValidationCallback = std::function<void(std::size_t index, const SecurityValidationResult& result)>;
+
 /**
  * @brief Security manager interface
  */
@@ -73,6 +88,31 @@ public:
      */
     virtual SecurityValidationResult validate_plugin(const std::filesystem::path& file_path,
                                                    SecurityLevel required_level) = 0;
+
+    /**
+     * @brief Validate many plugin files
+     *
+     * The default implementation validates the files one after another.
+     *
+     * @param file_paths Paths to plugin files
+     * @param required_level Required security level
+     * @param on_result Called once per file as soon as its result is known;
+     *        may be called concurrently from worker threads and must not throw
+     * @return Results in the order of file_paths
+     */
+    virtual std::vector<SecurityValidationResult> validate_plugins(std::span<const std::filesystem::path> file_paths,
+                                                                   SecurityLevel required_level,
+                                                                   const SecurityValidationCallback& on_result = {}) {
+        std::vector<SecurityValidationResult> results;
+        results.reserve(file_paths.size());
+        for (const auto& file_path : file_paths) {
+            results.push_back(validate_plugin(file_path, required_level));
+            if (on_result) {
+                on_result(results.size() - 1, results.back());
+            }
+        }
+        return results;
+    }
     
     /**
      * @brief Check if plugin is trusted
@@ -111,6 +151,29 @@ public:
      * @return Security statistics as JSON
      */
     virtual QJsonObject security_statistics() const = 0;
+
+    /**
+     * @brief Drop results cached for a plugin file
+     *
+     * Called when the file is known to have changed. The default
+     * implementation caches nothing and ignores the call.
+     *
+     * @param file_path Path to plugin file
+     */
+    virtual void invalidate_file(const std::filesystem::path& file_path) { (void)file_path; }
+
+    /**
+     * @brief Get the SHA-256 digest of a plugin file
+     *
+     * Implementations may serve the digest from the cache that
+     * invalidate_file() clears. The default implementation hashes the file.
+     *
+     * @param file_path Path to plugin file
+     * @return Digest, or error information if the file cannot be read
+     */
+    virtual qtplugin::expected<QByteArray, PluginError> file_digest(const std::filesystem::path& file_path) const {
+        return file_sha256(file_path);
+    }
 };
 
 /**
@@ -124,6 +187,18 @@ public:
     // ISecurityManager implementation
     SecurityValidationResult validate_plugin(const std::filesystem::path& file_path,
                                             SecurityLevel required_level) override;
+
+    /**
+     * @brief Validate many plugin files as a pipeline
+     *
+     * Each file passes a parse stage (file integrity and metadata) and a hash
+     * stage (signature and permissions) with separate workers, so hashing one
+     * file overlaps parsing the next. Files failing the parse stage are never
+     * hashed.
+     */
+    std::vector<SecurityValidationResult> validate_plugins(std::span<const std::filesystem::path> file_paths,
+                                                           SecurityLevel required_level,
+                                                           const SecurityValidationCallback& on_result = {}) override;
     bool is_trusted(std::string_view plugin_id) const override;
     void add_trusted_plugin(std::string_view plugin_id, SecurityLevel trust_level) override;
     void remove_trusted_plugin(std::string_view plugin_id) override;
@@ -131,6 +206,8 @@ public:
     SecurityLevel get_security_level() const noexcept { return security_level(); }
     void set_security_level(SecurityLevel level) override;
     QJsonObject security_statistics() const override;
+    void invalidate_file(const std::filesystem::path& file_path) override;
+    qtplugin::expected<QByteArray, PluginError> file_digest(const std::filesystem::path& file_path) const override;
 
     // Additional getter methods for testing
     uint64_t get_validations_performed() const noexcept { return m_validations_performed.load(); }
@@ -174,7 +251,17 @@ private:
     mutable std::shared_mutex m_trusted_plugins_mutex;
     std::unordered_map<std::string, SecurityLevel> m_trusted_plugins;
     
+    // SHA-256 digests by plugin path, valid while the file keeps its identity
+    struct CachedDigest {
+        FileIdentity identity;
+        QByteArray sha256;
+    };
+    mutable std::mutex m_digest_cache_mutex;
+    mutable StringMap<CachedDigest> m_digest_cache;
+
     // Statistics
+    mutable std::atomic<uint64_t> m_digest_cache_hits{0};
+    mutable std::atomic<uint64_t> m_digest_cache_misses{0};
     mutable std::atomic<uint64_t> m_validations_performed{0};
     mutable std::atomic<uint64_t> m_validations_passed{0};
     mutable std::atomic<uint64_t> m_validations_failed{0};
@@ -184,6 +271,13 @@ private:
     SecurityValidationResult validate_file_integrity(const std::filesystem::path& file_path) const;
     SecurityValidationResult validate_permissions(const std::filesystem::path& file_path) const;
 
+    // Stages of validate_plugin(); each returns false once the result is final
+    bool run_parse_stage(const std::filesystem::path& file_path, SecurityLevel required_level,
+                         SecurityValidationResult& result) const;
+    bool run_hash_stage(const std::filesystem::path& file_path, SecurityLevel required_level,
+                        SecurityValidationResult& result) const;
+    void record_validation(const SecurityValidationResult& result) const;
+
     // Helper methods
     bool has_valid_extension(const std::filesystem::path& file_path) const;
     std::vector<std::string> get_allowed_extensions() const;
@@ -0,0 +1,93 @@
+/**
+ * @file atomic_shared_ptr.hpp
+ * @brief Atomically published shared pointer for read-mostly snapshots
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <version>
+
+namespace qtplugin {
+
+/**
+ * @brief Shared pointer that can be loaded and replaced atomically
+ *
+ * Used to publish immutable snapshots: readers take a reference with a single
+ * atomic load and keep it alive for as long as they need, writers build a new
+ * object and store it. Wraps std::atomic<std::shared_ptr<T>> where the standard
+ * library provides it and falls back to the shared_ptr atomic free functions
+ * otherwise.
+ *
+ * Loads and stores are atomic, not lock-free: libstdc++ and libc++ guard the
+ * pointer with an internal spinlock (a lock bit, or a global lock pool in the
+ * fallback), held only for the reference count update. A reader therefore
+ * never waits for a writer to build its next object, but it can briefly spin
+ * against a concurrent load or store of the same pointer. is_lock_free()
+ * reports what the standard library actually provides.
+ */
+template<typename T>
+class AtomicSharedPtr {
+public:
+    AtomicSharedPtr() noexcept = default;
+    explicit AtomicSharedPtr(std::shared_ptr<T> value) noexcept : m_value(std::move(value)) {}
+
+    AtomicSharedPtr(const AtomicSharedPtr&) = delete;
+    AtomicSharedPtr& operator=(const AtomicSharedPtr&) = delete;
+
+    /**
+     * @brief Get the currently published value
+     */
+    std::shared_ptr<T> load(std::memory_order order = std::memory_order_acquire) const noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return m_value.load(order);
+#else
+        return std::atomic_load_explicit(&m_value, order);
+#endif
+    }
+
+    /**
+     * @brief Publish a new value
+     */
+    void store(std::shared_ptr<T> value, std::memory_order order = std::memory_order_release) noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        m_value.store(std::move(value), order);
+#else
+        std::atomic_store_explicit(&m_value, std::move(value), order);
+#endif
+    }
+
+    /**
+     * @brief Publish a new value and return the previous one
+     */
+    std::shared_ptr<T> exchange(std::shared_ptr<T> value,
+                                std::memory_order order = std::memory_order_acq_rel) noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return m_value.exchange(std::move(value), order);
+#else
+        return std::atomic_exchange_explicit(&m_value, std::move(value), order);
+#endif
+    }
+
+    /**
+     * @brief Whether loads and stores are lock-free on this standard library
+     */
+    bool is_lock_free() const noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return m_value.is_lock_free();
+#else
+        return std::atomic_is_lock_free(&m_value);
+#endif
+    }
+
+private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<T>> m_value;
+#else
+    std::shared_ptr<T> m_value;
+#endif
+};
+
+} // namespace qtplugin
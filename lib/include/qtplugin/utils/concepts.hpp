@@ -12,6 +12,8 @@
 #include <vector>
 
 // Forward declarations
+class QJsonObject;
+
 namespace qtplugin {
     class IPlugin;
 }
@@ -43,4 +45,25 @@ concept PluginPointer = requires {
       std::same_as<T, std::unique_ptr<typename T::element_type>> ||
       std::same_as<T, std::weak_ptr<typename T::element_type>>);
 
+/**
+ * @brief Concept for plugin types that can be linked statically
+ *
+ * Requires compile-time metadata in `static constexpr StaticPluginInfo static_info`
+ * and a default constructor for the generated factory.
+ */
+template<typename T>
+concept StaticPlugin = Plugin<T> && std::derived_from<T, IPlugin> && std::default_initializable<T> &&
+    requires {
+        { T::static_info.id } -> std::convertible_to<std::string_view>;
+        { T::static_info.dependencies.size() } -> std::convertible_to<std::size_t>;
+    };
+
+/**
+ * @brief Concept for types handling commands without virtual dispatch
+ */
+template<typename T>
+concept StaticCommandHandler = requires(T& t, std::string_view command, const QJsonObject& params) {
+    { t.handle_command(command, params) };
+};
+
 } // namespace qtplugin::concepts
@@ -0,0 +1,123 @@
+/**
+ * @file epoch.hpp
+ * @brief Epoch-based reader tracking for lock-free quiescence
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace qtplugin {
+
+class EpochDomain;
+
+/**
+ * @brief RAII read-side section of an EpochDomain
+ *
+ * While a guard is alive, EpochDomain::synchronize() called after the guard
+ * was entered will not return. Guards are cheap (one atomic increment and
+ * decrement on a per-thread cache line) and may be nested.
+ */
+class EpochGuard {
+public:
+    EpochGuard() noexcept = default;
+    explicit EpochGuard(const EpochDomain& domain) noexcept;
+    ~EpochGuard();
+
+    EpochGuard(EpochGuard&& other) noexcept;
+    EpochGuard& operator=(EpochGuard&& other) noexcept;
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+
+    /**
+     * @brief Leave the read-side section early
+     */
+    void release() noexcept;
+
+private:
+    friend class EpochDomain;
+
+    const EpochDomain* m_domain = nullptr;
+    EpochGuard* m_previous = nullptr;
+    std::uint32_t m_phase = 0;
+    std::uint32_t m_slot = 0;
+};
+
+/**
+ * @brief Reader/writer quiescence domain
+ *
+ * Readers wrap code that uses a shared resource in an EpochGuard. A writer
+ * first unpublishes the resource so new readers cannot reach it, then calls
+ * synchronize() to wait until every reader that could still be using it has
+ * left. Readers never take a lock; the writer side is serialized internally.
+ *
+ * Reader counts are kept in two phases of cache-line padded slots. A writer
+ * flips the active phase and waits for the previous one to drain, after first
+ * draining stragglers that picked up a stale phase.
+ */
+class EpochDomain {
+public:
+    EpochDomain() noexcept;
+    ~EpochDomain() = default;
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    /**
+     * @brief Enter a read-side section
+     * @return Guard that leaves the section when destroyed
+     */
+    [[nodiscard]] EpochGuard enter() const noexcept { return EpochGuard(*this); }
+
+    /**
+     * @brief Wait until all readers that entered before this call have left
+     * @note Must not be called from inside a read-side section of the same domain
+     */
+    void synchronize();
+
+    /**
+     * @brief Wait for readers with a deadline
+     * @param timeout Maximum time to wait
+     * @return true if all earlier readers left, false on timeout
+     */
+    bool try_synchronize(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Check whether the calling thread is inside a read-side section
+     * @return true if a guard of this domain is alive on the calling thread
+     */
+    bool in_read_section() const noexcept;
+
+    /**
+     * @brief Get the number of readers currently inside the domain
+     * @note Approximate while readers are entering or leaving
+     */
+    std::size_t active_readers() const noexcept;
+
+private:
+    friend class EpochGuard;
+
+    static constexpr std::size_t slot_count = 32;
+
+    struct alignas(64) Slot {
+        std::atomic<std::int64_t> readers{0};
+    };
+
+    std::uint32_t enter_slot(std::uint32_t& slot) const noexcept;
+    void leave_slot(std::uint32_t phase, std::uint32_t slot) const noexcept;
+    bool wait_for_phase(std::uint32_t phase,
+                        std::chrono::steady_clock::time_point deadline) const;
+    bool synchronize_until(std::chrono::steady_clock::time_point deadline);
+
+    mutable std::array<std::array<Slot, slot_count>, 2> m_slots;
+    alignas(64) std::atomic<std::uint32_t> m_phase{0};
+    std::mutex m_writer_mutex;
+};
+
+} // namespace qtplugin
@@ -0,0 +1,80 @@
+/**
+ * @file file_fingerprint.hpp
+ * @brief Cheap file identity checks based on file status
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "error_handling.hpp"
+#include <QByteArray>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+namespace qtplugin {
+
+/**
+ * @brief Size and modification time of a file
+ *
+ * Obtained with a single stat call. Two equal fingerprints mean the file was
+ * not rewritten in between, which is how build and deploy tools replace
+ * plugins; they are not a substitute for a content hash against deliberate
+ * tampering that preserves timestamps.
+ */
+struct FileFingerprint {
+    std::uint64_t size = 0;
+    std::int64_t modified_ns = 0;   ///< Modification time in the filesystem clock, nanoseconds
+
+    friend bool operator==(const FileFingerprint&, const FileFingerprint&) = default;
+};
+
+/**
+ * @brief Fingerprint a file
+ * @param file_path Path to a regular file
+ * @return Fingerprint, or std::nullopt if the file does not exist or cannot be read
+ */
+std::optional<FileFingerprint> fingerprint_file(const std::filesystem::path& file_path) noexcept;
+
+/**
+ * @brief Identity of a file's contents for caching derived data such as digests
+ *
+ * Also distinguishes a file replaced in place by one with equal size and
+ * restored modification time, since the replacement has a different inode or
+ * a newer status change time. On platforms without stat(), device, inode and
+ * change time are zero and the identity degrades to a FileFingerprint.
+ */
+struct FileIdentity {
+    std::uint64_t device = 0;
+    std::uint64_t inode = 0;
+    std::uint64_t size = 0;
+    std::int64_t modified_ns = 0;   ///< Modification time, nanoseconds
+    std::int64_t changed_ns = 0;    ///< Status change time, nanoseconds
+
+    friend bool operator==(const FileIdentity&, const FileIdentity&) = default;
+};
+
+/**
+ * @brief Identify a file, following symbolic links
+ * @param file_path Path to a regular file
+ * @return Identity, or std::nullopt if the file does not exist or cannot be read
+ */
+std::optional<FileIdentity> identify_file(const std::filesystem::path& file_path) noexcept;
+
+/**
+ * @brief Compute the SHA-256 digest of a file's contents
+ * @param file_path Path to a regular file
+ * @return Digest, or error information if the file cannot be read
+ */
+qtplugin::expected<QByteArray, PluginError> file_sha256(const std::filesystem::path& file_path);
+
+/**
+ * @brief Check that no other user can modify a file
+ *
+ * True for a regular file, not a symbolic link, owned by the effective user
+ * and not writable by group or others. On platforms without stat() only the
+ * file type is checked.
+ */
+bool is_user_private_file(const std::filesystem::path& file_path) noexcept;
+
+} // namespace qtplugin
@@ -0,0 +1,175 @@
+/**
+ * @file id_interner.hpp
+ * @brief Process-wide interning of plugin and subscriber identifiers
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "transparent_hash.hpp"
+#include <QString>
+#include <array>
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace qtplugin {
+
+/**
+ * @brief Compact identifier of an interned string
+ *
+ * Two symbols are equal exactly when their strings are equal, so comparing
+ * and hashing a symbol never touches the string.
+ */
+class SymbolId {
+public:
+    constexpr SymbolId() noexcept = default;
+    constexpr explicit SymbolId(std::uint32_t value) noexcept : m_value(value) {}
+
+    /**
+     * @brief Check whether this symbol was issued by the interner
+     */
+    constexpr bool is_valid() const noexcept { return m_value != invalid_value; }
+
+    constexpr std::uint32_t value() const noexcept { return m_value; }
+
+    friend constexpr auto operator<=>(SymbolId, SymbolId) noexcept = default;
+
+private:
+    static constexpr std::uint32_t invalid_value = UINT32_MAX;
+    std::uint32_t m_value = invalid_value;
+};
+
+/**
+ * @brief Process-wide string interner
+ *
+ * Interned strings live until the process exits, which suits identifiers
+ * drawn from a bounded set such as plugin IDs. Looking a string up, and
+ * interning one that is already known, is lock-free; only new strings take
+ * a lock. Resolving a symbol back to its string is lock-free as well.
+ */
+class IdInterner {
+public:
+    /**
+     * @brief Get the process-wide interner
+     */
+    static IdInterner& instance();
+
+    IdInterner(const IdInterner&) = delete;
+    IdInterner& operator=(const IdInterner&) = delete;
+
+    /**
+     * @brief Get the symbol of a string, interning it if needed
+     */
+    SymbolId intern(std::string_view value);
+
+    /**
+     * @brief Get the symbol of a string without interning it
+     * @return Symbol, or std::nullopt if the string was never interned
+     */
+    std::optional<SymbolId> find(std::string_view value) const;
+
+    /**
+     * @brief Get the string of a symbol; empty for an invalid symbol
+     */
+    std::string_view name(SymbolId symbol) const noexcept;
+
+    /**
+     * @brief Get the string of a symbol as a shared QString, for signals and JSON
+     */
+    const QString& qname(SymbolId symbol) const noexcept;
+
+    /**
+     * @brief Get the number of interned strings
+     */
+    std::size_t size() const noexcept { return m_size.load(std::memory_order_acquire); }
+
+private:
+    struct Entry {
+        std::string name;
+        QString qname;
+    };
+
+    static constexpr std::size_t chunk_bits = 12;
+    static constexpr std::size_t chunk_size = std::size_t{1} << chunk_bits;
+    static constexpr std::size_t max_chunks = 1024;
+
+    // Open-addressed table of symbols, probed linearly; a cell holds the
+    // symbol value plus one, zero marks it empty. Cells are only ever filled,
+    // so readers probe without a lock
+    struct Index {
+        explicit Index(std::size_t capacity);
+        std::size_t mask;
+        std::unique_ptr<std::atomic<std::uint32_t>[]> cells;
+    };
+
+    IdInterner() = default;
+    const Entry* entry(SymbolId symbol) const noexcept;
+    void index_symbol(SymbolId symbol);
+    static void insert_cell(Index& index, std::string_view value, SymbolId symbol) noexcept;
+
+    std::mutex m_mutex;   ///< Serializes interning of new strings
+    // Entries never move, so names can be read without the lock
+    std::array<std::atomic<Entry*>, max_chunks> m_chunks{};
+    std::array<std::unique_ptr<Entry[]>, max_chunks> m_chunk_storage;
+    std::atomic<std::size_t> m_size{0};
+    std::atomic<Index*> m_index{nullptr};
+    // Every index built so far; a reader may still probe a replaced one
+    std::vector<std::unique_ptr<Index>> m_indexes;
+};
+
+/**
+ * @brief Interned plugin ID
+ *
+ * Obtained once, e.g. from PluginManager::plugin_handle(), and passed to the
+ * handle overloads of hot APIs instead of a string.
+ */
+class PluginHandle {
+public:
+    constexpr PluginHandle() noexcept = default;
+    constexpr explicit PluginHandle(SymbolId symbol) noexcept : m_symbol(symbol) {}
+    explicit PluginHandle(std::string_view plugin_id) : m_symbol(IdInterner::instance().intern(plugin_id)) {}
+
+    constexpr bool is_valid() const noexcept { return m_symbol.is_valid(); }
+    constexpr SymbolId symbol() const noexcept { return m_symbol; }
+
+    /**
+     * @brief Get the plugin ID
+     */
+    std::string_view id() const noexcept { return IdInterner::instance().name(m_symbol); }
+
+    /**
+     * @brief Get the plugin ID as a QString
+     */
+    const QString& qid() const noexcept { return IdInterner::instance().qname(m_symbol); }
+
+    friend constexpr auto operator<=>(PluginHandle, PluginHandle) noexcept = default;
+
+private:
+    SymbolId m_symbol;
+};
+
+} // namespace qtplugin
+
+template<>
+struct std::hash<qtplugin::SymbolId> {
+    std::size_t operator()(qtplugin::SymbolId symbol) const noexcept {
+        return std::hash<std::uint32_t>{}(symbol.value());
+    }
+};
+
+template<>
+struct std::hash<qtplugin::PluginHandle> {
+    std::size_t operator()(qtplugin::PluginHandle handle) const noexcept {
+        return std::hash<qtplugin::SymbolId>{}(handle.symbol());
+    }
+};
@@ -0,0 +1,197 @@
+/**
+ * @file trace.hpp
+ * @brief Low-overhead scoped tracing with Chrome trace export
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include "error_handling.hpp"
+#include <QJsonDocument>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace qtplugin {
+
+/**
+ * @brief A completed trace span
+ */
+struct TraceEvent {
+    const char* category = "";    ///< Static category string
+    const char* name = "";        ///< Static event name
+    std::int64_t start_ns = 0;    ///< Start, relative to the recorder's origin
+    std::int64_t duration_ns = 0; ///< Duration
+    std::string detail;           ///< Optional argument, e.g. the plugin path
+};
+
+/**
+ * @brief Process-wide trace event recorder
+ *
+ * Every thread appends to its own buffer, so recording never contends with
+ * other threads. Buffers outlive their threads until clear() is called.
+ * Recording is disabled by default; while disabled, a TraceScope costs a
+ * single relaxed atomic load.
+ *
+ * The export uses the Chrome trace event format, which chrome://tracing,
+ * Perfetto and speedscope display as a flame graph per thread.
+ */
+class TraceRecorder {
+public:
+    /**
+     * @brief Maximum number of events kept per thread; later events are dropped
+     */
+    static constexpr std::size_t max_events_per_thread = 1u << 16;
+
+    /**
+     * @brief Get the process-wide recorder
+     */
+    static TraceRecorder& instance();
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    /**
+     * @brief Enable or disable recording
+     */
+    void set_enabled(bool enabled) noexcept { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Check whether recording is enabled
+     */
+    bool is_enabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Name the calling thread in exported traces
+     */
+    void set_thread_name(std::string_view name);
+
+    /**
+     * @brief Record a completed span on the calling thread's buffer
+     */
+    void record(TraceEvent event);
+
+    /**
+     * @brief Nanoseconds elapsed since the recorder's origin
+     */
+    std::int64_t now_ns() const noexcept;
+
+    /**
+     * @brief Discard all recorded events
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of recorded events across all threads
+     */
+    std::size_t event_count() const;
+
+    /**
+     * @brief Get the number of events dropped because a buffer was full
+     */
+    std::size_t dropped_count() const;
+
+    /**
+     * @brief Build a Chrome trace document of all recorded events
+     */
+    QJsonDocument to_chrome_trace() const;
+
+    /**
+     * @brief Write all recorded events as a Chrome trace JSON file
+     * @param file_path Destination file
+     * @return Success or error information
+     */
+    qtplugin::expected<void, PluginError> export_chrome_trace(const std::filesystem::path& file_path) const;
+
+private:
+    struct ThreadBuffer;
+
+    TraceRecorder();
+    ThreadBuffer& this_thread_buffer();
+
+    std::atomic<bool> m_enabled{false};
+    const std::chrono::steady_clock::time_point m_origin;
+    mutable std::mutex m_buffers_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+};
+
+/**
+ * @brief RAII trace span
+ *
+ * Records the time between construction and destruction when the recorder
+ * was enabled at construction. Category and name must be string literals or
+ * otherwise outlive the recorder.
+ */
+class TraceScope {
+public:
+    TraceScope(const char* category, const char* name) noexcept
+        : m_category(category), m_name(name) {
+        if (TraceRecorder::instance().is_enabled()) {
+            m_start_ns = TraceRecorder::instance().now_ns();
+        }
+    }
+
+    TraceScope(const char* category, const char* name, std::string_view detail)
+        : TraceScope(category, name) {
+        if (is_active()) {
+            m_detail.assign(detail);
+        }
+    }
+
+    template<std::same_as<std::filesystem::path> Path>
+    TraceScope(const char* category, const char* name, const Path& detail)
+        : TraceScope(category, name) {
+        if (is_active()) {
+            m_detail = detail.string();
+        }
+    }
+
+    ~TraceScope() {
+        if (is_active()) {
+            auto& recorder = TraceRecorder::instance();
+            recorder.record(TraceEvent{m_category, m_name, m_start_ns,
+                                       recorder.now_ns() - m_start_ns, std::move(m_detail)});
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    /**
+     * @brief Check whether this span will be recorded
+     */
+    bool is_active() const noexcept { return m_start_ns >= 0; }
+
+private:
+    const char* m_category;
+    const char* m_name;
+    std::int64_t m_start_ns = -1;
+    std::string m_detail;
+};
+
+} // namespace qtplugin
+
+#define QTPLUGIN_TRACE_CONCAT_IMPL(a, b) a##b
+#define QTPLUGIN_TRACE_CONCAT(a, b) QTPLUGIN_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Trace the enclosing scope
+ *
+ * Usage: QTPLUGIN_TRACE_SCOPE("category", "name") or
+ * QTPLUGIN_TRACE_SCOPE("category", "name", detail). Compiles to nothing
+ * when QTPLUGIN_NO_TRACING is defined.
+ */
+#ifdef QTPLUGIN_NO_TRACING
+#define QTPLUGIN_TRACE_SCOPE(...) static_cast<void>(0)
+#else
+#define QTPLUGIN_TRACE_SCOPE(...) \
+    const ::qtplugin::TraceScope QTPLUGIN_TRACE_CONCAT(qtplugin_trace_scope_, __LINE__)(__VA_ARGS__)
+#endif
@@ -0,0 +1,49 @@
+/**
+ * @file transparent_hash.hpp
+ * @brief Heterogeneous lookup helpers for string-keyed containers
+ * @version 3.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace qtplugin {
+
+/**
+ * @brief Transparent string hash
+ *
+ * Lets std::string keyed unordered containers be searched with a
+ * std::string_view or const char* without building a temporary std::string.
+ */
+struct TransparentStringHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view value) const noexcept {
+        return std::hash<std::string_view>{}(value);
+    }
+    std::size_t operator()(const std::string& value) const noexcept {
+        return std::hash<std::string_view>{}(value);
+    }
+    std::size_t operator()(const char* value) const noexcept {
+        return std::hash<std::string_view>{}(value);
+    }
+};
+
+/**
+ * @brief Unordered map keyed by std::string supporting string_view lookups
+ */
+template<typename Value>
+using StringMap = std::unordered_map<std::string, Value, TransparentStringHash, std::equal_to<>>;
+
+/**
+ * @brief Unordered set of std::string supporting string_view lookups
+ */
+using StringSet = std::unordered_set<std::string, TransparentStringHash, std::equal_to<>>;
+
+} // namespace qtplugin
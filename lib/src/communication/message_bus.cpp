@@ -21,6 +21,12 @@ MessageBus::~MessageBus() = default;
 
 qtplugin::expected<void, PluginError> MessageBus::unsubscribe(std::string_view subscriber_id,
                                                         std::optional<std::type_index> message_type) {
+    // A string that was never interned cannot have subscribed
+    const auto subscriber = IdInterner::instance().find(subscriber_id);
+    if (!subscriber) {
+        return make_success();
+    }
+
     std::unique_lock lock(m_subscriptions_mutex);
     
     if (message_type) {
@@ -30,8 +36,8 @@ qtplugin::expected<void, PluginError> MessageBus::unsubscribe(std::string_view s
             auto& subscriptions = it->second;
             subscriptions.erase(
                 std::remove_if(subscriptions.begin(), subscriptions.end(),
-                    [subscriber_id](const std::unique_ptr<Subscription>& sub) {
-                        return sub->subscriber_id == subscriber_id;
+                    [subscriber](const std::unique_ptr<Subscription>& sub) {
+                        return sub->subscriber == *subscriber;
                     }),
                 subscriptions.end()
             );
@@ -40,12 +46,12 @@ qtplugin::expected<void, PluginError> MessageBus::unsubscribe(std::string_view s
                 m_subscriptions.erase(it);
             }
             
-            emit subscription_removed(QString::fromStdString(std::string(subscriber_id)), 
+            emit subscription_removed(IdInterner::instance().qname(*subscriber), 
                                     QString::fromStdString(message_type->name()));
         }
         
         // Update subscriber types
-        auto subscriber_it = m_subscriber_types.find(std::string(subscriber_id));
+        auto subscriber_it = m_subscriber_types.find(*subscriber);
         if (subscriber_it != m_subscriber_types.end()) {
             subscriber_it->second.erase(*message_type);
             if (subscriber_it->second.empty()) {
@@ -57,8 +63,8 @@ qtplugin::expected<void, PluginError> MessageBus::unsubscribe(std::string_view s
         for (auto& [type, subscriptions] : m_subscriptions) {
             subscriptions.erase(
                 std::remove_if(subscriptions.begin(), subscriptions.end(),
-                    [subscriber_id](const std::unique_ptr<Subscription>& sub) {
-                        return sub->subscriber_id == subscriber_id;
+                    [subscriber](const std::unique_ptr<Subscription>& sub) {
+                        return sub->subscriber == *subscriber;
                     }),
                 subscriptions.end()
             );
@@ -74,7 +80,7 @@ qtplugin::expected<void, PluginError> MessageBus::unsubscribe(std::string_view s
         }
         
         // Remove from subscriber types
-        m_subscriber_types.erase(std::string(subscriber_id));
+        m_subscriber_types.erase(*subscriber);
     }
     
     return make_success();
@@ -112,8 +118,13 @@ std::vector<Subscription> MessageBus::subscriptions(std::string_view subscriber_
 }
 
 bool MessageBus::has_subscriber(std::string_view subscriber_id) const {
+    const auto subscriber = IdInterner::instance().find(subscriber_id);
+    return subscriber && has_subscriber(PluginHandle(*subscriber));
+}
+
+bool MessageBus::has_subscriber(PluginHandle subscriber) const {
     std::shared_lock lock(m_subscriptions_mutex);
-    return m_subscriber_types.find(std::string(subscriber_id)) != m_subscriber_types.end();
+    return m_subscriber_types.contains(subscriber.symbol());
 }
 
 QJsonObject MessageBus::statistics() const {
@@ -172,6 +183,11 @@ std::vector<QJsonObject> MessageBus::message_log(size_t limit) const {
     return std::vector<QJsonObject>(start_it, m_message_log.end());
 }
 
+void MessageBus::set_recipient_activator(std::function<void(std::string_view)> activator) {
+    std::unique_lock lock(m_subscriptions_mutex);
+    m_recipient_activator = std::move(activator);
+}
+
 qtplugin::expected<void, PluginError> MessageBus::publish_impl(std::shared_ptr<IMessage> message,
                                                          DeliveryMode mode,
                                                          const std::vector<std::string>& recipients) {
@@ -186,25 +202,45 @@ qtplugin::expected<void, PluginError> MessageBus::publish_impl(std::shared_ptr<I
         log_message(*message, recipients);
     }
     
-    // Find recipients based on delivery mode
-    std::vector<std::string> target_recipients;
-    if (mode == DeliveryMode::Broadcast) {
-        target_recipients = find_recipients(std::type_index(typeid(*message)), {});
-    } else {
-        target_recipients = recipients;
+    // Without explicit recipients every subscriber is addressed
+    const bool broadcast = mode == DeliveryMode::Broadcast || recipients.empty();
+    auto& interner = IdInterner::instance();
+    std::vector<SymbolId> recipient_symbols;
+    if (!broadcast) {
+        // Give explicitly addressed recipients a chance to come up (and
+        // subscribe) before delivery; no bus lock is held while they do
+        std::function<void(std::string_view)> activator;
+        {
+            std::shared_lock lock(m_subscriptions_mutex);
+            activator = m_recipient_activator;
+        }
+        if (activator) {
+            for (const auto& recipient : recipients) {
+                activator(recipient);
+            }
+        }
+
+        // Subscribers are matched by symbol; a name never interned has no subscription
+        recipient_symbols.reserve(recipients.size());
+        for (const auto& recipient : recipients) {
+            if (auto symbol = interner.find(recipient)) {
+                recipient_symbols.push_back(*symbol);
+            }
+        }
     }
     
     // Deliver the message
-    auto delivery_result = deliver_message(*message, target_recipients);
+    auto delivery_result = deliver_message(*message, broadcast, recipient_symbols);
     if (!delivery_result) {
         m_delivery_failures.fetch_add(1);
-        return delivery_result;
+        return qtplugin::unexpected<PluginError>{delivery_result.error()};
     }
     
     // Emit signal
-    emit message_published(QString::fromStdString(std::string(message->type())),
-                          QString::fromStdString(std::string(message->sender())),
-                          static_cast<int>(target_recipients.size()));
+    const auto recipient_count = mode == DeliveryMode::Broadcast ? delivery_result.value() : recipients.size();
+    emit message_published(interner.qname(interner.intern(message->type())),
+                          interner.qname(interner.intern(message->sender())),
+                          static_cast<int>(recipient_count));
     
     return make_success();
 }
@@ -226,14 +262,15 @@ qtplugin::expected<void, PluginError> MessageBus::subscribe_impl(std::string_vie
     // Create subscription
     auto subscription = std::make_unique<Subscription>(subscriber_id, message_type, std::move(handler));
     subscription->filter = std::move(filter);
+    const auto subscriber = subscription->subscriber;
     
     // Add to subscriptions map
     m_subscriptions[message_type].push_back(std::move(subscription));
     
     // Add to subscriber types
-    m_subscriber_types[std::string(subscriber_id)].insert(message_type);
+    m_subscriber_types[subscriber].insert(message_type);
     
-    emit subscription_added(QString::fromStdString(std::string(subscriber_id)),
+    emit subscription_added(IdInterner::instance().qname(subscriber),
                            QString::fromStdString(message_type.name()));
     
     return make_success();
@@ -260,17 +297,18 @@ void MessageBus::log_message(const IMessage& message, const std::vector<std::str
     }
 }
 
-qtplugin::expected<void, PluginError> MessageBus::deliver_message(const IMessage& message,
-                                                           const std::vector<std::string>& recipients) {
+qtplugin::expected<std::size_t, PluginError> MessageBus::deliver_message(const IMessage& message, bool broadcast,
+                                                                        std::span<const SymbolId> recipients) {
     std::shared_lock lock(m_subscriptions_mutex);
     
     std::type_index message_type(typeid(message));
     auto it = m_subscriptions.find(message_type);
     if (it == m_subscriptions.end()) {
         // No subscribers for this message type
-        return make_success();
+        return std::size_t{0};
     }
     
+    std::size_t addressed_count = 0;
     int delivered_count = 0;
     int failed_count = 0;
     
@@ -280,12 +318,13 @@ qtplugin::expected<void, PluginError> MessageBus::deliver_message(const IMessage
         }
         
         // Check if this subscriber should receive the message
-        bool should_deliver = recipients.empty() || 
-                             std::find(recipients.begin(), recipients.end(), subscription->subscriber_id) != recipients.end();
+        bool should_deliver = broadcast ||
+                             std::find(recipients.begin(), recipients.end(), subscription->subscriber) != recipients.end();
         
         if (!should_deliver) {
             continue;
         }
+        ++addressed_count;
         
         // Apply filter if present
         if (subscription->filter && !subscription->filter(message)) {
@@ -308,27 +347,7 @@ qtplugin::expected<void, PluginError> MessageBus::deliver_message(const IMessage
         m_delivery_failures.fetch_add(failed_count);
     }
     
-    return make_success();
-}
-
-std::vector<std::string> MessageBus::find_recipients(std::type_index message_type, 
-                                                    const std::vector<std::string>& specific_recipients) const {
-    if (!specific_recipients.empty()) {
-        return specific_recipients;
-    }
-    
-    // Find all subscribers for this message type
-    std::vector<std::string> recipients;
-    auto it = m_subscriptions.find(message_type);
-    if (it != m_subscriptions.end()) {
-        for (const auto& subscription : it->second) {
-            if (subscription->is_active) {
-                recipients.push_back(subscription->subscriber_id);
-            }
-        }
-    }
-    
-    return recipients;
+    return addressed_count;
 }
 
 } // namespace qtplugin
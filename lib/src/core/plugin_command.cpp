@@ -0,0 +1,57 @@
+/**
+ * @file plugin_command.cpp
+ * @brief Implementation of the handle-based command table
+ * @version 3.0.0
+ */
+
+#include "qtplugin/core/plugin_command.hpp"
+
+namespace qtplugin {
+
+CommandHandle CommandTable::register_command(std::string_view name, Handler handler) {
+    auto existing = m_handles.find(name);
+    if (existing != m_handles.end()) {
+        m_entries[existing->second.value].handler = std::move(handler);
+        return existing->second;
+    }
+
+    const CommandHandle handle{static_cast<std::uint32_t>(m_entries.size())};
+    m_entries.push_back(Entry{std::string(name), std::move(handler)});
+    m_handles.emplace(std::string(name), handle);
+    return handle;
+}
+
+std::optional<CommandHandle> CommandTable::find(std::string_view name) const {
+    auto it = m_handles.find(name);
+    if (it == m_handles.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+qtplugin::expected<QCborValue, PluginError> CommandTable::invoke(CommandHandle handle,
+                                                                 const QCborValue& params) const {
+    if (handle.value >= m_entries.size() || !m_entries[handle.value].handler) {
+        return make_error<QCborValue>(PluginErrorCode::CommandNotFound,
+                                      "Unknown command handle: " + std::to_string(handle.value));
+    }
+    return m_entries[handle.value].handler(params);
+}
+
+std::string_view CommandTable::name(CommandHandle handle) const noexcept {
+    if (handle.value >= m_entries.size()) {
+        return {};
+    }
+    return m_entries[handle.value].name;
+}
+
+std::vector<std::string> CommandTable::names() const {
+    std::vector<std::string> command_names;
+    command_names.reserve(m_entries.size());
+    for (const auto& entry : m_entries) {
+        command_names.push_back(entry.name);
+    }
+    return command_names;
+}
+
+} // namespace qtplugin
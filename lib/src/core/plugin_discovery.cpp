@@ -0,0 +1,342 @@
+/**
+ * @file plugin_discovery.cpp
+ * @brief Implementation of the plugin directory scanner
+ * @version 3.0.0
+ */
+
+#include "qtplugin/core/plugin_discovery.hpp"
+#include "qtplugin/core/plugin_metadata_reader.hpp"
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QSaveFile>
+#include <QFile>
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <thread>
+
+namespace qtplugin {
+
+namespace {
+
+constexpr int index_format_version = 1;
+
+std::string lowercase(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+std::uint64_t read_uint(const char* data, std::size_t size, bool big_endian) {
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        const auto byte = static_cast<std::uint64_t>(static_cast<unsigned char>(data[big_endian ? i : size - 1 - i]));
+        value = (value << 8) | byte;
+    }
+    return value;
+}
+
+} // namespace
+
+PluginFileKind sniff_plugin_file(const std::filesystem::path& file_path) {
+    const std::string extension = lowercase(file_path.extension().string());
+    const bool native = extension == ".so" || extension == ".dll" || extension == ".dylib";
+    if (!native) {
+        return PluginFileKind::Unknown;
+    }
+
+    QFile file(QString::fromStdString(file_path.string()));
+    const qint64 size = file.open(QIODevice::ReadOnly) ? file.size() : 0;
+    const uchar* data = size >= 64 ? file.map(0, size) : nullptr;
+    if (!data) {
+        return PluginFileKind::NotPlugin;
+    }
+    const std::span<const char> image(reinterpret_cast<const char*>(data), static_cast<std::size_t>(size));
+    const char* header = image.data();
+
+    if (std::memcmp(header, "\x7f" "ELF", 4) == 0) {
+        return find_qt_plugin_metadata(image) ? PluginFileKind::QtPlugin : PluginFileKind::NotPlugin;
+    }
+
+    const auto magic = read_uint(header, 4, true);
+    const bool pe = header[0] == 'M' && header[1] == 'Z';
+    const bool mach_o = magic == 0xFEEDFACE || magic == 0xFEEDFACF || magic == 0xCEFAEDFE ||
+                        magic == 0xCFFAEDFE || magic == 0xCAFEBABE;
+    return (pe || mach_o) ? PluginFileKind::NativeLibrary : PluginFileKind::NotPlugin;
+}
+
+PluginDiscovery::PluginDiscovery(std::vector<std::string> extensions, CandidateCheck check)
+    : m_check(std::move(check)) {
+    m_extensions.reserve(extensions.size());
+    for (auto& extension : extensions) {
+        m_extensions.push_back(lowercase(std::move(extension)));
+    }
+}
+
+void PluginDiscovery::set_max_threads(std::size_t threads) {
+    m_max_threads = threads;
+}
+
+bool PluginDiscovery::has_plugin_extension(const std::filesystem::path& file_path) const {
+    const std::string extension = lowercase(file_path.extension().string());
+    return std::find(m_extensions.begin(), m_extensions.end(), extension) != m_extensions.end();
+}
+
+PluginDiscovery::DirectoryEntry PluginDiscovery::list_directory(const std::filesystem::path& directory,
+                                                                std::int64_t mtime,
+                                                                std::size_t& files_checked) const {
+    DirectoryEntry entry;
+    entry.mtime = mtime;
+
+    std::error_code ec;
+    std::filesystem::directory_iterator it(directory, std::filesystem::directory_options::skip_permission_denied, ec);
+    for (; !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        const auto& item = *it;
+        std::error_code status_ec;
+        if (item.is_directory(status_ec) && !item.is_symlink(status_ec)) {
+            entry.subdirectories.push_back(item.path().filename().string());
+            continue;
+        }
+        if (!item.is_regular_file(status_ec) || !has_plugin_extension(item.path())) {
+            continue;
+        }
+
+        ++files_checked;
+        switch (sniff_plugin_file(item.path())) {
+        case PluginFileKind::QtPlugin:
+            entry.candidates.push_back(item.path().filename().string());
+            break;
+        case PluginFileKind::NativeLibrary:
+        case PluginFileKind::Unknown:
+            if (m_check && m_check(item.path())) {
+                entry.candidates.push_back(item.path().filename().string());
+            }
+            break;
+        case PluginFileKind::NotPlugin:
+            break;
+        }
+    }
+
+    return entry;
+}
+
+std::vector<std::filesystem::path> PluginDiscovery::scan(const std::vector<std::filesystem::path>& roots,
+                                                         bool recursive) {
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<std::filesystem::path> queue;
+    std::size_t busy = 0;
+    StringSet visited;
+    std::vector<std::filesystem::path> results;
+    PluginScanStats stats;
+
+    for (const auto& root : roots) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(root, ec)) {
+            auto normalized = root.lexically_normal();
+            if (visited.insert(normalized.string()).second) {
+                queue.push_back(std::move(normalized));
+            }
+        }
+    }
+
+    auto worker = [&]() {
+        std::unique_lock lock(queue_mutex);
+        for (;;) {
+            queue_cv.wait(lock, [&]() { return !queue.empty() || busy == 0; });
+            if (queue.empty()) {
+                return;
+            }
+            const auto directory = std::move(queue.front());
+            queue.pop_front();
+            ++busy;
+            lock.unlock();
+
+            // Unchanged directories are served from the index without listing them
+            DirectoryEntry entry;
+            bool reused = false;
+            bool readable = true;
+            std::size_t files_checked = 0;
+            const std::string key = directory.string();
+            std::error_code ec;
+            const auto mtime = std::filesystem::last_write_time(directory, ec).time_since_epoch().count();
+            if (ec) {
+                readable = false;
+            } else {
+                {
+                    std::lock_guard index_lock(m_index_mutex);
+                    auto cached = m_index.find(key);
+                    if (cached != m_index.end() && cached->second.mtime == mtime) {
+                        entry = cached->second;
+                        reused = true;
+                    }
+                }
+                if (!reused) {
+                    entry = list_directory(directory, mtime, files_checked);
+                    std::lock_guard index_lock(m_index_mutex);
+                    m_index[key] = entry;
+                }
+            }
+
+            lock.lock();
+            if (readable) {
+                for (const auto& name : entry.candidates) {
+                    results.push_back(directory / name);
+                }
+                if (recursive) {
+                    for (const auto& name : entry.subdirectories) {
+                        auto subdirectory = directory / name;
+                        if (visited.insert(subdirectory.string()).second) {
+                            queue.push_back(std::move(subdirectory));
+                        }
+                    }
+                }
+                ++(reused ? stats.directories_reused : stats.directories_scanned);
+                stats.files_checked += files_checked;
+            }
+            --busy;
+            queue_cv.notify_all();
+        }
+    };
+
+    std::size_t threads = m_max_threads.load();
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (threads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i) {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : workers) {
+            thread.join();
+        }
+    }
+
+    std::sort(results.begin(), results.end());
+    stats.candidates = results.size();
+
+    std::lock_guard index_lock(m_index_mutex);
+    if (recursive) {
+        // Drop directories below the scanned roots that no longer exist
+        std::erase_if(m_index, [&](const auto& item) {
+            if (visited.contains(item.first)) {
+                return false;
+            }
+            return std::any_of(roots.begin(), roots.end(), [&](const auto& root) {
+                auto prefix = root.lexically_normal().string();
+                if (!prefix.empty() && prefix.back() != std::filesystem::path::preferred_separator) {
+                    prefix += std::filesystem::path::preferred_separator;
+                }
+                return item.first.starts_with(prefix);
+            });
+        });
+    }
+    m_last_stats = stats;
+
+    return results;
+}
+
+qtplugin::expected<void, PluginError> PluginDiscovery::load_index(const std::filesystem::path& index_file) {
+    QFile file(QString::fromStdString(index_file.string()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return make_error<void>(PluginErrorCode::FileNotFound, "Cannot open discovery index: " + index_file.string());
+    }
+
+    QJsonParseError parse_error;
+    const auto document = QJsonDocument::fromJson(file.readAll(), &parse_error);
+    if (parse_error.error != QJsonParseError::NoError || !document.isObject()) {
+        return make_error<void>(PluginErrorCode::InvalidFormat,
+                               "Invalid discovery index: " + parse_error.errorString().toStdString());
+    }
+
+    const auto root = document.object();
+    QJsonArray extensions;
+    for (const auto& extension : m_extensions) {
+        extensions.append(QString::fromStdString(extension));
+    }
+    if (root["version"].toInt() != index_format_version || root["extensions"].toArray() != extensions) {
+        // Written by another version or for another loader; rescan from scratch
+        return make_error<void>(PluginErrorCode::InvalidFormat, "Discovery index does not match this loader");
+    }
+
+    const auto directories = root["directories"].toObject();
+    std::lock_guard lock(m_index_mutex);
+    for (auto it = directories.begin(); it != directories.end(); ++it) {
+        const auto item = it.value().toObject();
+        DirectoryEntry entry;
+        entry.mtime = item["mtime"].toString().toLongLong();
+        for (const auto& name : item["candidates"].toArray()) {
+            entry.candidates.push_back(name.toString().toStdString());
+        }
+        for (const auto& name : item["subdirectories"].toArray()) {
+            entry.subdirectories.push_back(name.toString().toStdString());
+        }
+        m_index.insert_or_assign(it.key().toStdString(), std::move(entry));
+    }
+
+    return make_success();
+}
+
+qtplugin::expected<void, PluginError> PluginDiscovery::save_index(const std::filesystem::path& index_file) const {
+    QJsonObject directories;
+    {
+        std::lock_guard lock(m_index_mutex);
+        for (const auto& [path, entry] : m_index) {
+            QJsonArray candidates;
+            for (const auto& name : entry.candidates) {
+                candidates.append(QString::fromStdString(name));
+            }
+            QJsonArray subdirectories;
+            for (const auto& name : entry.subdirectories) {
+                subdirectories.append(QString::fromStdString(name));
+            }
+            // Timestamps exceed the exact integer range of a JSON double
+            directories[QString::fromStdString(path)] = QJsonObject{
+                {"mtime", QString::number(static_cast<qint64>(entry.mtime))},
+                {"candidates", candidates},
+                {"subdirectories", subdirectories}
+            };
+        }
+    }
+
+    QJsonArray extensions;
+    for (const auto& extension : m_extensions) {
+        extensions.append(QString::fromStdString(extension));
+    }
+    QJsonObject root;
+    root["version"] = index_format_version;
+    root["extensions"] = extensions;
+    root["directories"] = directories;
+
+    QSaveFile file(QString::fromStdString(index_file.string()));
+    if (!file.open(QIODevice::WriteOnly)) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                               "Cannot write discovery index: " + index_file.string());
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                               "Cannot write discovery index: " + index_file.string());
+    }
+    return make_success();
+}
+
+void PluginDiscovery::clear_index() {
+    std::lock_guard lock(m_index_mutex);
+    m_index.clear();
+}
+
+PluginScanStats PluginDiscovery::last_scan_stats() const {
+    std::lock_guard lock(m_index_mutex);
+    return m_last_stats;
+}
+
+} // namespace qtplugin
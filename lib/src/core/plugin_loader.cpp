@@ -5,18 +5,100 @@
  */
 
 #include <qtplugin/core/plugin_loader.hpp>
+#include <qtplugin/core/plugin_metadata_reader.hpp>
+#include <qtplugin/utils/trace.hpp>
 #include <QPluginLoader>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QFileInfo>
 #include <QDir>
 #include <QLibrary>
+#include <QStandardPaths>
 #include <shared_mutex>
 #include <unordered_map>
 #include <mutex>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace qtplugin {
 
+namespace {
+
+#if defined(__unix__) || defined(__APPLE__)
+// Owned by the current user and writable by nobody else
+bool is_private(const struct stat& status) {
+    return status.st_uid == ::geteuid() && (status.st_mode & (S_IRWXG | S_IRWXO)) == 0;
+}
+#endif
+
+// Copy a file to a path that must not exist yet, without following links there
+qtplugin::expected<void, PluginError> copy_exclusive(const std::filesystem::path& source,
+                                                     const std::filesystem::path& target) {
+#if defined(__unix__) || defined(__APPLE__)
+    const int in = ::open(source.c_str(), O_RDONLY | O_CLOEXEC);
+    if (in < 0) {
+        return make_error<void>(PluginErrorCode::FileSystemError, "Cannot open plugin file: " + source.string());
+    }
+    const int out = ::open(target.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, S_IRWXU);
+    if (out < 0) {
+        ::close(in);
+        return make_error<void>(PluginErrorCode::FileSystemError, "Cannot create staged file: " + target.string());
+    }
+
+    bool copied = true;
+    char buffer[64 * 1024];
+    for (;;) {
+        const ssize_t count = ::read(in, buffer, sizeof(buffer));
+        if (count == 0) {
+            break;
+        }
+        if (count < 0 || ::write(out, buffer, static_cast<size_t>(count)) != count) {
+            copied = false;
+            break;
+        }
+    }
+    struct stat status {};
+    copied = copied && ::fstat(out, &status) == 0 && is_private(status);
+    ::close(in);
+    copied = ::close(out) == 0 && copied;
+    if (!copied) {
+        std::error_code ec;
+        std::filesystem::remove(target, ec);
+        return make_error<void>(PluginErrorCode::FileSystemError, "Cannot stage plugin file: " + target.string());
+    }
+    return make_success();
+#else
+    QFile in(QString::fromStdString(source.string()));
+    QFile out(QString::fromStdString(target.string()));
+    if (!in.open(QIODevice::ReadOnly) || !out.open(QIODevice::WriteOnly | QIODevice::NewOnly)) {
+        return make_error<void>(PluginErrorCode::FileSystemError, "Cannot stage plugin file: " + target.string());
+    }
+    const QByteArray data = in.readAll();
+    if (out.write(data) != data.size() || !out.setPermissions(QFileDevice::ReadOwner | QFileDevice::WriteOwner |
+                                                              QFileDevice::ExeOwner)) {
+        out.remove();
+        return make_error<void>(PluginErrorCode::FileSystemError, "Cannot stage plugin file: " + target.string());
+    }
+    return make_success();
+#endif
+}
+
+// A staged file must still be the private regular file written by copy_exclusive()
+bool is_private_file(const std::filesystem::path& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat status {};
+    return ::lstat(path.c_str(), &status) == 0 && S_ISREG(status.st_mode) && is_private(status);
+#else
+    return std::filesystem::is_regular_file(std::filesystem::symlink_status(path));
+#endif
+}
+
+} // namespace
+
 // Static members for PluginLoaderFactory
 std::unordered_map<std::string, std::function<std::unique_ptr<IPluginLoader>()>> PluginLoaderFactory::s_loader_factories;
 std::mutex PluginLoaderFactory::s_factory_mutex;
@@ -24,13 +106,9 @@ std::mutex PluginLoaderFactory::s_factory_mutex;
 QtPluginLoader::QtPluginLoader() = default;
 
 QtPluginLoader::~QtPluginLoader() {
-    // Unload all plugins
+    // Drop our references; each library is unloaded once the last outstanding
+    // plugin reference is released
     std::unique_lock lock(m_plugins_mutex);
-    for (auto& [id, plugin] : m_loaded_plugins) {
-        if (plugin->qt_loader && plugin->qt_loader->isLoaded()) {
-            plugin->qt_loader->unload();
-        }
-    }
     m_loaded_plugins.clear();
 }
 
@@ -46,6 +124,8 @@ bool QtPluginLoader::can_load(const std::filesystem::path& file_path) const {
 
 qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
 QtPluginLoader::load(const std::filesystem::path& file_path) {
+    QTPLUGIN_TRACE_SCOPE("loader", "QtPluginLoader::load", file_path);
+
     if (!std::filesystem::exists(file_path)) {
         return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::FileNotFound, 
                                                    "Plugin file not found: " + file_path.string());
@@ -78,36 +158,13 @@ QtPluginLoader::load(const std::filesystem::path& file_path) {
         }
     }
     
-    // Create Qt plugin loader
-    auto qt_loader = std::make_unique<QPluginLoader>(QString::fromStdString(file_path.string()));
-    
-    // Load the plugin
-    QObject* instance = qt_loader->instance();
-    if (!instance) {
-        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::LoadFailed,
-                                                   "Failed to load plugin: " + qt_loader->errorString().toStdString());
+    auto library_result = open_library(file_path, file_path);
+    if (!library_result) {
+        return qtplugin::unexpected<PluginError>{library_result.error()};
     }
-    
-    // Cast to IPlugin interface
-    IPlugin* plugin_interface = qobject_cast<IPlugin*>(instance);
-    if (!plugin_interface) {
-        qt_loader->unload();
-        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::LoadFailed,
-                                                   "Plugin does not implement IPlugin interface");
-    }
-    
-    // Create shared pointer with custom deleter that doesn't delete the object
-    // (Qt manages the lifetime)
-    std::shared_ptr<IPlugin> plugin_ptr(plugin_interface, [](IPlugin*) {
-        // Don't delete - Qt manages the lifetime
-    });
-    
-    // Create loaded plugin info
-    auto loaded_plugin = std::make_unique<LoadedPlugin>();
+    auto loaded_plugin = std::move(library_result.value());
     loaded_plugin->id = plugin_id;
-    loaded_plugin->file_path = file_path;
-    loaded_plugin->qt_loader = std::move(qt_loader);
-    loaded_plugin->instance = plugin_ptr;
+    auto plugin_ptr = loaded_plugin->instance;
     
     // Store the loaded plugin
     {
@@ -121,27 +178,158 @@ QtPluginLoader::load(const std::filesystem::path& file_path) {
 qtplugin::expected<void, PluginError> QtPluginLoader::unload(std::string_view plugin_id) {
     std::unique_lock lock(m_plugins_mutex);
     
-    auto it = m_loaded_plugins.find(std::string(plugin_id));
+    auto it = m_loaded_plugins.find(plugin_id);
     if (it == m_loaded_plugins.end()) {
         return make_error<void>(PluginErrorCode::LoadFailed, "Plugin not found: " + std::string(plugin_id));
     }
     
-    auto& loaded_plugin = it->second;
+    // Release the loader's lease on the library; the library itself is
+    // unloaded when the last plugin reference held elsewhere goes away
+    m_loaded_plugins.erase(it);
+    if (auto staged = m_staged_plugins.find(plugin_id); staged != m_staged_plugins.end()) {
+        m_staged_plugins.erase(staged);
+    }
     
-    // Unload the Qt plugin
-    if (loaded_plugin->qt_loader && loaded_plugin->qt_loader->isLoaded()) {
-        if (!loaded_plugin->qt_loader->unload()) {
-            return make_error<void>(PluginErrorCode::LoadFailed,
-                                   "Failed to unload plugin: " + loaded_plugin->qt_loader->errorString().toStdString());
+    return make_success();
+}
+
+qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+QtPluginLoader::stage_reload(std::string_view plugin_id, const std::filesystem::path& file_path,
+                             const ReloadValidator& validate) {
+    const std::string id(plugin_id);
+    if (!is_loaded(id)) {
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::PluginNotFound, "Plugin not loaded: " + id);
+    }
+    if (!is_valid_plugin_file(file_path)) {
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::InvalidFormat,
+                                                   "Invalid plugin file: " + file_path.string());
+    }
+
+    // Qt shares one library per path, so loading the same path again would just
+    // return the running build. Load a private copy of the new file instead.
+    auto shadow_dir = reload_directory();
+    if (!shadow_dir) {
+        return qtplugin::unexpected<PluginError>{shadow_dir.error()};
+    }
+    const std::filesystem::path shadow_path =
+        shadow_dir.value() / (file_path.stem().string() + "-" + std::to_string(m_shadow_counter.fetch_add(1)) +
+                              file_path.extension().string());
+
+    std::error_code ec;
+    auto copied = copy_exclusive(file_path, shadow_path);
+    if (!copied) {
+        return qtplugin::unexpected<PluginError>{copied.error()};
+    }
+    // A detached signature travels with the file, so the copy validates like the original
+    std::filesystem::path signature_path = file_path;
+    signature_path += ".sig";
+    std::filesystem::path shadow_signature_path = shadow_path;
+    shadow_signature_path += ".sig";
+    if (std::filesystem::exists(signature_path, ec)) {
+        (void)copy_exclusive(signature_path, shadow_signature_path);
+    }
+    auto discard = [&]() {
+        std::filesystem::remove(shadow_path, ec);
+        std::filesystem::remove(shadow_signature_path, ec);
+    };
+
+    auto staged_metadata = read_metadata(shadow_path);
+    auto staged_id = staged_metadata ? extract_plugin_id(staged_metadata.value())
+                                     : qtplugin::unexpected<PluginError>{staged_metadata.error()};
+    if (!staged_id || staged_id.value() != id) {
+        discard();
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::InvalidFormat,
+                                                   "Replacement file does not contain plugin " + id);
+    }
+
+    // Validated on the private copy, which is what gets loaded
+    if (validate) {
+        auto validation = validate(shadow_path);
+        if (!validation) {
+            discard();
+            return qtplugin::unexpected<PluginError>{validation.error()};
         }
     }
-    
-    // Remove from loaded plugins
-    m_loaded_plugins.erase(it);
-    
+
+    if (!is_private_file(shadow_path)) {
+        discard();
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::SecurityViolation,
+                                                   "Staged plugin file was modified: " + shadow_path.string());
+    }
+    std::filesystem::remove(shadow_signature_path, ec);
+
+    auto library_result = open_library(shadow_path, file_path);
+    if (!library_result) {
+        discard();
+        return qtplugin::unexpected<PluginError>{library_result.error()};
+    }
+    auto staged = std::move(library_result.value());
+    staged->id = id;
+    auto instance = staged->instance;
+
+    std::unique_lock lock(m_plugins_mutex);
+    m_staged_plugins[id] = std::move(staged);
+    return instance;
+}
+
+qtplugin::expected<std::filesystem::path, PluginError> QtPluginLoader::reload_directory() {
+    std::lock_guard lock(m_shadow_mutex);
+    if (!m_shadow_dir) {
+        // A fresh mkdtemp() directory is only accessible to this user, so no
+        // one else can plant or swap a file that is about to be loaded
+        QString base = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation);
+        if (base.isEmpty() || !QDir().mkpath(base)) {
+            base = QDir::tempPath();
+        }
+        auto dir = std::make_unique<QTemporaryDir>(QDir(base).filePath(QStringLiteral("qtplugin-reload-XXXXXX")));
+        if (!dir->isValid()) {
+            return make_error<std::filesystem::path>(PluginErrorCode::FileSystemError,
+                                                     "Cannot create reload directory in " + base.toStdString());
+        }
+        m_shadow_dir = std::move(dir);
+    }
+
+    const std::filesystem::path path = m_shadow_dir->path().toStdString();
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat status {};
+    if (::lstat(path.c_str(), &status) != 0 || !S_ISDIR(status.st_mode) || !is_private(status)) {
+        return make_error<std::filesystem::path>(PluginErrorCode::SecurityViolation,
+                                                 "Reload directory is not private: " + path.string());
+    }
+#endif
+    return path;
+}
+
+qtplugin::expected<void, PluginError> QtPluginLoader::commit_reload(std::string_view plugin_id) {
+    std::unique_lock lock(m_plugins_mutex);
+    auto staged = m_staged_plugins.find(plugin_id);
+    if (staged == m_staged_plugins.end()) {
+        return make_error<void>(PluginErrorCode::StateError,
+                               "No staged reload for plugin: " + std::string(plugin_id));
+    }
+
+    // Replacing the entry drops the loader's lease on the previous build
+    m_loaded_plugins[staged->first] = std::move(staged->second);
+    m_staged_plugins.erase(staged);
     return make_success();
 }
 
+void QtPluginLoader::abort_reload(std::string_view plugin_id) {
+    std::unique_lock lock(m_plugins_mutex);
+    if (auto staged = m_staged_plugins.find(plugin_id); staged != m_staged_plugins.end()) {
+        m_staged_plugins.erase(staged);
+    }
+}
+
+qtplugin::expected<QJsonObject, PluginError>
+QtPluginLoader::read_plugin_metadata(const std::filesystem::path& file_path) const {
+    if (!is_valid_plugin_file(file_path)) {
+        return make_error<QJsonObject>(PluginErrorCode::InvalidFormat,
+                                       "Invalid plugin file: " + file_path.string());
+    }
+    return read_metadata(file_path);
+}
+
 std::vector<std::string> QtPluginLoader::supported_extensions() const {
     return {".dll", ".so", ".dylib", ".qtplugin"};
 }
@@ -173,38 +361,62 @@ std::vector<std::string> QtPluginLoader::loaded_plugins() const {
 
 bool QtPluginLoader::is_loaded(std::string_view plugin_id) const {
     std::shared_lock lock(m_plugins_mutex);
-    return m_loaded_plugins.find(std::string(plugin_id)) != m_loaded_plugins.end();
+    return m_loaded_plugins.contains(plugin_id);
 }
 
-qtplugin::expected<QJsonObject, PluginError> QtPluginLoader::read_metadata(const std::filesystem::path& file_path) const {
-    QPluginLoader temp_loader(QString::fromStdString(file_path.string()));
-    QJsonObject metadata = temp_loader.metaData();
+qtplugin::expected<std::unique_ptr<QtPluginLoader::LoadedPlugin>, PluginError>
+QtPluginLoader::open_library(const std::filesystem::path& library_path,
+                             const std::filesystem::path& source_path) const {
+    QTPLUGIN_TRACE_SCOPE("loader", "open_library", library_path);
+    auto qt_loader = std::make_unique<QPluginLoader>(QString::fromStdString(library_path.string()));
     
-    if (metadata.isEmpty()) {
-        return make_error<QJsonObject>(PluginErrorCode::InvalidFormat, "No metadata found in plugin file");
+    // Load the plugin
+    QObject* instance = qt_loader->instance();
+    if (!instance) {
+        return make_error<std::unique_ptr<LoadedPlugin>>(PluginErrorCode::LoadFailed,
+                                                        "Failed to load plugin: " + qt_loader->errorString().toStdString());
     }
     
-    return metadata;
-}
-
-qtplugin::expected<std::string, PluginError> QtPluginLoader::extract_plugin_id(const QJsonObject& metadata) const {
-    // Try to get plugin ID from metadata
-    if (metadata.contains("MetaData")) {
-        QJsonObject meta_data = metadata["MetaData"].toObject();
-        if (meta_data.contains("id") && meta_data["id"].isString()) {
-            return meta_data["id"].toString().toStdString();
-        }
-        if (meta_data.contains("name") && meta_data["name"].isString()) {
-            return meta_data["name"].toString().toStdString();
-        }
+    // Cast to IPlugin interface
+    IPlugin* plugin_interface = qobject_cast<IPlugin*>(instance);
+    if (!plugin_interface) {
+        qt_loader->unload();
+        return make_error<std::unique_ptr<LoadedPlugin>>(PluginErrorCode::LoadFailed,
+                                                        "Plugin does not implement IPlugin interface");
     }
     
-    // Fallback to IID
-    if (metadata.contains("IID") && metadata["IID"].isString()) {
-        return metadata["IID"].toString().toStdString();
-    }
+    // The plugin pointer shares ownership of the library: Qt owns the instance,
+    // and QPluginLoader::unload() (which unmaps the code) only runs when the
+    // last reference is released, so callers still holding the plugin keep it
+    // valid even after unload(). Staged copies are deleted at the same point.
+    const bool remove_file = library_path != source_path;
+    std::shared_ptr<QPluginLoader> library(qt_loader.release(), [library_path, remove_file](QPluginLoader* loader) {
+        if (loader->isLoaded()) {
+            loader->unload();
+        }
+        delete loader;
+        if (remove_file) {
+            std::error_code ec;
+            std::filesystem::remove(library_path, ec);
+        }
+    });
     
-    return make_error<std::string>(PluginErrorCode::InvalidFormat, "No plugin ID found in metadata");
+    auto loaded_plugin = std::make_unique<LoadedPlugin>();
+    loaded_plugin->file_path = source_path;
+    loaded_plugin->instance = std::shared_ptr<IPlugin>(library, plugin_interface);
+    loaded_plugin->qt_loader = std::move(library);
+    return loaded_plugin;
+}
+
+qtplugin::expected<QJsonObject, PluginError> QtPluginLoader::read_metadata(const std::filesystem::path& file_path) const {
+    QTPLUGIN_TRACE_SCOPE("loader", "read_metadata");
+    // Parsed from the mapped file; QPluginLoader::metaData() would go
+    // through the library loader machinery for every candidate file
+    return read_qt_plugin_metadata(file_path);
+}
+
+qtplugin::expected<std::string, PluginError> QtPluginLoader::extract_plugin_id(const QJsonObject& metadata) const {
+    return plugin_id_from_metadata(metadata);
 }
 
 bool QtPluginLoader::is_valid_plugin_file(const std::filesystem::path& file_path) const {
@@ -228,6 +440,26 @@ bool QtPluginLoader::is_valid_plugin_file(const std::filesystem::path& file_path
     return false;
 }
 
+qtplugin::expected<std::string, PluginError> plugin_id_from_metadata(const QJsonObject& metadata) {
+    // Try to get plugin ID from metadata
+    if (metadata.contains("MetaData")) {
+        QJsonObject meta_data = metadata["MetaData"].toObject();
+        if (meta_data.contains("id") && meta_data["id"].isString()) {
+            return meta_data["id"].toString().toStdString();
+        }
+        if (meta_data.contains("name") && meta_data["name"].isString()) {
+            return meta_data["name"].toString().toStdString();
+        }
+    }
+    
+    // Fallback to IID
+    if (metadata.contains("IID") && metadata["IID"].isString()) {
+        return metadata["IID"].toString().toStdString();
+    }
+    
+    return make_error<std::string>(PluginErrorCode::InvalidFormat, "No plugin ID found in metadata");
+}
+
 // PluginLoaderFactory implementation
 
 std::unique_ptr<IPluginLoader> PluginLoaderFactory::create_default_loader() {
@@ -14,7 +14,14 @@
 #include "../../include/qtplugin/managers/resource_manager_impl.hpp"
 #include "../../include/qtplugin/managers/resource_lifecycle_impl.hpp"
 #include "../../include/qtplugin/managers/resource_monitor_impl.hpp"
+#include "../../include/qtplugin/utils/trace.hpp"
 #include <QTimer>
+#include <QThread>
+#include <QAbstractEventDispatcher>
+#include <QCborArray>
+#include <QCborMap>
+#include <QCborValue>
+#include <QSaveFile>
 #include <QFileSystemWatcher>
 #include <QJsonDocument>
 #include <QJsonArray>
@@ -22,13 +29,62 @@
 #include <QString>
 #include <QLoggingCategory>
 #include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
 #include <algorithm>
+#include <condition_variable>
 #include <fstream>
+#include <set>
+#include <thread>
 
 Q_LOGGING_CATEGORY(pluginLog, "qtplugin.manager")
 
 namespace qtplugin {
 
+namespace {
+
+// Hand runtime state from the instance being replaced to its successor.
+// Prefers the binary snapshot interface and falls back to the JSON
+// "save_state"/"restore_state" commands.
+void transfer_plugin_state(const std::string& plugin_id, IPlugin& from, IPlugin& to) {
+    try {
+        auto snapshot = from.save_state();
+        if (snapshot) {
+            if (!to.restore_state(snapshot.value())) {
+                qCWarning(pluginLog) << "Failed to restore state snapshot for plugin:"
+                                    << QString::fromStdString(plugin_id);
+            }
+            return;
+        }
+
+        auto json_state = from.execute_command("save_state");
+        if (json_state && !to.execute_command("restore_state", json_state.value())) {
+            qCWarning(pluginLog) << "Failed to restore state for plugin:" << QString::fromStdString(plugin_id);
+        }
+    } catch (...) {
+        qCWarning(pluginLog) << "Exception during state transfer for plugin:" << QString::fromStdString(plugin_id);
+    }
+}
+
+// Registry entries are keyed by the declared ID, so the instance must agree
+qtplugin::expected<std::shared_ptr<IPlugin>, PluginError> create_static_instance(const StaticPluginEntry& entry) {
+    QTPLUGIN_TRACE_SCOPE("plugin", "create_static_plugin", entry.info.id);
+    auto plugin = entry.create ? entry.create() : nullptr;
+    if (!plugin) {
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::LoadFailed,
+                                                    "Static plugin factory failed: " + std::string(entry.info.id));
+    }
+    if (plugin->id() != entry.info.id) {
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::InvalidFormat,
+                                                    "Static plugin " + std::string(entry.info.id) +
+                                                        " reports ID " + plugin->id());
+    }
+    return plugin;
+}
+
+} // namespace
+
 QJsonObject PluginInfo::to_json() const {
     QJsonObject json;
     json["id"] = QString::fromStdString(id);
@@ -39,6 +95,7 @@ QJsonObject PluginInfo::to_json() const {
     json["last_activity"] = QString::number(std::chrono::duration_cast<std::chrono::milliseconds>(
         last_activity.time_since_epoch()).count());
     json["hot_reload_enabled"] = hot_reload_enabled;
+    json["static"] = static_entry != nullptr;
     json["configuration"] = configuration;
     json["metrics"] = metrics;
     
@@ -77,61 +134,131 @@ PluginManager::PluginManager(std::unique_ptr<IPluginLoader> loader,
     , m_resource_lifecycle_manager(resource_lifecycle_manager ? std::move(resource_lifecycle_manager) : create_resource_lifecycle_manager(this))
     , m_resource_monitor(resource_monitor ? std::move(resource_monitor) : create_resource_monitor(this))
     , m_file_watcher(std::make_unique<QFileSystemWatcher>(this))
-    , m_monitoring_timer(std::make_unique<QTimer>(this))
 {
     // Connect file watcher
     connect(m_file_watcher.get(), &QFileSystemWatcher::fileChanged,
             this, &PluginManager::on_file_changed);
-    
-    // Connect monitoring timer
-    connect(m_monitoring_timer.get(), &QTimer::timeout,
-            this, &PluginManager::on_monitoring_timer);
+
+    // Reloads run one at a time, off the GUI thread
+    m_reload_pool.setMaxThreadCount(1);
+
+    // Discovery sniffs native libraries itself and asks the loader about the rest
+    m_discovery = std::make_unique<PluginDiscovery>(
+        m_loader->supported_extensions(),
+        [this](const std::filesystem::path& file_path) { return m_loader->can_load(file_path); });
+
+    // Bring lazily registered plugins up when a message is addressed to them
+    m_message_bus->set_recipient_activator([this](std::string_view plugin_id) {
+        (void)activate_plugin(plugin_id);
+    });
 }
 
 PluginManager::~PluginManager() {
+    m_metrics_sampler.stop();
+    bool has_usage_profile = false;
+    {
+        std::lock_guard lock(m_usage_mutex);
+        has_usage_profile = !m_usage_profile_path.empty();
+    }
+    if (has_usage_profile) {
+        auto save_result = save_usage_profile();
+        if (!save_result) {
+            qCWarning(pluginLog) << QString::fromStdString(save_result.error().message);
+        }
+    }
+    m_pending_reloads.clear();
+    m_reload_pool.waitForDone();
+    m_message_bus->set_recipient_activator(nullptr);
     shutdown_all_plugins();
 }
 
 qtplugin::expected<std::string, PluginError>
 PluginManager::load_plugin(const std::filesystem::path& file_path, 
                           const PluginLoadOptions& options) {
+    return load_plugin_impl(file_path, options, std::nullopt);
+}
+
+qtplugin::expected<std::string, PluginError>
+PluginManager::load_plugin_impl(const std::filesystem::path& file_path,
+                                const PluginLoadOptions& options,
+                                std::optional<FileIdentity> trusted_identity,
+                                std::optional<FileIdentity> validated_identity) {
+    QTPLUGIN_TRACE_SCOPE("plugin", "load_plugin", file_path);
+
+    // A trusted identity vouches that this exact file passed validation
+    // with these options before, so validation and dependency checks are skipped
+    const bool trusted = trusted_identity.has_value();
+    // A validated identity comes from a security check that already passed
+    const bool security_validated = validated_identity.has_value();
+    // Taken before validation; the file must still have it when it is loaded
+    const auto identity = trusted ? trusted_identity
+                        : security_validated ? validated_identity
+                                             : identify_file(file_path);
+
     // Validate plugin file
-    auto validation_result = validate_plugin_file(file_path);
-    if (!validation_result) {
-        return qtplugin::unexpected<PluginError>{validation_result.error()};
+    if (!trusted) {
+        QTPLUGIN_TRACE_SCOPE("plugin", "validate_file");
+        auto validation_result = validate_plugin_file(file_path);
+        if (!validation_result) {
+            return qtplugin::unexpected<PluginError>{validation_result.error()};
+        }
     }
     
     // Security validation
-    if (options.validate_signature) {
-        auto security_result = m_security_manager->validate_plugin(file_path, options.security_level);
-        if (!security_result.is_valid) {
-            std::string error_msg = "Security validation failed: ";
-            for (const auto& error : security_result.errors) {
-                error_msg += error + "; ";
-            }
-            return make_error<std::string>(PluginErrorCode::SecurityViolation, error_msg);
+    if (options.validate_signature && !trusted && !security_validated) {
+        QTPLUGIN_TRACE_SCOPE("plugin", "validate_security");
+        auto security_result = validate_plugin_security(file_path, options.security_level);
+        if (!security_result) {
+            return qtplugin::unexpected<PluginError>{security_result.error()};
         }
     }
-    
-    // Load the plugin
-    auto plugin_result = m_loader->load(file_path);
-    if (!plugin_result) {
-        return qtplugin::unexpected<PluginError>{plugin_result.error()};
+
+    // Lazy activation registers the plugin from its metadata; the library is
+    // loaded by activate_plugin() on first use
+    if (options.lazy_activation) {
+        auto registration = register_discovered_plugin(file_path, options, identity);
+        if (registration || registration.error().code != PluginErrorCode::NotImplemented) {
+            return registration;
+        }
+        // The loader cannot read metadata on its own, fall back to loading eagerly
     }
     
-    auto plugin = plugin_result.value();
-    std::string plugin_id = plugin->id();
-    
-    // Check if already loaded
+    // A file replaced since it was identified is not what was validated
+    if (!identity || identify_file(file_path) != identity) {
+        return make_error<std::string>(PluginErrorCode::SecurityViolation,
+                                       "Plugin file changed during validation: " + file_path.string());
+    }
+
+    // Load the plugin
+    std::shared_ptr<IPlugin> plugin;
     {
-        std::shared_lock lock(m_plugins_mutex);
-        if (m_plugins.find(plugin_id) != m_plugins.end()) {
-            return make_error<std::string>(PluginErrorCode::LoadFailed, "Plugin already loaded: " + plugin_id);
+        QTPLUGIN_TRACE_SCOPE("plugin", "load_library");
+        auto plugin_result = m_loader->load(file_path);
+        if (!plugin_result) {
+            return qtplugin::unexpected<PluginError>{plugin_result.error()};
         }
+        plugin = std::move(plugin_result.value());
+    }
+    const std::string plugin_id = plugin->id();
+    return register_loaded_plugin(std::move(plugin), plugin_id, file_path, options, identity,
+                                  options.check_dependencies && !trusted, nullptr);
+}
+
+qtplugin::expected<std::string, PluginError>
+PluginManager::register_loaded_plugin(std::shared_ptr<IPlugin> plugin,
+                                      const std::string& plugin_id,
+                                      const std::filesystem::path& file_path,
+                                      const PluginLoadOptions& options,
+                                      std::optional<FileIdentity> identity,
+                                      bool check_dependencies,
+                                      const StaticPluginEntry* static_entry) {
+    // Check if already loaded
+    if (registry_snapshot()->contains(plugin_id)) {
+        return make_error<std::string>(PluginErrorCode::LoadFailed, "Plugin already loaded: " + plugin_id);
     }
     
     // Create plugin info
-    auto plugin_info = std::make_unique<PluginInfo>();
+    auto plugin_info = std::make_shared<PluginInfo>();
     plugin_info->id = plugin_id;
     plugin_info->file_path = file_path;
     plugin_info->metadata = plugin->metadata();
@@ -141,54 +268,407 @@ PluginManager::load_plugin(const std::filesystem::path& file_path,
     plugin_info->instance = plugin;
     plugin_info->configuration = options.configuration;
     plugin_info->hot_reload_enabled = options.enable_hot_reload;
+    plugin_info->load_options = options;
+    plugin_info->file_identity = identity;
+    plugin_info->metrics_slot = std::make_shared<PluginMetricsSlot>();
+    plugin_info->static_entry = static_entry;
     
     // Check dependencies if requested
-    if (options.check_dependencies) {
+    if (check_dependencies) {
         auto dep_result = check_plugin_dependencies(*plugin_info);
         if (!dep_result) {
             return qtplugin::unexpected<PluginError>{dep_result.error()};
         }
     }
     
-    // Configure plugin if configuration provided
-    if (!options.configuration.isEmpty()) {
-        auto config_result = plugin->configure(options.configuration);
-        if (!config_result) {
-            return qtplugin::unexpected<PluginError>{config_result.error()};
+    // Configure and initialize plugin as requested
+    auto init_result = configure_and_initialize(plugin, plugin_id, options, plugin_info->metrics_slot);
+    if (!init_result) {
+        if (init_result.error().code != PluginErrorCode::TimeoutError) {
+            return qtplugin::unexpected<PluginError>{init_result.error()};
+        }
+
+        // Keep the hung plugin registered as failed, but unreachable
+        plugin_info->state = PluginState::Error;
+        plugin_info->instance.reset();
+        plugin_info->error_log.push_back(init_result.error().message);
+        plugin_info->metrics["init_timed_out"] = true;
+        if (insert_plugin_info(std::move(plugin_info))) {
+            update_dependency_graph();
+            emit plugin_error(PluginHandle(plugin_id).qid(), QString::fromStdString(init_result.error().message));
         }
+        return qtplugin::unexpected<PluginError>{init_result.error()};
     }
-    
-    // Initialize plugin if requested
+    plugin_info->metrics["init_latency_us"] = static_cast<qint64>(init_result.value().count());
     if (options.initialize_immediately) {
-        plugin_info->state = PluginState::Initializing;
-        auto init_result = plugin->initialize();
-        if (!init_result) {
-            plugin_info->state = PluginState::Error;
-            plugin_info->error_log.push_back(init_result.error().message);
-            return qtplugin::unexpected<PluginError>{init_result.error()};
-        }
         plugin_info->state = PluginState::Running;
     }
     
-    // Enable hot reload if requested
+    // Publish plugin info
+    if (!insert_plugin_info(std::move(plugin_info))) {
+        return make_error<std::string>(PluginErrorCode::LoadFailed, "Plugin already loaded: " + plugin_id);
+    }
+
+    // Enable hot reload if requested (the plugin must be registered first)
     if (options.enable_hot_reload) {
         enable_hot_reload(plugin_id);
     }
     
-    // Store plugin info
+    // Update dependency graph
     {
-        std::unique_lock lock(m_plugins_mutex);
-        m_plugins[plugin_id] = std::move(plugin_info);
+        QTPLUGIN_TRACE_SCOPE("plugin", "update_dependency_graph");
+        update_dependency_graph();
     }
     
-    // Update dependency graph
-    update_dependency_graph();
-    
-    emit plugin_loaded(QString::fromStdString(plugin_id));
+    emit plugin_loaded(PluginHandle(plugin_id).qid());
     
     return plugin_id;
 }
 
+qtplugin::expected<std::string, PluginError>
+PluginManager::register_discovered_plugin(const std::filesystem::path& file_path,
+                                          const PluginLoadOptions& options,
+                                          std::optional<FileIdentity> identity) {
+    auto raw_metadata = m_loader->read_plugin_metadata(file_path);
+    if (!raw_metadata) {
+        return qtplugin::unexpected<PluginError>{raw_metadata.error()};
+    }
+
+    auto plugin_id_result = plugin_id_from_metadata(raw_metadata.value());
+    if (!plugin_id_result) {
+        return qtplugin::unexpected<PluginError>{plugin_id_result.error()};
+    }
+    const std::string plugin_id = plugin_id_result.value();
+
+    // Embedded metadata is best effort; activation replaces it with the plugin's own
+    PluginMetadata metadata;
+    auto metadata_result = PluginMetadata::from_json(raw_metadata.value()["MetaData"].toObject());
+    if (metadata_result) {
+        metadata = std::move(metadata_result.value());
+    } else {
+        metadata.name = plugin_id;
+    }
+
+    return register_lazy_plugin(plugin_id, file_path, std::move(metadata), options, identity,
+                                options.check_dependencies);
+}
+
+qtplugin::expected<std::string, PluginError>
+PluginManager::register_lazy_plugin(const std::string& plugin_id,
+                                    const std::filesystem::path& file_path,
+                                    PluginMetadata metadata,
+                                    const PluginLoadOptions& options,
+                                    std::optional<FileIdentity> identity,
+                                    bool check_dependencies,
+                                    const StaticPluginEntry* static_entry) {
+    auto plugin_info = std::make_shared<PluginInfo>();
+    plugin_info->id = plugin_id;
+    plugin_info->file_path = file_path;
+    plugin_info->metadata = std::move(metadata);
+    plugin_info->state = PluginState::Discovered;
+    plugin_info->configuration = options.configuration;
+    plugin_info->load_options = options;
+    plugin_info->file_identity = identity;
+    plugin_info->metrics_slot = std::make_shared<PluginMetricsSlot>();
+    plugin_info->activation_latch = std::make_shared<PluginActivationLatch>();
+    plugin_info->static_entry = static_entry;
+
+    if (check_dependencies) {
+        auto dep_result = check_plugin_dependencies(*plugin_info);
+        if (!dep_result) {
+            return qtplugin::unexpected<PluginError>{dep_result.error()};
+        }
+    }
+
+    if (!insert_plugin_info(std::move(plugin_info))) {
+        return make_error<std::string>(PluginErrorCode::LoadFailed, "Plugin already loaded: " + plugin_id);
+    }
+
+    update_dependency_graph();
+
+    emit plugin_state_changed(PluginHandle(plugin_id).qid(), PluginState::Unloaded, PluginState::Discovered);
+
+    return plugin_id;
+}
+
+namespace {
+
+qtplugin::expected<void, PluginError> run_configure_and_initialize(IPlugin& plugin,
+                                                                   const PluginLoadOptions& options,
+                                                                   const std::shared_ptr<PluginMetricsSlot>& metrics_slot) {
+    if (metrics_slot) {
+        plugin.attach_metrics(metrics_slot);
+    }
+
+    // Configure plugin if configuration provided
+    if (!options.configuration.isEmpty()) {
+        QTPLUGIN_TRACE_SCOPE("plugin", "configure", plugin.name());
+        auto config_result = plugin.configure(options.configuration);
+        if (!config_result) {
+            return config_result;
+        }
+    }
+
+    // Initialize plugin if requested
+    if (options.initialize_immediately) {
+        QTPLUGIN_TRACE_SCOPE("plugin", "initialize", plugin.name());
+        auto init_result = plugin.initialize();
+        if (!init_result) {
+            return init_result;
+        }
+    }
+
+    return make_success();
+}
+
+// Runs fn on the thread that owns a QObject plugin, so shutdown() stops its
+// timers where they were started; falls back to the calling thread when the
+// owner has no event loop to deliver the call
+template <typename F>
+void run_on_owner_thread(IPlugin& plugin, F&& fn) {
+    auto* object = dynamic_cast<QObject*>(&plugin);
+    QThread* owner = object ? object->thread() : nullptr;
+    if (owner && owner != QThread::currentThread() && owner->isRunning() &&
+        QAbstractEventDispatcher::instance(owner) != nullptr) {
+        QMetaObject::invokeMethod(object, std::forward<F>(fn), Qt::BlockingQueuedConnection);
+        return;
+    }
+    fn();
+}
+
+} // namespace
+
+struct PluginManager::PluginInitTask {
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;        ///< The worker no longer runs plugin code
+    bool abandoned = false;   ///< The caller gave up waiting
+    std::optional<PluginError> error;
+};
+
+qtplugin::expected<std::chrono::microseconds, PluginError>
+PluginManager::configure_and_initialize(const std::shared_ptr<IPlugin>& plugin,
+                                        const std::string& plugin_id,
+                                        const PluginLoadOptions& options,
+                                        const std::shared_ptr<PluginMetricsSlot>& metrics_slot) {
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = [start]() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    };
+
+    if (options.timeout <= std::chrono::milliseconds::zero()) {
+        auto result = run_configure_and_initialize(*plugin, options, metrics_slot);
+        if (!result) {
+            return qtplugin::unexpected<PluginError>{result.error()};
+        }
+        return elapsed();
+    }
+
+    auto* object = dynamic_cast<QObject*>(plugin.get());
+    QThread* owner = object ? object->thread() : nullptr;
+    if (object && owner != QThread::currentThread()) {
+        // Only the owning thread can hand the object to another thread
+        qCWarning(pluginLog) << "Plugin is owned by another thread, initializing without a deadline:"
+                             << QString::fromStdString(plugin_id);
+        auto result = run_configure_and_initialize(*plugin, options, metrics_slot);
+        if (!result) {
+            return qtplugin::unexpected<PluginError>{result.error()};
+        }
+        return elapsed();
+    }
+
+    // A hung initialize() cannot be interrupted, so it runs on its own thread
+    // that the caller abandons at the deadline
+    auto task = std::make_shared<PluginInitTask>();
+    auto work = [task, instance = plugin, options, metrics_slot, object, owner]() mutable {
+        auto result = run_configure_and_initialize(*instance, options, metrics_slot);
+
+        std::unique_lock lock(task->mutex);
+        if (task->abandoned && result && options.initialize_immediately) {
+            // Nobody took over the late instance; bring it down again
+            lock.unlock();
+            instance->shutdown();
+            lock.lock();
+        }
+        // Hand a QObject plugin, with the timers and children initialize()
+        // created, back to its owner; an abandoned one stays here
+        if (object && !task->abandoned) {
+            object->moveToThread(owner);
+        }
+        // Drop our reference before the library may be unloaded
+        instance.reset();
+        if (!result) {
+            task->error = result.error();
+        }
+        task->done = true;
+        lock.unlock();
+        task->finished.notify_all();
+    };
+
+    if (object) {
+        // QObject plugins start timers and create children in initialize(),
+        // which needs a QThread that owns them while it runs; the thread
+        // deletes itself once it finishes, even after being abandoned
+        auto* init_thread = QThread::create(std::move(work));
+        QObject::connect(init_thread, &QThread::finished, init_thread, &QObject::deleteLater);
+        object->moveToThread(init_thread);
+        init_thread->start();
+    } else {
+        std::thread(std::move(work)).detach();
+    }
+
+    std::unique_lock lock(task->mutex);
+    if (!task->finished.wait_for(lock, options.timeout, [&task] { return task->done; })) {
+        task->abandoned = true;
+        lock.unlock();
+        {
+            std::lock_guard abandoned_lock(m_abandoned_inits_mutex);
+            m_abandoned_inits[plugin_id] = task;
+        }
+        qCWarning(pluginLog) << "Plugin initialization timed out, isolating plugin:" << QString::fromStdString(plugin_id);
+        return make_error<std::chrono::microseconds>(
+            PluginErrorCode::TimeoutError,
+            "Plugin initialization timed out after " + std::to_string(options.timeout.count()) + " ms: " + plugin_id);
+    }
+    if (task->error) {
+        return qtplugin::unexpected<PluginError>{*task->error};
+    }
+    return elapsed();
+}
+
+bool PluginManager::release_abandoned_init(std::string_view plugin_id) {
+    std::lock_guard lock(m_abandoned_inits_mutex);
+    auto it = m_abandoned_inits.find(plugin_id);
+    if (it == m_abandoned_inits.end()) {
+        return false;
+    }
+    auto task = std::move(it->second);
+    m_abandoned_inits.erase(it);
+
+    std::lock_guard task_lock(task->mutex);
+    if (!task->done) {
+        qCWarning(pluginLog) << "Plugin initialization still running, keeping its library loaded:"
+                             << QString::fromStdString(std::string(plugin_id));
+    }
+    return task->done;
+}
+
+qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+PluginManager::activate_plugin(std::string_view plugin_id) {
+    const std::string id(plugin_id);
+    std::shared_ptr<PluginActivationLatch> latch;
+    std::filesystem::path file_path;
+    PluginLoadOptions options;
+    std::optional<FileIdentity> identity;
+    std::shared_ptr<PluginMetricsSlot> metrics_slot;
+    const StaticPluginEntry* static_entry = nullptr;
+
+    {
+        auto info = plugin_info_view(id);
+        if (!info) {
+            return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::PluginNotFound, "Plugin not found: " + id);
+        }
+
+        latch = info->activation_latch;
+        if (!latch) {
+            if (info->instance) {
+                return info->instance;
+            }
+            return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::StateError, "Plugin is not active: " + id);
+        }
+
+        file_path = info->file_path;
+        options = info->load_options;
+        identity = info->file_identity;
+        metrics_slot = info->metrics_slot;
+        static_entry = info->static_entry;
+    }
+
+    // Only the first caller loads the plugin; concurrent callers wait here
+    std::call_once(latch->flag, [&]() {
+        const auto activation_start = std::chrono::steady_clock::now();
+        auto fail = [&](const PluginError& error) {
+            latch->error = error;
+            update_plugin_info(id, [&](PluginInfo& info) {
+                info.state = PluginState::Error;
+                info.error_log.push_back(error.message);
+            });
+            emit plugin_error(PluginHandle(id).qid(), QString::fromStdString(error.message));
+        };
+
+        // A file replaced since registration is validated again before it is loaded
+        if (!static_entry && identify_file(file_path) != identity) {
+            auto validation = validate_plugin_file(file_path);
+            if (validation && options.validate_signature) {
+                validation = validate_plugin_security(file_path, options.security_level);
+            }
+            if (!validation) {
+                fail(validation.error());
+                return;
+            }
+        }
+
+        // Static plugins are part of the executable and have no library to unload
+        auto plugin_result = static_entry ? create_static_instance(*static_entry) : m_loader->load(file_path);
+        if (!plugin_result) {
+            fail(plugin_result.error());
+            return;
+        }
+
+        auto plugin = plugin_result.value();
+        auto init_result = configure_and_initialize(plugin, id, options, metrics_slot);
+        if (!init_result) {
+            // A timed out initialize() may still be running library code
+            if (!static_entry && init_result.error().code != PluginErrorCode::TimeoutError) {
+                (void)m_loader->unload(id);
+            }
+            fail(init_result.error());
+            return;
+        }
+
+        const auto new_state = options.initialize_immediately ? PluginState::Running : PluginState::Loaded;
+        bool published = update_plugin_info(id, [&](PluginInfo& info) {
+            info.instance = plugin;
+            info.metadata = plugin->metadata();
+            info.state = new_state;
+            info.load_time = std::chrono::system_clock::now();
+            info.last_activity = info.load_time;
+            info.activation_latch.reset();
+            info.metrics["init_latency_us"] = static_cast<qint64>(init_result.value().count());
+            info.metrics["activation_latency_us"] = static_cast<qint64>(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - activation_start).count());
+        });
+        if (!published) {
+            // Unloaded while we were activating
+            plugin->shutdown();
+            if (!static_entry) {
+                (void)m_loader->unload(id);
+            }
+            latch->error = PluginError{PluginErrorCode::StateError, "Plugin was unloaded during activation: " + id};
+            return;
+        }
+
+        if (options.enable_hot_reload) {
+            enable_hot_reload(id);
+        }
+        update_dependency_graph();
+
+        emit plugin_state_changed(PluginHandle(id).qid(), PluginState::Discovered, new_state);
+        emit plugin_loaded(PluginHandle(id).qid());
+    });
+
+    if (latch->error) {
+        return qtplugin::unexpected<PluginError>{*latch->error};
+    }
+
+    auto info = plugin_info_view(id);
+    if (!info || !info->instance) {
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::StateError, "Plugin is not active: " + id);
+    }
+    return info->instance;
+}
+
 std::future<qtplugin::expected<std::string, PluginError>>
 PluginManager::load_plugin_async(const std::filesystem::path& file_path,
                                 const PluginLoadOptions& options) {
@@ -198,65 +678,80 @@ PluginManager::load_plugin_async(const std::filesystem::path& file_path,
 }
 
 qtplugin::expected<void, PluginError> PluginManager::unload_plugin(std::string_view plugin_id, bool force) {
-    std::unique_lock lock(m_plugins_mutex);
-    
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it == m_plugins.end()) {
-        return make_error<void>(PluginErrorCode::LoadFailed, "Plugin not found: " + std::string(plugin_id));
+    // Waiting for in-flight calls from inside one of them would never finish
+    if (m_call_epoch.in_read_section()) {
+        return make_error<void>(PluginErrorCode::StateError,
+                               "Cannot unload a plugin from inside a plugin call");
     }
-    
-    auto& plugin_info = it->second;
-    
-    // Check if plugin can be safely unloaded
+
+    // Check if plugin can be safely unloaded (takes the registry lock itself)
     if (!force && !can_unload_safely(plugin_id)) {
         return make_error<void>(PluginErrorCode::DependencyMissing, 
                                "Plugin has dependents and cannot be safely unloaded");
     }
+
+    // Unpublish first so new lookups no longer resolve the plugin
+    auto plugin_info = remove_plugin_info(plugin_id);
+    if (!plugin_info) {
+        return make_error<void>(PluginErrorCode::LoadFailed, "Plugin not found: " + std::string(plugin_id));
+    }
+
+    // Wait for calls that resolved the plugin before it was unpublished
+    m_call_epoch.synchronize();
     
     // Shutdown plugin if running
     if (plugin_info->instance && plugin_info->state == PluginState::Running) {
-        plugin_info->state = PluginState::Stopping;
         plugin_info->instance->shutdown();
-        plugin_info->state = PluginState::Stopped;
     }
     
-    // Disable hot reload
-    disable_hot_reload(plugin_id);
-    
-    // Unload from loader
-    auto unload_result = m_loader->unload(plugin_id);
-    if (!unload_result) {
-        return unload_result;
+    // Stop watching the plugin file
+    if (plugin_info->hot_reload_enabled && m_file_watcher && !plugin_info->file_path.empty()) {
+        m_file_watcher->removePath(QString::fromStdString(plugin_info->file_path.string()));
     }
     
-    // Remove from plugins map
-    m_plugins.erase(it);
+    // Unload from loader; plugins still awaiting lazy activation were never
+    // loaded, a timed out plugin keeps its library until initialize() returns
+    // and static plugins have no library
+    if ((plugin_info->instance || release_abandoned_init(plugin_id)) && !plugin_info->static_entry) {
+        auto unload_result = m_loader->unload(plugin_id);
+        if (!unload_result) {
+            return unload_result;
+        }
+    }
     
     // Update dependency graph
     update_dependency_graph();
     
-    emit plugin_unloaded(QString::fromStdString(std::string(plugin_id)));
+    emit plugin_unloaded(PluginHandle(plugin_id).qid());
     
     return make_success();
 }
 
 std::shared_ptr<IPlugin> PluginManager::get_plugin(std::string_view plugin_id) const {
-    std::shared_lock lock(m_plugins_mutex);
-    
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it != m_plugins.end()) {
-        return it->second->instance;
+    {
+        auto registry = m_registry.load();
+
+        auto it = registry->find(plugin_id);
+        if (it == registry->end()) {
+            return nullptr;
+        }
+        if (!it->second->activation_latch) {
+            return it->second->instance;
+        }
     }
-    
-    return nullptr;
+
+    // First use of a lazily registered plugin. Activation only brings up the
+    // registered entry, so it is logically const for the caller.
+    auto plugin = const_cast<PluginManager*>(this)->activate_plugin(plugin_id);
+    return plugin ? plugin.value() : nullptr;
 }
 
 std::vector<std::string> PluginManager::loaded_plugins() const {
-    std::shared_lock lock(m_plugins_mutex);
+    auto registry = registry_snapshot();
     std::vector<std::string> plugin_ids;
-    plugin_ids.reserve(m_plugins.size());
+    plugin_ids.reserve(registry->size());
     
-    for (const auto& [id, info] : m_plugins) {
+    for (const auto& [id, info] : *registry) {
         plugin_ids.push_back(id);
     }
     
@@ -264,63 +759,30 @@ std::vector<std::string> PluginManager::loaded_plugins() const {
 }
 
 std::vector<PluginInfo> PluginManager::all_plugin_info() const {
-    std::shared_lock lock(m_plugins_mutex);
+    auto registry = registry_snapshot();
     std::vector<PluginInfo> plugin_infos;
-    plugin_infos.reserve(m_plugins.size());
-
-    for (const auto& [id, info] : m_plugins) {
-        if (info) {
-            // Create a copy without the unique_ptr members
-            PluginInfo copy_info;
-            copy_info.id = info->id;
-            copy_info.file_path = info->file_path;
-            copy_info.metadata = info->metadata;
-            copy_info.state = info->state;
-            copy_info.load_time = info->load_time;
-            copy_info.last_activity = info->last_activity;
-            copy_info.instance = info->instance;
-            copy_info.configuration = info->configuration;
-            copy_info.error_log = info->error_log;
-            copy_info.metrics = info->metrics;
-            copy_info.hot_reload_enabled = info->hot_reload_enabled;
+    plugin_infos.reserve(registry->size());
 
-            plugin_infos.push_back(std::move(copy_info));
-        }
+    for (const auto& [id, info] : *registry) {
+        plugin_infos.push_back(*info);
     }
 
     return plugin_infos;
 }
 
+std::shared_ptr<const PluginRegistry> PluginManager::registry_snapshot() const noexcept {
+    return m_registry.load();
+}
+
+std::shared_ptr<const PluginInfo> PluginManager::plugin_info_view(std::string_view plugin_id) const {
+    auto registry = m_registry.load();
+    auto it = registry->find(plugin_id);
+    return it != registry->end() ? it->second : nullptr;
+}
+
 std::vector<std::filesystem::path> PluginManager::discover_plugins(const std::filesystem::path& directory,
                                                                   bool recursive) const {
-    std::vector<std::filesystem::path> discovered_plugins;
-    
-    if (!std::filesystem::exists(directory) || !std::filesystem::is_directory(directory)) {
-        return discovered_plugins;
-    }
-    
-    auto extensions = m_loader->supported_extensions();
-    
-    try {
-        if (recursive) {
-            for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
-                if (entry.is_regular_file() && m_loader->can_load(entry.path())) {
-                    discovered_plugins.push_back(entry.path());
-                }
-            }
-        } else {
-            for (const auto& entry : std::filesystem::directory_iterator(directory)) {
-                if (entry.is_regular_file() && m_loader->can_load(entry.path())) {
-                    discovered_plugins.push_back(entry.path());
-                }
-            }
-        }
-
-    } catch (const std::filesystem::filesystem_error&) {
-        // Ignore filesystem errors during discovery
-    }
-    
-    return discovered_plugins;
+    return m_discovery->scan({directory}, recursive);
 }
 
 void PluginManager::add_search_path(const std::filesystem::path& path) {
@@ -341,43 +803,495 @@ std::vector<std::filesystem::path> PluginManager::search_paths() const {
 int PluginManager::load_all_plugins(const PluginLoadOptions& options) {
     int loaded_count = 0;
     
-    auto paths = search_paths();
-    for (const auto& search_path : paths) {
-        auto discovered = discover_plugins(search_path, true);
-        for (const auto& plugin_path : discovered) {
-            auto result = load_plugin(plugin_path, options);
-            if (result) {
-                ++loaded_count;
+    // All search paths are scanned in one parallel pass
+    auto discovered = m_discovery->scan(search_paths(), true);
+
+    // Plugins loaded by an earlier call are still reported by the scan
+    std::unordered_set<std::filesystem::path> loaded_files;
+    for_each_plugin([&loaded_files](const PluginInfo& info) { loaded_files.insert(info.file_path); });
+
+    std::vector<std::filesystem::path> pending;
+    for (const auto& plugin_path : discovered) {
+        if (!loaded_files.contains(plugin_path)) {
+            pending.push_back(plugin_path);
+        }
+    }
+
+    // Validating the batch up front overlaps the file I/O of all plugins. Each
+    // result carries the identity of the file it vouches for; load_plugin_impl()
+    // skips a file that no longer has it.
+    std::vector<bool> validated(pending.size(), false);
+    std::vector<std::optional<FileIdentity>> validated_identities(pending.size());
+    if (options.validate_signature) {
+        // Security managers that do not identify files are covered by an
+        // identity taken before the batch
+        for (std::size_t i = 0; i < pending.size(); ++i) {
+            validated_identities[i] = identify_file(pending[i]);
+        }
+        auto validations = m_security_manager->validate_plugins(pending, options.security_level);
+        for (std::size_t i = 0; i < pending.size(); ++i) {
+            validated[i] = validations[i].is_valid;
+            if (validations[i].file_identity) {
+                validated_identities[i] = validations[i].file_identity;
             }
+            if (!validated[i]) {
+                qCWarning(pluginLog) << "Security validation failed for"
+                                     << QString::fromStdString(pending[i].string());
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+        if (options.validate_signature && !validated[i]) {
+            continue;
+        }
+        auto result = load_plugin_impl(pending[i], options, std::nullopt,
+                                       validated[i] ? validated_identities[i] : std::nullopt);
+        if (result) {
+            ++loaded_count;
+        } else if (result.error().code == PluginErrorCode::SecurityViolation) {
+            qCWarning(pluginLog) << "Skipping plugin" << QString::fromStdString(pending[i].string()) << ":"
+                                 << QString::fromStdString(result.error().message);
+        }
+    }
+
+    if (!m_discovery_index_path.empty()) {
+        auto save_result = m_discovery->save_index(m_discovery_index_path);
+        if (!save_result) {
+            qCWarning(pluginLog) << QString::fromStdString(save_result.error().message);
         }
     }
     
     return loaded_count;
 }
 
+int PluginManager::load_static_plugins(std::span<const StaticPluginEntry> table, const PluginLoadOptions& options) {
+    std::vector<const StaticPluginEntry*> entries;
+    entries.reserve(table.size());
+    for (const auto& entry : table) {
+        entries.push_back(&entry);
+    }
+    return load_static_plugin_set(std::move(entries), options);
+}
+
+int PluginManager::load_static_plugins(const PluginLoadOptions& options) {
+    return load_static_plugin_set(registered_static_plugins(), options);
+}
+
+int PluginManager::load_static_plugin_set(std::vector<const StaticPluginEntry*> pending,
+                                          const PluginLoadOptions& options) {
+    QTPLUGIN_TRACE_SCOPE("plugin", "load_static_plugins");
+    int loaded_count = 0;
+
+    auto still_pending = [&pending](std::string_view plugin_id) {
+        return std::any_of(pending.begin(), pending.end(),
+                           [plugin_id](const StaticPluginEntry* entry) { return entry->info.id == plugin_id; });
+    };
+
+    while (!pending.empty()) {
+        // Dependencies first; a cycle falls back to table order and is
+        // reported by the dependency check
+        auto next = std::find_if(pending.begin(), pending.end(), [&](const StaticPluginEntry* entry) {
+            return std::none_of(entry->info.dependencies.begin(), entry->info.dependencies.end(), still_pending);
+        });
+        if (next == pending.end()) {
+            next = pending.begin();
+        }
+        const StaticPluginEntry* entry = *next;
+        pending.erase(next);
+
+        // Plugins loaded by an earlier call are skipped
+        if (registry_snapshot()->contains(entry->info.id)) {
+            continue;
+        }
+        auto result = load_static_plugin(*entry, options);
+        if (result) {
+            ++loaded_count;
+        } else {
+            qCWarning(pluginLog) << "Failed to load static plugin" << QString::fromStdString(std::string(entry->info.id))
+                                 << ":" << QString::fromStdString(result.error().message);
+        }
+    }
+    return loaded_count;
+}
+
+qtplugin::expected<std::string, PluginError>
+PluginManager::load_static_plugin(const StaticPluginEntry& entry, const PluginLoadOptions& options) {
+    QTPLUGIN_TRACE_SCOPE("plugin", "load_static_plugin", entry.info.id);
+    const std::string plugin_id(entry.info.id);
+
+    // Nothing to validate or fingerprint: the plugin is part of the executable
+    if (options.lazy_activation) {
+        return register_lazy_plugin(plugin_id, {}, entry.info.metadata(), options, std::nullopt,
+                                    options.check_dependencies, &entry);
+    }
+
+    auto plugin_result = create_static_instance(entry);
+    if (!plugin_result) {
+        return qtplugin::unexpected<PluginError>{plugin_result.error()};
+    }
+    return register_loaded_plugin(std::move(plugin_result.value()), plugin_id, {}, options, std::nullopt,
+                                  options.check_dependencies, &entry);
+}
+
+void PluginManager::set_discovery_index_path(const std::filesystem::path& index_file) {
+    m_discovery_index_path = index_file;
+    if (!index_file.empty() && std::filesystem::exists(index_file)) {
+        auto load_result = m_discovery->load_index(index_file);
+        if (!load_result) {
+            qCWarning(pluginLog) << QString::fromStdString(load_result.error().message);
+        }
+    }
+}
+
+PluginScanStats PluginManager::last_discovery_stats() const {
+    return m_discovery->last_scan_stats();
+}
+
+void PluginManager::set_usage_profile_path(const std::filesystem::path& profile_file) {
+    std::lock_guard lock(m_usage_mutex);
+    m_usage_profile_path = profile_file;
+    if (std::filesystem::exists(profile_file)) {
+        auto profile = PluginUsageProfile::load(profile_file);
+        if (profile) {
+            m_usage_profile = std::move(profile.value());
+        } else {
+            qCWarning(pluginLog) << QString::fromStdString(profile.error().message);
+        }
+    }
+}
+
+qtplugin::expected<void, PluginError> PluginManager::save_usage_profile() const {
+    // The loaded profile stays untouched, so saving twice counts this run once
+    PluginUsageProfile profile;
+    std::filesystem::path profile_file;
+    {
+        std::lock_guard lock(m_usage_mutex);
+        if (m_usage_profile_path.empty()) {
+            return make_error<void>(PluginErrorCode::NotImplemented, "No usage profile path set");
+        }
+        profile = m_usage_profile;
+        profile.record_run(m_first_uses);
+        profile_file = m_usage_profile_path;
+    }
+    return profile.save(profile_file);
+}
+
+PluginUsageProfile PluginManager::usage_profile() const {
+    std::lock_guard lock(m_usage_mutex);
+    return m_usage_profile;
+}
+
+std::future<std::vector<std::string>> PluginManager::preload_hot_plugins(double min_score) {
+    std::vector<std::string> candidates;
+    {
+        auto registry = registry_snapshot();
+        for (auto& plugin_id : usage_profile().hot_set(min_score)) {
+            auto it = registry->find(plugin_id);
+            if (it != registry->end() && it->second->activation_latch) {
+                candidates.push_back(std::move(plugin_id));
+            }
+        }
+    }
+
+    return std::async(std::launch::async, [this, candidates = std::move(candidates)]() {
+        std::vector<std::string> activated;
+        for (const auto& plugin_id : candidates) {
+            if (activate_plugin(plugin_id)) {
+                activated.push_back(plugin_id);
+            }
+        }
+        return activated;
+    });
+}
+
+namespace {
+
+// Basic estimation: plugin info + metadata + error log
+std::size_t estimated_memory_bytes(const PluginInfo& info) {
+    return sizeof(PluginInfo) + info.metadata.name.size() + info.metadata.description.size() +
+           info.error_log.size() * 100;
+}
+
+constexpr auto snapshot_format = "qtplugin-snapshot";
+// Version 1 recorded size and modification time only; its entries are never trusted
+constexpr qint64 snapshot_version = 2;
+
+QCborMap identity_to_cbor(const FileIdentity& identity) {
+    QCborMap cbor;
+    cbor.insert(QStringLiteral("device"), static_cast<qint64>(identity.device));
+    cbor.insert(QStringLiteral("inode"), static_cast<qint64>(identity.inode));
+    cbor.insert(QStringLiteral("size"), static_cast<qint64>(identity.size));
+    cbor.insert(QStringLiteral("modified_ns"), identity.modified_ns);
+    cbor.insert(QStringLiteral("changed_ns"), identity.changed_ns);
+    return cbor;
+}
+
+FileIdentity identity_from_cbor(const QCborMap& cbor) {
+    FileIdentity identity;
+    identity.device = static_cast<std::uint64_t>(cbor.value(QStringLiteral("device")).toInteger());
+    identity.inode = static_cast<std::uint64_t>(cbor.value(QStringLiteral("inode")).toInteger());
+    identity.size = static_cast<std::uint64_t>(cbor.value(QStringLiteral("size")).toInteger());
+    identity.modified_ns = cbor.value(QStringLiteral("modified_ns")).toInteger();
+    identity.changed_ns = cbor.value(QStringLiteral("changed_ns")).toInteger();
+    return identity;
+}
+
+// Identity of the file if it is still exactly the one recorded in a snapshot entry
+std::optional<FileIdentity> verify_recorded_file(const QCborMap& entry, const std::filesystem::path& file_path) {
+    const QByteArray recorded_digest = entry.value(QStringLiteral("sha256")).toByteArray();
+    if (recorded_digest.isEmpty()) {
+        return std::nullopt;
+    }
+    const auto recorded = identity_from_cbor(entry.value(QStringLiteral("identity")).toMap());
+    if (identify_file(file_path) != recorded) {
+        return std::nullopt;
+    }
+    auto digest = file_sha256(file_path);
+    if (!digest || digest.value() != recorded_digest || identify_file(file_path) != recorded) {
+        return std::nullopt;
+    }
+    return recorded;
+}
+
+QCborMap options_to_cbor(const PluginLoadOptions& options) {
+    QCborMap cbor;
+    cbor.insert(QStringLiteral("validate_signature"), options.validate_signature);
+    cbor.insert(QStringLiteral("check_dependencies"), options.check_dependencies);
+    cbor.insert(QStringLiteral("initialize_immediately"), options.initialize_immediately);
+    cbor.insert(QStringLiteral("enable_hot_reload"), options.enable_hot_reload);
+    cbor.insert(QStringLiteral("lazy_activation"), options.lazy_activation);
+    cbor.insert(QStringLiteral("security_level"), static_cast<qint64>(options.security_level));
+    cbor.insert(QStringLiteral("timeout_ms"), static_cast<qint64>(options.timeout.count()));
+    return cbor;
+}
+
+PluginLoadOptions options_from_cbor(const QCborMap& cbor) {
+    PluginLoadOptions options;
+    options.validate_signature = cbor.value(QStringLiteral("validate_signature")).toBool(options.validate_signature);
+    options.check_dependencies = cbor.value(QStringLiteral("check_dependencies")).toBool(options.check_dependencies);
+    options.initialize_immediately =
+        cbor.value(QStringLiteral("initialize_immediately")).toBool(options.initialize_immediately);
+    options.enable_hot_reload = cbor.value(QStringLiteral("enable_hot_reload")).toBool(options.enable_hot_reload);
+    options.lazy_activation = cbor.value(QStringLiteral("lazy_activation")).toBool(options.lazy_activation);
+    options.security_level = static_cast<SecurityLevel>(
+        cbor.value(QStringLiteral("security_level")).toInteger(static_cast<qint64>(options.security_level)));
+    options.timeout = std::chrono::milliseconds(
+        cbor.value(QStringLiteral("timeout_ms")).toInteger(options.timeout.count()));
+    return options;
+}
+
+} // namespace
+
+qtplugin::expected<void, PluginError> PluginManager::save_snapshot(const std::filesystem::path& snapshot_file) const {
+    auto registry = registry_snapshot();
+
+    QCborArray plugins;
+    for (const auto& plugin_id : get_load_order()) {
+        auto it = registry->find(plugin_id);
+        if (it == registry->end() || !it->second || !it->second->file_identity) {
+            continue;
+        }
+        const auto& info = *it->second;
+
+        QCborMap entry;
+        entry.insert(QStringLiteral("id"), QString::fromStdString(info.id));
+        entry.insert(QStringLiteral("path"), QString::fromStdString(info.file_path.string()));
+        // Vouch only for a file that is still the one validated at load: the
+        // identity includes the status change time, which cannot be set back
+        if (identify_file(info.file_path) == info.file_identity) {
+            auto digest = file_sha256(info.file_path);
+            if (digest && identify_file(info.file_path) == info.file_identity) {
+                entry.insert(QStringLiteral("identity"), identity_to_cbor(*info.file_identity));
+                entry.insert(QStringLiteral("sha256"), digest.value());
+            }
+        }
+        entry.insert(QStringLiteral("options"), options_to_cbor(info.load_options));
+        entry.insert(QStringLiteral("metadata"), QCborMap::fromJsonObject(info.metadata.to_json()));
+        entry.insert(QStringLiteral("configuration"), QCborMap::fromJsonObject(info.configuration));
+        plugins.append(entry);
+    }
+
+    QCborMap root;
+    root.insert(QStringLiteral("format"), QString::fromLatin1(snapshot_format));
+    root.insert(QStringLiteral("version"), snapshot_version);
+    root.insert(QStringLiteral("plugins"), plugins);
+
+    // Only readable by this user; restore_snapshot() trusts nothing else
+    QSaveFile file(QString::fromStdString(snapshot_file.string()));
+    if (!file.open(QIODevice::WriteOnly) ||
+        !file.setPermissions(QFileDevice::ReadOwner | QFileDevice::WriteOwner)) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                                "Cannot write snapshot: " + snapshot_file.string());
+    }
+    file.write(QCborValue(root).toCbor());
+    if (!file.commit()) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                                "Cannot write snapshot: " + snapshot_file.string());
+    }
+    return make_success();
+}
+
+qtplugin::expected<SnapshotRestoreResult, PluginError>
+PluginManager::restore_snapshot(const std::filesystem::path& snapshot_file) {
+    QTPLUGIN_TRACE_SCOPE("plugin", "restore_snapshot", snapshot_file);
+
+    QFile file(QString::fromStdString(snapshot_file.string()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return make_error<SnapshotRestoreResult>(PluginErrorCode::FileNotFound,
+                                                 "Cannot read snapshot: " + snapshot_file.string());
+    }
+
+    QCborParserError parse_error;
+    const auto root = QCborValue::fromCbor(file.readAll(), &parse_error).toMap();
+    if (parse_error.error != QCborError::NoError ||
+        root.value(QStringLiteral("format")).toString() != QString::fromLatin1(snapshot_format) ||
+        root.value(QStringLiteral("version")).toInteger() < 1 ||
+        root.value(QStringLiteral("version")).toInteger() > snapshot_version) {
+        return make_error<SnapshotRestoreResult>(PluginErrorCode::InvalidFormat,
+                                                 "Not a plugin snapshot: " + snapshot_file.string());
+    }
+
+    // A snapshot someone else could have written vouches for nothing
+    const bool trusted_snapshot = is_user_private_file(snapshot_file);
+    if (!trusted_snapshot) {
+        qCWarning(pluginLog) << "Snapshot is writable by other users, validating all plugins again:"
+                             << QString::fromStdString(snapshot_file.string());
+    }
+
+    SnapshotRestoreResult result;
+    const auto plugins = root.value(QStringLiteral("plugins")).toArray();
+    for (const auto& value : plugins) {
+        const auto entry = value.toMap();
+        const std::string plugin_id = entry.value(QStringLiteral("id")).toString().toStdString();
+        const std::filesystem::path file_path = entry.value(QStringLiteral("path")).toString().toStdString();
+        if (plugin_id.empty() || registry_snapshot()->contains(plugin_id)) {
+            continue;
+        }
+
+        auto options = options_from_cbor(entry.value(QStringLiteral("options")).toMap());
+        options.configuration = entry.value(QStringLiteral("configuration")).toMap().toJsonObject();
+
+        const auto current = trusted_snapshot ? verify_recorded_file(entry, file_path) : std::nullopt;
+        if (current) {
+            qtplugin::expected<std::string, PluginError> loaded = plugin_id;
+            auto metadata = PluginMetadata::from_json(entry.value(QStringLiteral("metadata")).toMap().toJsonObject());
+            if (options.lazy_activation && metadata) {
+                // Registered from the snapshot; activation checks the identity again
+                loaded = register_lazy_plugin(plugin_id, file_path, std::move(metadata.value()), options,
+                                              current, false);
+            } else {
+                loaded = load_plugin_impl(file_path, options, current);
+            }
+            (loaded ? result.restored : result.failed).push_back(plugin_id);
+            continue;
+        }
+
+        // Changed, missing or not vouched for: the full pipeline decides
+        auto loaded = load_plugin(file_path, options);
+        (loaded ? result.revalidated : result.failed).push_back(plugin_id);
+    }
+
+    return result;
+}
+
 void PluginManager::on_file_changed(const QString& path) {
-    std::string file_path = path.toStdString();
-    
-    // Find plugin by file path
-    std::shared_lock lock(m_plugins_mutex);
-    for (const auto& [id, info] : m_plugins) {
-        if (info->file_path.string() == file_path && info->hot_reload_enabled) {
-            // Reload plugin asynchronously
-            auto future = std::async(std::launch::async, [this, id]() {
-                reload_plugin(id, true);
-            });
-            // Future will be destroyed when it goes out of scope, which is fine for fire-and-forget
-            (void)future; // Suppress unused variable warning
-            break;
+    m_security_manager->invalidate_file(path.toStdString());
+
+    // Builds usually replace the file, which drops it from the watcher
+    if (m_file_watcher && QFileInfo::exists(path) && !m_file_watcher->files().contains(path)) {
+        m_file_watcher->addPath(path);
+    }
+
+    const std::string file_path = path.toStdString();
+    bool watched = false;
+    for_each_plugin([&](const PluginInfo& info) {
+        watched = watched || (info.hot_reload_enabled && info.file_path.string() == file_path);
+    });
+    if (!watched) {
+        return;
+    }
+
+    // Coalesce the burst of events a single build produces: every event
+    // restarts the quiet period
+    auto& pending = m_pending_reloads[file_path];
+    if (!pending.timer) {
+        pending.timer = std::make_unique<QTimer>();
+        pending.timer->setSingleShot(true);
+        connect(pending.timer.get(), &QTimer::timeout, this, [this, path]() {
+            on_reload_quiet_period_elapsed(path);
+        });
+    }
+    const QFileInfo file_info(path);
+    pending.size = file_info.exists() ? file_info.size() : -1;
+    pending.modified_ms = file_info.exists() ? file_info.lastModified().toMSecsSinceEpoch() : -1;
+    pending.unstable_checks = 0;
+    pending.timer->start(static_cast<int>(m_reload_quiet_period_ms.load()));
+}
+
+void PluginManager::on_reload_quiet_period_elapsed(const QString& path) {
+    auto pending = m_pending_reloads.find(path.toStdString());
+    if (pending == m_pending_reloads.end()) {
+        return;
+    }
+
+    // The file must look the same as at the last event before it is trusted:
+    // a binary still being written keeps changing size or timestamp
+    const QFileInfo file_info(path);
+    const qint64 size = file_info.exists() ? file_info.size() : -1;
+    const qint64 modified_ms = file_info.exists() ? file_info.lastModified().toMSecsSinceEpoch() : -1;
+    if (size <= 0 || size != pending->second.size || modified_ms != pending->second.modified_ms) {
+        constexpr int max_unstable_checks = 20;
+        if (++pending->second.unstable_checks < max_unstable_checks) {
+            pending->second.size = size;
+            pending->second.modified_ms = modified_ms;
+            pending->second.timer->start(static_cast<int>(m_reload_quiet_period_ms.load()));
+        } else {
+            qCWarning(pluginLog) << "Plugin file did not settle, skipping reload:" << path;
         }
+        return;
     }
+
+    const std::string file_path = path.toStdString();
+    for_each_plugin([&](const PluginInfo& info) {
+        if (info.hot_reload_enabled && info.file_path.string() == file_path) {
+            m_reload_pool.start([this, id = info.id, path]() { run_scheduled_reload(id, path); });
+        }
+    });
 }
 
-void PluginManager::on_monitoring_timer() {
-    std::shared_lock lock(m_plugins_mutex);
-    for (const auto& [id, info] : m_plugins) {
-        update_plugin_metrics(id);
+void PluginManager::run_scheduled_reload(const std::string& plugin_id, const QString& path) {
+    // Skip rebuilds that produced an identical binary. The digest comes from
+    // the security manager's cache, which validating the new build reuses
+    QByteArray file_hash;
+    if (auto digest = m_security_manager->file_digest(path.toStdString())) {
+        file_hash = std::move(digest.value());
     }
+    {
+        std::lock_guard lock(m_reload_hash_mutex);
+        auto known = m_reloaded_file_hashes.find(plugin_id);
+        if (!file_hash.isEmpty() && known != m_reloaded_file_hashes.end() && known->second == file_hash) {
+            return;
+        }
+    }
+
+    // The new build is created and initialized on the manager's thread
+    QMetaObject::invokeMethod(this, [this, plugin_id, file_hash]() {
+        finish_scheduled_reload(plugin_id, file_hash);
+    }, Qt::QueuedConnection);
+}
+
+void PluginManager::finish_scheduled_reload(const std::string& plugin_id, const QByteArray& file_hash) {
+    auto result = reload_plugin(plugin_id, true);
+    if (!result) {
+        qCWarning(pluginLog) << "Hot reload failed for plugin" << QString::fromStdString(plugin_id) << ":"
+                            << QString::fromStdString(result.error().message);
+        emit plugin_error(PluginHandle(plugin_id).qid(), QString::fromStdString(result.error().message));
+        return;
+    }
+
+    std::lock_guard lock(m_reload_hash_mutex);
+    m_reloaded_file_hashes[plugin_id] = file_hash;
 }
 
 qtplugin::expected<void, PluginError> PluginManager::validate_plugin_file(const std::filesystem::path& file_path) const {
@@ -392,6 +1306,19 @@ qtplugin::expected<void, PluginError> PluginManager::validate_plugin_file(const
     return make_success();
 }
 
+qtplugin::expected<void, PluginError>
+PluginManager::validate_plugin_security(const std::filesystem::path& file_path, SecurityLevel level) const {
+    auto security_result = m_security_manager->validate_plugin(file_path, level);
+    if (!security_result.is_valid) {
+        std::string error_msg = "Security validation failed: ";
+        for (const auto& error : security_result.errors) {
+            error_msg += error + "; ";
+        }
+        return make_error<void>(PluginErrorCode::SecurityViolation, error_msg);
+    }
+    return make_success();
+}
+
 qtplugin::expected<void, PluginError> PluginManager::check_plugin_dependencies(const PluginInfo& info) const {
     // This is a simplified implementation
     // In a real system, you would check if all dependencies are loaded and compatible
@@ -400,14 +1327,15 @@ qtplugin::expected<void, PluginError> PluginManager::check_plugin_dependencies(c
 }
 
 void PluginManager::update_dependency_graph() {
-    std::unique_lock lock(m_plugins_mutex);
+    auto registry = registry_snapshot();
+    std::unique_lock lock(m_dependency_mutex);
 
     // Clear existing dependency graph
     m_dependency_graph.clear();
 
     // Build dependency graph from loaded plugins
-    for (const auto& [plugin_id, plugin_info] : m_plugins) {
-        if (!plugin_info || !plugin_info->instance) {
+    for (const auto& [plugin_id, plugin_info] : *registry) {
+        if (!plugin_info) {
             continue;
         }
 
@@ -436,168 +1364,424 @@ void PluginManager::update_dependency_graph() {
         }
     }
 
+    m_dependency_node_count.store(static_cast<int>(m_dependency_graph.size()), std::memory_order_relaxed);
+
     // Validate for circular dependencies
     detect_circular_dependencies();
 }
 
-void PluginManager::update_plugin_metrics(const std::string& plugin_id) {
-    std::unique_lock lock(m_plugins_mutex);
+std::vector<std::string> PluginManager::get_load_order() const {
+    return topological_sort();
+}
+
+std::vector<std::string> PluginManager::topological_sort() const {
+    std::shared_lock lock(m_dependency_mutex);
+
+    // Kahn's algorithm; dependencies that are not registered do not constrain the order
+    std::unordered_map<std::string, std::size_t> pending;
+    for (const auto& [plugin_id, node] : m_dependency_graph) {
+        std::size_t count = 0;
+        for (const auto& dependency : node.dependencies) {
+            if (m_dependency_graph.contains(dependency)) {
+                ++count;
+            }
+        }
+        pending[plugin_id] = count;
+    }
+
+    // Ordered set keeps the result deterministic between runs
+    std::set<std::string> ready;
+    for (const auto& [plugin_id, count] : pending) {
+        if (count == 0) {
+            ready.insert(plugin_id);
+        }
+    }
+
+    std::vector<std::string> order;
+    order.reserve(m_dependency_graph.size());
+    while (!ready.empty()) {
+        auto plugin_id = std::move(ready.extract(ready.begin()).value());
+        for (const auto& dependent : m_dependency_graph.at(plugin_id).dependents) {
+            if (--pending[dependent] == 0) {
+                ready.insert(dependent);
+            }
+        }
+        order.push_back(std::move(plugin_id));
+    }
+
+    // Plugins in a cycle come last, in name order
+    if (order.size() < m_dependency_graph.size()) {
+        std::set<std::string> remaining;
+        for (const auto& [plugin_id, count] : pending) {
+            if (count > 0) {
+                remaining.insert(plugin_id);
+            }
+        }
+        order.insert(order.end(), remaining.begin(), remaining.end());
+    }
+    return order;
+}
+
+PluginMetricsSample PluginManager::sample_plugin(const PluginInfo& info,
+                                                std::chrono::system_clock::time_point now) {
+    PluginMetricsSample sample;
+    sample.state = info.state;
+    sample.load_time = info.load_time;
+    if (info.instance) {
+        sample.uptime_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - info.load_time).count();
+    }
+    sample.error_count = info.error_log.size();
+
+    sample.estimated_memory_bytes = estimated_memory_bytes(info);
+
+    if (const auto& slot = info.metrics_slot) {
+        sample.commands = slot->commands();
+        sample.command_errors = slot->command_errors();
+        const auto count = slot->size();
+        sample.values.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            sample.values.emplace_back(std::string(slot->name(i)), slot->value(i));
+        }
+    }
+    return sample;
+}
+
+std::shared_ptr<const MetricsSnapshot> PluginManager::take_metrics_snapshot() const {
+    const auto started = std::chrono::steady_clock::now();
+    auto registry = registry_snapshot();
+
+    auto snapshot = std::make_shared<MetricsSnapshot>();
+    snapshot->taken_at = std::chrono::system_clock::now();
+    snapshot->plugins.reserve(registry->size());
+    for (const auto& [id, info] : *registry) {
+        if (info) {
+            snapshot->plugins.emplace(id, sample_plugin(*info, snapshot->taken_at));
+        }
+    }
+    snapshot->sampling_cost = std::chrono::steady_clock::now() - started;
+    return snapshot;
+}
+
+QJsonObject PluginManager::system_metrics() const {
+    auto stats = m_registry_stats.load();
+    const auto count = [&stats](std::initializer_list<PluginState> states) {
+        int total = 0;
+        for (auto state : states) {
+            total += stats->state_counts[static_cast<std::size_t>(state)];
+        }
+        return total;
+    };
+
+    QJsonObject metrics;
 
-    auto it = m_plugins.find(plugin_id);
-    if (it == m_plugins.end() || !it->second || !it->second->instance) {
-        return;
+    // Count plugins by state; paused, stopping and reloading plugins count
+    // as loaded but not fully operational
+    metrics["total_plugins"] = stats->total;
+    metrics["loaded_plugins"] = count({PluginState::Loaded, PluginState::Running, PluginState::Paused,
+                                       PluginState::Stopping, PluginState::Reloading});
+    metrics["failed_plugins"] = count({PluginState::Error});
+    metrics["unloaded_plugins"] = count({PluginState::Unloaded, PluginState::Stopped, PluginState::Discovered});
+    metrics["initializing_plugins"] = count({PluginState::Initializing, PluginState::Loading});
+
+    metrics["error_count"] = stats->error_count;
+    metrics["estimated_memory_bytes"] = stats->estimated_memory_bytes;
+    metrics["command_count"] = static_cast<qint64>(m_command_count.load(std::memory_order_relaxed));
+    metrics["command_error_count"] = static_cast<qint64>(m_command_error_count.load(std::memory_order_relaxed));
+
+    // System uptime (time since the earliest loaded plugin was loaded)
+    qint64 uptime_ms = 0;
+    if (stats->earliest_load_time) {
+        uptime_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now() - *stats->earliest_load_time).count();
+    }
+    metrics["system_uptime_ms"] = uptime_ms;
+
+    // Monitoring status
+    metrics["monitoring_active"] = m_monitoring_active.load();
+    if (auto snapshot = m_metrics_snapshot.load()) {
+        metrics["sampled_at"] = static_cast<qint64>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            snapshot->taken_at.time_since_epoch()).count());
+        metrics["sampling_cost_us"] = static_cast<qint64>(
+            std::chrono::duration_cast<std::chrono::microseconds>(snapshot->sampling_cost).count());
     }
 
-    auto& plugin_info = it->second;
-    auto& metrics = plugin_info->metrics;
+    // Security level
+    metrics["security_level"] = static_cast<int>(m_security_level);
 
-    // Update basic metrics
-    auto now = std::chrono::system_clock::now();
-    plugin_info->last_activity = now;
+    // Dependency graph stats
+    metrics["dependency_nodes"] = m_dependency_node_count.load(std::memory_order_relaxed);
 
-    // Calculate uptime
-    auto uptime_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now - plugin_info->load_time).count();
-    metrics["uptime_ms"] = static_cast<qint64>(uptime_ms);
+    return metrics;
+}
 
-    // Update activity timestamp
-    metrics["last_activity"] = QString::number(
-        std::chrono::duration_cast<std::chrono::milliseconds>(
-            now.time_since_epoch()).count());
+namespace {
 
-    // Get plugin-specific metrics if available
-    try {
-        if (plugin_info->instance->capabilities() & static_cast<PluginCapabilities>(PluginCapability::Monitoring)) {
-            // Try to get metrics from plugin
-            auto plugin_metrics_result = plugin_info->instance->execute_command("get_metrics");
-            if (plugin_metrics_result) {
-                metrics["plugin_metrics"] = plugin_metrics_result.value();
+// Reverse topological levels: every plugin comes after all of its dependents
+std::vector<std::vector<std::string>> shutdown_levels(const PluginRegistry& registry) {
+    std::unordered_map<std::string, std::size_t> pending_dependents;
+    std::unordered_map<std::string, std::vector<std::string>> dependencies;
+    for (const auto& [plugin_id, info] : registry) {
+        pending_dependents.try_emplace(plugin_id, 0);
+    }
+    for (const auto& [plugin_id, info] : registry) {
+        if (!info) {
+            continue;
+        }
+        for (const auto& dependency : info->metadata.dependencies) {
+            auto it = pending_dependents.find(dependency);
+            if (it != pending_dependents.end() && dependency != plugin_id) {
+                ++it->second;
+                dependencies[plugin_id].push_back(dependency);
             }
         }
-    } catch (...) {
-        // Ignore errors in metrics collection
     }
 
-    // Update error count
-    metrics["error_count"] = static_cast<int>(plugin_info->error_log.size());
+    std::vector<std::vector<std::string>> levels;
+    std::vector<std::string> level;
+    for (const auto& [plugin_id, count] : pending_dependents) {
+        if (count == 0) {
+            level.push_back(plugin_id);
+        }
+    }
+    std::size_t scheduled = 0;
+    while (!level.empty()) {
+        std::sort(level.begin(), level.end());
+        std::vector<std::string> next_level;
+        for (const auto& plugin_id : level) {
+            for (const auto& dependency : dependencies[plugin_id]) {
+                if (--pending_dependents[dependency] == 0) {
+                    next_level.push_back(dependency);
+                }
+            }
+        }
+        scheduled += level.size();
+        levels.push_back(std::move(level));
+        level = std::move(next_level);
+    }
 
-    // Update state information
-    metrics["state"] = static_cast<int>(plugin_info->state);
-    metrics["state_name"] = QString::fromStdString(plugin_state_to_string(plugin_info->state));
+    // Plugins in a cycle are stopped together, last
+    if (scheduled < pending_dependents.size()) {
+        for (const auto& [plugin_id, count] : pending_dependents) {
+            if (count > 0) {
+                level.push_back(plugin_id);
+            }
+        }
+        std::sort(level.begin(), level.end());
+        levels.push_back(std::move(level));
+    }
+    return levels;
 }
 
-// === Missing Method Implementations ===
+// One level of a shutdown, shared with its worker threads; workers that are
+// detached at a deadline keep it alive until their plugin returns
+struct ShutdownBatch {
+    enum class Status { Pending, Running, Stopped, Failed, Detached };
+    struct Task {
+        std::string plugin_id;
+        std::shared_ptr<IPlugin> plugin;
+        Status status = Status::Pending;
+        std::chrono::steady_clock::time_point started;
+    };
+
+    std::function<bool(IPlugin&)> stop;
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<Task> tasks;
+    std::size_t next = 0;
+    std::size_t finished = 0;
+    // Skipped dependencies of a detached plugin, released with its worker
+    std::vector<std::shared_ptr<IPlugin>> held;
+};
+
+void run_shutdown_worker(const std::shared_ptr<ShutdownBatch>& batch) {
+    std::unique_lock lock(batch->mutex);
+    while (batch->next < batch->tasks.size()) {
+        auto& task = batch->tasks[batch->next++];
+        task.status = ShutdownBatch::Status::Running;
+        task.started = std::chrono::steady_clock::now();
+        auto plugin = task.plugin;
+        lock.unlock();
+
+        bool stopped = false;
+        try {
+            stopped = batch->stop(*plugin);
+        } catch (...) {
+            // Reported as failed
+        }
 
-QJsonObject PluginManager::system_metrics() const {
-    std::shared_lock lock(m_plugins_mutex);
+        lock.lock();
+        // A detached task was already counted by the scheduler
+        if (task.status == ShutdownBatch::Status::Running) {
+            task.status = stopped ? ShutdownBatch::Status::Stopped : ShutdownBatch::Status::Failed;
+            ++batch->finished;
+            batch->changed.notify_all();
+        }
+    }
+}
 
-    QJsonObject metrics;
+void spawn_shutdown_worker(const std::shared_ptr<ShutdownBatch>& batch) {
+    std::thread([batch]() { run_shutdown_worker(batch); }).detach();
+}
 
-    // Count plugins by state
-    int total_plugins = 0;
-    int loaded_plugins = 0;
-    int failed_plugins = 0;
-    int unloaded_plugins = 0;
-    int initializing_plugins = 0;
-
-    for (const auto& [id, plugin_info] : m_plugins) {
-        total_plugins++;
-        if (plugin_info) {
-            switch (plugin_info->state) {
-                case PluginState::Loaded:
-                case PluginState::Running:
-                    loaded_plugins++;
-                    break;
-                case PluginState::Error:
-                    failed_plugins++;
-                    break;
-                case PluginState::Unloaded:
-                case PluginState::Stopped:
-                    unloaded_plugins++;
-                    break;
-                case PluginState::Initializing:
-                case PluginState::Loading:
-                    initializing_plugins++;
-                    break;
-                case PluginState::Paused:
-                case PluginState::Stopping:
-                case PluginState::Reloading:
-                    // Count as loaded but not fully operational
-                    loaded_plugins++;
-                    break;
-            }
-        }
-    }
-
-    metrics["total_plugins"] = total_plugins;
-    metrics["loaded_plugins"] = loaded_plugins;
-    metrics["failed_plugins"] = failed_plugins;
-    metrics["unloaded_plugins"] = unloaded_plugins;
-    metrics["initializing_plugins"] = initializing_plugins;
-
-    // Calculate memory usage (basic estimation)
-    size_t estimated_memory = 0;
-    for (const auto& [id, plugin_info] : m_plugins) {
-        if (plugin_info) {
-            // Basic estimation: plugin info + metadata + configuration
-            estimated_memory += sizeof(PluginInfo);
-            estimated_memory += plugin_info->metadata.name.size();
-            estimated_memory += plugin_info->metadata.description.size();
-            estimated_memory += plugin_info->error_log.size() * 100; // Rough estimate
-        }
-    }
-    metrics["estimated_memory_bytes"] = static_cast<qint64>(estimated_memory);
-
-    // System uptime (time since first plugin was loaded)
-    if (!m_plugins.empty()) {
-        auto earliest_load_time = std::chrono::system_clock::now();
-        for (const auto& [id, plugin_info] : m_plugins) {
-            if (plugin_info && plugin_info->load_time < earliest_load_time) {
-                earliest_load_time = plugin_info->load_time;
-            }
-        }
-
-        auto uptime_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now() - earliest_load_time).count();
-        metrics["system_uptime_ms"] = static_cast<qint64>(uptime_ms);
-    } else {
-        metrics["system_uptime_ms"] = 0;
-    }
+} // namespace
+
+ShutdownReport PluginManager::run_shutdown_schedule(const PluginRegistry& registry, const ShutdownOptions& options,
+                                                    const std::function<bool(const PluginInfo&)>& select,
+                                                    const std::function<bool(IPlugin&)>& stop) {
+    using Status = ShutdownBatch::Status;
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + options.total_timeout;
+    const std::size_t parallelism = options.max_parallelism > 0
+        ? options.max_parallelism
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    ShutdownReport report;
+    // Dependencies a detached plugin may still use, and the batch whose
+    // worker keeps running its shutdown()
+    std::unordered_map<std::string, std::shared_ptr<ShutdownBatch>> blocked;
+    auto block_dependencies = [&registry, &blocked](const PluginInfo& info,
+                                                    const std::shared_ptr<ShutdownBatch>& holder) {
+        for (const auto& dependency : info.metadata.dependencies) {
+            if (registry.find(dependency) != registry.end()) {
+                blocked.try_emplace(dependency, holder);
+            }
+        }
+    };
+
+    for (const auto& level : shutdown_levels(registry)) {
+        auto batch = std::make_shared<ShutdownBatch>();
+        batch->stop = stop;
+        for (const auto& plugin_id : level) {
+            const auto& info = registry.find(plugin_id)->second;
+            if (!info) {
+                continue;
+            }
+            if (auto it = blocked.find(plugin_id); it != blocked.end()) {
+                // Keep it alive and running until its dependent returns
+                auto holder = it->second;
+                if (info->instance) {
+                    std::lock_guard holder_lock(holder->mutex);
+                    holder->held.push_back(info->instance);
+                }
+                block_dependencies(*info, holder);
+                if (info->instance && select(*info)) {
+                    report.skipped.push_back(plugin_id);
+                    qCWarning(pluginLog) << "Dependency of a detached plugin left running:"
+                                         << QString::fromStdString(plugin_id);
+                }
+                continue;
+            }
+            if (info->instance && select(*info)) {
+                batch->tasks.push_back({plugin_id, info->instance, Status::Pending, {}});
+            }
+        }
+        if (batch->tasks.empty()) {
+            continue;
+        }
 
-    // Monitoring status
-    metrics["monitoring_active"] = m_monitoring_active.load();
+        std::unique_lock lock(batch->mutex);
+        if (std::chrono::steady_clock::now() < deadline) {
+            for (std::size_t i = 0; i < std::min(parallelism, batch->tasks.size()); ++i) {
+                spawn_shutdown_worker(batch);
+            }
+        }
 
-    // Security level
-    metrics["security_level"] = static_cast<int>(m_security_level);
+        while (batch->finished < batch->tasks.size()) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                // Out of time: abandon everything still running or queued
+                for (auto& task : batch->tasks) {
+                    if (task.status == Status::Pending || task.status == Status::Running) {
+                        task.status = Status::Detached;
+                        ++batch->finished;
+                    }
+                }
+                batch->next = batch->tasks.size();
+                break;
+            }
 
-    // Dependency graph stats
-    metrics["dependency_nodes"] = static_cast<int>(m_dependency_graph.size());
+            auto wake = deadline;
+            for (auto& task : batch->tasks) {
+                if (task.status != Status::Running) {
+                    continue;
+                }
+                const auto task_deadline = task.started + options.plugin_timeout;
+                if (task_deadline <= now) {
+                    task.status = Status::Detached;
+                    ++batch->finished;
+                    // The stuck worker is lost to this level; replace it
+                    if (batch->next < batch->tasks.size()) {
+                        spawn_shutdown_worker(batch);
+                    }
+                } else {
+                    wake = std::min(wake, task_deadline);
+                }
+            }
+            if (batch->finished < batch->tasks.size()) {
+                batch->changed.wait_until(lock, wake);
+            }
+        }
 
-    return metrics;
+        for (const auto& task : batch->tasks) {
+            switch (task.status) {
+            case Status::Stopped:
+                report.stopped.push_back(task.plugin_id);
+                break;
+            case Status::Failed:
+                report.failed.push_back(task.plugin_id);
+                break;
+            default:
+                report.detached.push_back(task.plugin_id);
+                block_dependencies(*registry.find(task.plugin_id)->second, batch);
+                qCWarning(pluginLog) << "Plugin missed its shutdown deadline, detaching:"
+                                     << QString::fromStdString(task.plugin_id);
+                break;
+            }
+        }
+    }
+
+    report.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    return report;
 }
 
 void PluginManager::shutdown_all_plugins() {
-    std::unique_lock lock(m_plugins_mutex);
+    (void)shutdown_all_plugins(ShutdownOptions{});
+}
 
-    // Shutdown all plugins (order doesn't matter for shutdown)
-    for (auto& [id, info] : m_plugins) {
-        if (info && info->instance) {
-            try {
-                info->instance->shutdown();
-            } catch (...) {
-                // Log error but continue shutdown
-            }
-        }
+ShutdownReport PluginManager::shutdown_all_plugins(const ShutdownOptions& options) {
+    // Unpublish everything, then shut the plugins down without holding a lock
+    std::shared_ptr<const PluginRegistry> registry;
+    {
+        std::lock_guard lock(m_registry_write_mutex);
+        registry = m_registry.exchange(std::make_shared<const PluginRegistry>());
+        m_load_times.clear();
+        m_registry_stats.store(std::make_shared<const RegistryStats>());
     }
+    if (!m_call_epoch.in_read_section()) {
+        m_call_epoch.synchronize();
+    }
+
+    auto report = run_shutdown_schedule(
+        *registry, options,
+        [](const PluginInfo&) { return true; },
+        [](IPlugin& plugin) {
+            plugin.shutdown();
+            return true;
+        });
+    update_dependency_graph();
 
-    m_plugins.clear();
+    for (const auto& [plugin_id, info] : *registry) {
+        emit plugin_unloaded(PluginHandle(plugin_id).qid());
+    }
+    return report;
 }
 
 int PluginManager::start_all_services() {
-    std::shared_lock lock(m_plugins_mutex);
+    auto epoch_guard = m_call_epoch.enter();
+    auto registry = registry_snapshot();
     int started_count = 0;
 
-    for (auto& [id, info] : m_plugins) {
+    for (const auto& [id, info] : *registry) {
         if (info && info->instance) {
             // Check if plugin has Service capability
             auto capabilities = info->metadata.capabilities;
@@ -622,55 +1806,45 @@ int PluginManager::start_all_services() {
 }
 
 int PluginManager::stop_all_services() {
-    std::shared_lock lock(m_plugins_mutex);
-    int stopped_count = 0;
-
-    for (auto& [id, info] : m_plugins) {
-        if (info && info->instance) {
-            // Check if plugin has Service capability
-            auto capabilities = info->metadata.capabilities;
-            if (capabilities & static_cast<uint32_t>(PluginCapability::Service)) {
-                // Try to cast to service plugin and stop it
-                auto service_plugin = std::dynamic_pointer_cast<IServicePlugin>(info->instance);
-                if (service_plugin) {
-                    try {
-                        auto result = service_plugin->stop_service();
-                        if (result) {
-                            stopped_count++;
-                        }
-                    } catch (...) {
-                        // Log error but continue with other services
-                    }
-                }
-            }
-        }
-    }
+    return static_cast<int>(stop_all_services(ShutdownOptions{}).stopped.size());
+}
 
-    return stopped_count;
+ShutdownReport PluginManager::stop_all_services(const ShutdownOptions& options) {
+    // Detached services outlive this read section; unloading them is up to the caller
+    auto epoch_guard = m_call_epoch.enter();
+    auto registry = registry_snapshot();
+
+    return run_shutdown_schedule(
+        *registry, options,
+        [](const PluginInfo& info) {
+            return (info.metadata.capabilities & static_cast<uint32_t>(PluginCapability::Service)) != 0;
+        },
+        [](IPlugin& plugin) {
+            auto* service_plugin = dynamic_cast<IServicePlugin*>(&plugin);
+            return service_plugin && service_plugin->stop_service().has_value();
+        });
 }
 
 qtplugin::expected<void, PluginError> PluginManager::enable_hot_reload(std::string_view plugin_id) {
-    std::unique_lock lock(m_plugins_mutex);
-
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it == m_plugins.end()) {
+    auto plugin_info = plugin_info_view(plugin_id);
+    if (!plugin_info) {
         return make_error<void>(PluginErrorCode::LoadFailed, "Plugin not found");
     }
 
     // Add to file watcher if not already watching
-    if (m_file_watcher && it->second && !it->second->file_path.empty()) {
-        m_file_watcher->addPath(QString::fromStdString(it->second->file_path.string()));
-        it->second->hot_reload_enabled = true;
+    if (m_file_watcher && !plugin_info->file_path.empty()) {
+        m_file_watcher->addPath(QString::fromStdString(plugin_info->file_path.string()));
+        update_plugin_info(plugin_id, [](PluginInfo& info) { info.hot_reload_enabled = true; });
     }
 
     return make_success();
 }
 
 bool PluginManager::can_unload_safely(std::string_view plugin_id) const {
-    std::shared_lock lock(m_plugins_mutex);
+    auto registry = registry_snapshot();
 
     // Check if any other plugins depend on this one
-    for (const auto& [id, info] : m_plugins) {
+    for (const auto& [id, info] : *registry) {
         if (id != plugin_id && info) {
             // Check metadata dependencies
             for (const auto& dep : info->metadata.dependencies) {
@@ -684,51 +1858,193 @@ bool PluginManager::can_unload_safely(std::string_view plugin_id) const {
     return true;
 }
 
-void PluginManager::disable_hot_reload(std::string_view plugin_id) {
-    std::unique_lock lock(m_plugins_mutex);
+void PluginManager::set_hot_reload_quiet_period(std::chrono::milliseconds quiet_period) {
+    m_reload_quiet_period_ms = std::max<std::chrono::milliseconds::rep>(quiet_period.count(), 0);
+}
+
+std::chrono::milliseconds PluginManager::hot_reload_quiet_period() const {
+    return std::chrono::milliseconds(m_reload_quiet_period_ms.load());
+}
 
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it != m_plugins.end() && it->second) {
-        if (m_file_watcher && !it->second->file_path.empty()) {
-            m_file_watcher->removePath(QString::fromStdString(it->second->file_path.string()));
+void PluginManager::disable_hot_reload(std::string_view plugin_id) {
+    auto plugin_info = plugin_info_view(plugin_id);
+    if (plugin_info) {
+        if (m_file_watcher && !plugin_info->file_path.empty()) {
+            m_file_watcher->removePath(QString::fromStdString(plugin_info->file_path.string()));
         }
-        it->second->hot_reload_enabled = false;
+        update_plugin_info(plugin_id, [](PluginInfo& info) { info.hot_reload_enabled = false; });
     }
 }
 
 qtplugin::expected<void, PluginError> PluginManager::reload_plugin(std::string_view plugin_id, bool preserve_state) {
-    std::unique_lock lock(m_plugins_mutex);
+    if (m_call_epoch.in_read_section()) {
+        return make_error<void>(PluginErrorCode::StateError,
+                               "Cannot reload a plugin from inside a plugin call");
+    }
+
+    auto plugin_info = plugin_info_view(plugin_id);
+    if (!plugin_info) {
+        return make_error<void>(PluginErrorCode::LoadFailed, "Plugin not found");
+    }
+
+    // Static plugins change only with the executable
+    if (plugin_info->static_entry) {
+        return make_error<void>(PluginErrorCode::NotImplemented,
+                                "Statically linked plugins cannot be reloaded: " + std::string(plugin_id));
+    }
+
+    // Lazily registered plugins pick up the new file when they are first used
+    if (!plugin_info->instance) {
+        return make_success();
+    }
+
+    const std::string id(plugin_id);
+    auto old_instance = plugin_info->instance;
+
+    // A new build is held to the same security checks as the original load,
+    // whether the reload was requested or triggered by a file change
+    IPluginLoader::ReloadValidator validate;
+    if (plugin_info->load_options.validate_signature) {
+        validate = [this, level = plugin_info->load_options.security_level](const std::filesystem::path& path) {
+            QTPLUGIN_TRACE_SCOPE("plugin", "validate_security");
+            return validate_plugin_security(path, level);
+        };
+    }
+
+    auto staged = m_loader->stage_reload(id, plugin_info->file_path, validate);
+    if (!staged) {
+        if (staged.error().code == PluginErrorCode::NotImplemented) {
+            if (QThread::currentThread() == thread()) {
+                return reload_plugin_in_place(plugin_id, preserve_state);
+            }
+            auto result = make_error<void>(PluginErrorCode::StateError,
+                                           "Reload was not delivered to the manager thread: " + id);
+            QMetaObject::invokeMethod(this, [&]() {
+                result = reload_plugin_in_place(id, preserve_state);
+            }, Qt::BlockingQueuedConnection);
+            return result;
+        }
+        return make_error<void>(staged.error().code, "Failed to reload plugin: " + staged.error().message);
+    }
+    auto new_instance = staged.value();
+
+    // The staged instance was created on this thread; QObject plugins are
+    // handed to the manager's thread before anything calls into them, so
+    // their timers and queued slots run on a thread with an event loop
+    if (auto* object = dynamic_cast<QObject*>(new_instance.get()); object && object->thread() != thread()) {
+        object->moveToThread(thread());
+    }
+    if (QThread::currentThread() == thread()) {
+        return activate_reloaded_plugin(id, old_instance, new_instance, preserve_state);
+    }
+
+    auto result = make_error<void>(PluginErrorCode::StateError, "Reload was not delivered to the manager thread: " + id);
+    QMetaObject::invokeMethod(this, [&]() {
+        result = activate_reloaded_plugin(id, old_instance, new_instance, preserve_state);
+    }, Qt::BlockingQueuedConnection);
+    return result;
+}
+
+qtplugin::expected<void, PluginError>
+PluginManager::activate_reloaded_plugin(const std::string& id, const std::shared_ptr<IPlugin>& old_instance,
+                                        const std::shared_ptr<IPlugin>& new_instance, bool preserve_state) {
+    auto plugin_info = plugin_info_view(id);
+    if (!plugin_info) {
+        m_loader->abort_reload(id);
+        return make_error<void>(PluginErrorCode::StateError, "Plugin was unloaded during reload: " + id);
+    }
+
+    // Bring the new build up while the current instance keeps serving
+    PluginLoadOptions options;
+    options.configuration = plugin_info->configuration;
+    options.initialize_immediately = old_instance->state() == PluginState::Running;
+    // Aborting a reload unloads the staged library, which must not happen
+    // under a running initialize()
+    options.timeout = std::chrono::milliseconds::zero();
+    auto init_result = configure_and_initialize(new_instance, id, options, plugin_info->metrics_slot);
+    if (!init_result) {
+        m_loader->abort_reload(id);
+        return make_error<void>(init_result.error().code,
+                               "Failed to initialize reloaded plugin: " + init_result.error().message);
+    }
+
+    // Service interruption: from capturing the old state until the new
+    // instance is published
+    const auto interruption_start = std::chrono::steady_clock::now();
+    if (preserve_state) {
+        transfer_plugin_state(id, *old_instance, *new_instance);
+    }
+    const bool published = update_plugin_info(id, [&](PluginInfo& info) {
+        info.instance = new_instance;
+        info.metadata = new_instance->metadata();
+        info.load_time = std::chrono::system_clock::now();
+        info.last_activity = info.load_time;
+    });
+    const auto interruption = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - interruption_start);
+
+    if (!published) {
+        // Unloaded while the replacement was being prepared
+        new_instance->shutdown();
+        m_loader->abort_reload(id);
+        return make_error<void>(PluginErrorCode::StateError, "Plugin was unloaded during reload: " + id);
+    }
 
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it == m_plugins.end()) {
+    // Retire the old instance once calls that still use it have left
+    m_call_epoch.synchronize();
+    run_on_owner_thread(*old_instance, [&old_instance]() { old_instance->shutdown(); });
+    (void)m_loader->commit_reload(id);
+
+    update_plugin_info(id, [&](PluginInfo& info) {
+        info.metrics["last_reload_interruption_us"] = static_cast<qint64>(interruption.count());
+        info.metrics["reload_count"] = info.metrics["reload_count"].toInt() + 1;
+    });
+    if (interruption > std::chrono::milliseconds(100)) {
+        qCWarning(pluginLog) << "Reload of plugin" << QString::fromStdString(id) << "interrupted service for"
+                            << interruption.count() / 1000 << "ms";
+    }
+
+    emit plugin_reloaded(PluginHandle(id).qid());
+    return make_success();
+}
+
+qtplugin::expected<void, PluginError> PluginManager::reload_plugin_in_place(std::string_view plugin_id,
+                                                                            bool preserve_state) {
+    auto plugin_info = plugin_info_view(plugin_id);
+    if (!plugin_info) {
         return make_error<void>(PluginErrorCode::LoadFailed, "Plugin not found");
     }
 
-    if (!it->second) {
-        return make_error<void>(PluginErrorCode::LoadFailed, "Plugin info is null");
+    // Rejected before the running instance is touched
+    if (plugin_info->load_options.validate_signature) {
+        auto security_result = validate_plugin_security(plugin_info->file_path, plugin_info->load_options.security_level);
+        if (!security_result) {
+            return make_error<void>(security_result.error().code,
+                                   "Failed to reload plugin: " + security_result.error().message);
+        }
     }
 
     // Save state if requested
     QJsonObject saved_state;
-    if (preserve_state && it->second->instance) {
+    if (preserve_state && plugin_info->instance) {
         try {
             // Try to get state from plugin using standard command
-            auto state_result = it->second->instance->execute_command("save_state");
+            auto state_result = plugin_info->instance->execute_command("save_state");
             if (state_result) {
                 saved_state = state_result.value();
             } else {
                 // Fallback: save current configuration as state
-                saved_state = it->second->configuration;
+                saved_state = plugin_info->configuration;
                 saved_state["_fallback_state"] = true;
             }
 
             // Also save plugin metrics and runtime information
             saved_state["_runtime_info"] = QJsonObject{
                 {"load_time", QString::number(std::chrono::duration_cast<std::chrono::milliseconds>(
-                    it->second->load_time.time_since_epoch()).count())},
+                    plugin_info->load_time.time_since_epoch()).count())},
                 {"last_activity", QString::number(std::chrono::duration_cast<std::chrono::milliseconds>(
-                    it->second->last_activity.time_since_epoch()).count())},
-                {"error_count", static_cast<int>(it->second->error_log.size())}
+                    plugin_info->last_activity.time_since_epoch()).count())},
+                {"error_count", static_cast<int>(plugin_info->error_log.size())}
             };
         } catch (...) {
             qCWarning(pluginLog) << "Failed to save state for plugin:"
@@ -736,23 +2052,48 @@ qtplugin::expected<void, PluginError> PluginManager::reload_plugin(std::string_v
         }
     }
 
-    // Unload current plugin
-    if (it->second->instance) {
-        it->second->instance->shutdown();
+    // Unpublish the current instance and wait for calls that still use it
+    // before its library goes away
+    const std::string id(plugin_id);
+    auto old_instance = plugin_info->instance;
+    update_plugin_info(id, [](PluginInfo& info) {
+        info.instance.reset();
+        info.state = PluginState::Reloading;
+    });
+    m_call_epoch.synchronize();
+
+    // A reload that fails leaves the plugin registered in the Error state
+    auto fail = [this, &id](PluginErrorCode code, const std::string& message) {
+        update_plugin_info(id, [&](PluginInfo& info) {
+            info.state = PluginState::Error;
+            info.error_log.push_back(message);
+        });
+        emit plugin_error(PluginHandle(id).qid(), QString::fromStdString(message));
+        return make_error<void>(code, message);
+    };
+
+    if (old_instance) {
+        run_on_owner_thread(*old_instance, [&old_instance]() { old_instance->shutdown(); });
+        old_instance.reset();
+        (void)m_loader->unload(id);
     }
 
     // Reload plugin
-    auto plugin_result = m_loader->load(it->second->file_path);
+    auto plugin_result = m_loader->load(plugin_info->file_path);
     if (!plugin_result) {
-        return make_error<void>(plugin_result.error().code, "Failed to reload plugin");
+        return fail(plugin_result.error().code, "Failed to reload plugin: " + plugin_result.error().message);
     }
+    auto new_instance = plugin_result.value();
 
-    it->second->instance = plugin_result.value();
-
-    // Initialize plugin
-    auto init_result = it->second->instance->initialize();
+    // Initialize plugin; it is published only once it is up
+    if (plugin_info->metrics_slot) {
+        new_instance->attach_metrics(plugin_info->metrics_slot);
+    }
+    auto init_result = new_instance->initialize();
     if (!init_result) {
-        return make_error<void>(init_result.error().code, "Failed to initialize reloaded plugin");
+        new_instance.reset();
+        (void)m_loader->unload(id);
+        return fail(init_result.error().code, "Failed to initialize reloaded plugin: " + init_result.error().message);
     }
 
     // Restore state if requested
@@ -768,20 +2109,20 @@ qtplugin::expected<void, PluginError> PluginManager::reload_plugin(std::string_v
                 config.remove("_fallback_state");
                 config.remove("_runtime_info");
 
-                auto config_result = it->second->instance->configure(config);
+                auto config_result = new_instance->configure(config);
                 if (!config_result) {
                     qCWarning(pluginLog) << "Failed to restore configuration for plugin:"
                                         << QString::fromStdString(std::string(plugin_id));
                 }
             } else {
                 // Try to restore state using standard command
-                auto restore_result = it->second->instance->execute_command("restore_state", saved_state);
+                auto restore_result = new_instance->execute_command("restore_state", saved_state);
                 if (!restore_result) {
                     qCWarning(pluginLog) << "Failed to restore state for plugin:"
                                         << QString::fromStdString(std::string(plugin_id));
 
                     // Fallback: try to restore as configuration
-                    auto config_result = it->second->instance->configure(saved_state);
+                    auto config_result = new_instance->configure(saved_state);
                     if (!config_result) {
                         qCWarning(pluginLog) << "Failed to restore state as configuration for plugin:"
                                             << QString::fromStdString(std::string(plugin_id));
@@ -790,7 +2131,7 @@ qtplugin::expected<void, PluginError> PluginManager::reload_plugin(std::string_v
             }
 
             // Update plugin info with restored state
-            it->second->configuration = saved_state;
+            update_plugin_info(plugin_id, [&](PluginInfo& info) { info.configuration = saved_state; });
 
         } catch (...) {
             qCWarning(pluginLog) << "Exception during state restoration for plugin:"
@@ -798,23 +2139,42 @@ qtplugin::expected<void, PluginError> PluginManager::reload_plugin(std::string_v
         }
     }
 
+    const bool published = update_plugin_info(id, [&](PluginInfo& info) {
+        info.instance = new_instance;
+        info.metadata = new_instance->metadata();
+        info.state = PluginState::Running;
+        info.load_time = std::chrono::system_clock::now();
+        info.last_activity = info.load_time;
+    });
+    if (!published) {
+        // Unloaded while the replacement was being brought up
+        new_instance->shutdown();
+        new_instance.reset();
+        (void)m_loader->unload(id);
+        return make_error<void>(PluginErrorCode::StateError, "Plugin was unloaded during reload: " + id);
+    }
+
+    emit plugin_reloaded(PluginHandle(plugin_id).qid());
     return make_success();
 }
 
 qtplugin::expected<void, PluginError> PluginManager::configure_plugin(std::string_view plugin_id,
                                                                        const QJsonObject& configuration) {
-    std::unique_lock lock(m_plugins_mutex);
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it == m_plugins.end()) {
-        return make_error<void>(PluginErrorCode::StateError, "Plugin not found");
-    }
+    auto epoch_guard = m_call_epoch.enter();
 
     // Store configuration
-    it->second->configuration = configuration;
+    std::shared_ptr<IPlugin> instance;
+    bool found = update_plugin_info(plugin_id, [&](PluginInfo& info) {
+        info.configuration = configuration;
+        instance = info.instance;
+    });
+    if (!found) {
+        return make_error<void>(PluginErrorCode::StateError, "Plugin not found");
+    }
 
     // Apply configuration to plugin if it's loaded
-    if (it->second->instance) {
-        auto result = it->second->instance->configure(configuration);
+    if (instance) {
+        auto result = instance->configure(configuration);
         if (!result) {
             return make_error<void>(result.error().code, "Failed to configure plugin");
         }
@@ -824,63 +2184,319 @@ qtplugin::expected<void, PluginError> PluginManager::configure_plugin(std::strin
 }
 
 QJsonObject PluginManager::plugin_metrics(std::string_view plugin_id) const {
-    std::shared_lock lock(m_plugins_mutex);
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it == m_plugins.end()) {
+    auto plugin_info = plugin_info_view(plugin_id);
+    if (!plugin_info) {
         return QJsonObject();
     }
 
-    return it->second->metrics;
+    // Event metrics recorded on the registry entry, e.g. reload statistics
+    QJsonObject metrics = plugin_info->metrics;
+
+    PluginMetricsSample sample;
+    auto snapshot = m_monitoring_active.load() ? m_metrics_snapshot.load() : nullptr;
+    const PluginMetricsSample* sampled = nullptr;
+    if (snapshot) {
+        auto it = snapshot->plugins.find(plugin_id);
+        sampled = it != snapshot->plugins.end() ? &it->second : nullptr;
+    }
+    if (sampled) {
+        sample = *sampled;
+        metrics["sampled_at"] = static_cast<qint64>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            snapshot->taken_at.time_since_epoch()).count());
+    } else {
+        sample = sample_plugin(*plugin_info, std::chrono::system_clock::now());
+    }
+
+    metrics["uptime_ms"] = sample.uptime_ms;
+    metrics["error_count"] = static_cast<int>(sample.error_count);
+    metrics["command_count"] = static_cast<qint64>(sample.commands);
+    metrics["command_error_count"] = static_cast<qint64>(sample.command_errors);
+    metrics["state"] = static_cast<int>(sample.state);
+    metrics["state_name"] = QString::fromStdString(plugin_state_to_string(sample.state));
+    if (!sample.values.empty()) {
+        QJsonObject values;
+        for (const auto& [name, value] : sample.values) {
+            values[QString::fromStdString(name)] = value;
+        }
+        metrics["plugin_metrics"] = values;
+    }
+    return metrics;
 }
 
 void PluginManager::start_monitoring(std::chrono::milliseconds interval) {
-    if (m_monitoring_active) {
+    if (m_monitoring_active.exchange(true)) {
         return;
     }
 
-    m_monitoring_active = true;
+    m_metrics_sampler.start(interval, [this]() {
+        m_metrics_snapshot.store(take_metrics_snapshot());
+    });
+}
 
-    if (!m_monitoring_timer) {
-        m_monitoring_timer = std::make_unique<QTimer>(this);
-        connect(m_monitoring_timer.get(), &QTimer::timeout, this, &PluginManager::on_monitoring_timer);
+void PluginManager::stop_monitoring() {
+    if (!m_monitoring_active.exchange(false)) {
+        return;
     }
 
-    m_monitoring_timer->start(static_cast<int>(interval.count()));
+    m_metrics_sampler.stop();
 }
 
 std::optional<PluginInfo> PluginManager::get_plugin_info(std::string_view plugin_id) const {
-    std::shared_lock lock(m_plugins_mutex);
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it == m_plugins.end()) {
+    auto plugin_info = plugin_info_view(plugin_id);
+    if (!plugin_info) {
         return std::nullopt;
     }
 
-    // Create a copy without the unique_ptr members
-    PluginInfo info;
-    info.id = it->second->id;
-    info.file_path = it->second->file_path;
-    info.metadata = it->second->metadata;
-    info.state = it->second->state;
-    info.load_time = it->second->load_time;
-    info.last_activity = it->second->last_activity;
-    info.instance = it->second->instance;
-    // Skip loader (unique_ptr)
-    info.configuration = it->second->configuration;
-    info.error_log = it->second->error_log;
-    info.metrics = it->second->metrics;
-    info.hot_reload_enabled = it->second->hot_reload_enabled;
-
-    return info;
+    return *plugin_info;
 }
 
 QJsonObject PluginManager::get_plugin_configuration(std::string_view plugin_id) const {
-    std::shared_lock lock(m_plugins_mutex);
-    auto it = m_plugins.find(std::string(plugin_id));
-    if (it == m_plugins.end()) {
+    auto plugin_info = plugin_info_view(plugin_id);
+    if (!plugin_info) {
         return QJsonObject();
     }
 
-    return it->second->configuration;
+    return plugin_info->configuration;
+}
+
+qtplugin::expected<QJsonObject, PluginError> PluginManager::send_command(std::string_view plugin_id,
+                                                                         std::string_view command,
+                                                                         const QJsonObject& parameters) {
+    // Epoch-guarded read section: unload_plugin() waits for it before shutting down
+    auto epoch_guard = m_call_epoch.enter();
+
+    // The metrics slot exists from registration on, also for lazy plugins
+    auto info = plugin_info_view(plugin_id);
+    std::shared_ptr<IPlugin> plugin = info ? info->instance : nullptr;
+    if (!plugin) {
+        auto activated = activate_plugin(plugin_id);
+        if (!activated) {
+            return qtplugin::unexpected<PluginError>{activated.error()};
+        }
+        plugin = activated.value();
+    }
+
+    auto result = plugin->execute_command(command, parameters);
+    record_command(info.get(), !result);
+    return result;
+}
+
+std::vector<CommandResult> PluginManager::send_commands(std::span<const CommandRequest> requests) {
+    std::vector<std::optional<CommandResult>> collected(requests.size());
+    send_commands(requests, [&collected](std::size_t index, CommandResult result) {
+        collected[index] = std::move(result);
+    });
+
+    std::vector<CommandResult> results;
+    results.reserve(collected.size());
+    for (auto& result : collected) {
+        results.push_back(std::move(*result));
+    }
+    return results;
+}
+
+void PluginManager::send_commands(std::span<const CommandRequest> requests,
+                                  const std::function<void(std::size_t index, CommandResult result)>& on_result) {
+    // One read section covers the workers too: they finish before it ends
+    auto epoch_guard = m_call_epoch.enter();
+
+    // Group request indices by target plugin, in order of first appearance
+    struct PluginBatch {
+        std::string_view plugin_id;
+        std::vector<std::size_t> indices;
+    };
+    std::vector<PluginBatch> batches;
+    StringMap<std::size_t> batch_of_plugin;
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        auto [it, inserted] = batch_of_plugin.try_emplace(requests[i].plugin_id, batches.size());
+        if (inserted) {
+            batches.push_back(PluginBatch{requests[i].plugin_id, {}});
+        }
+        batches[it->second].indices.push_back(i);
+    }
+
+    // Plugins that depend on each other share a lane and run one after another
+    std::vector<std::size_t> lane_of(batches.size());
+    for (std::size_t i = 0; i < lane_of.size(); ++i) {
+        lane_of[i] = i;
+    }
+    auto find_lane = [&lane_of](std::size_t batch) {
+        while (lane_of[batch] != batch) {
+            batch = lane_of[batch] = lane_of[lane_of[batch]];
+        }
+        return batch;
+    };
+    {
+        std::shared_lock lock(m_dependency_mutex);
+        for (std::size_t i = 0; i < batches.size(); ++i) {
+            auto node = m_dependency_graph.find(std::string(batches[i].plugin_id));
+            if (node == m_dependency_graph.end()) {
+                continue;
+            }
+            for (const auto& dependency : node->second.dependencies) {
+                auto other = batch_of_plugin.find(dependency);
+                if (other != batch_of_plugin.end()) {
+                    lane_of[find_lane(i)] = find_lane(other->second);
+                }
+            }
+        }
+    }
+    std::vector<std::vector<std::size_t>> lanes;
+    {
+        std::unordered_map<std::size_t, std::size_t> lane_index;
+        for (std::size_t i = 0; i < batches.size(); ++i) {
+            auto [it, inserted] = lane_index.try_emplace(find_lane(i), lanes.size());
+            if (inserted) {
+                lanes.emplace_back();
+            }
+            lanes[it->second].push_back(i);
+        }
+    }
+
+    std::mutex result_mutex;
+    auto deliver = [&](std::size_t index, CommandResult result) {
+        std::lock_guard lock(result_mutex);
+        on_result(index, std::move(result));
+    };
+
+    auto run_batch = [&](const PluginBatch& batch) {
+        // One registry lookup per plugin for the whole batch
+        auto info = plugin_info_view(batch.plugin_id);
+        std::shared_ptr<IPlugin> plugin = info ? info->instance : nullptr;
+        if (!plugin) {
+            auto activated = activate_plugin(batch.plugin_id);
+            if (!activated) {
+                for (auto index : batch.indices) {
+                    deliver(index, qtplugin::unexpected<PluginError>{activated.error()});
+                }
+                return;
+            }
+            plugin = activated.value();
+        }
+
+        std::vector<CommandCall> calls;
+        calls.reserve(batch.indices.size());
+        for (auto index : batch.indices) {
+            calls.push_back(CommandCall{requests[index].command, requests[index].parameters});
+        }
+
+        std::vector<CommandResult> results;
+        try {
+            results = plugin->execute_commands(calls);
+        } catch (const std::exception& e) {
+            results.clear();
+            results.resize(calls.size(), make_error<QJsonObject>(PluginErrorCode::ExecutionFailed, e.what()));
+        } catch (...) {
+            // Escaping a pool thread would terminate the process
+            results.clear();
+            results.resize(calls.size(),
+                           make_error<QJsonObject>(PluginErrorCode::ExecutionFailed, "Unknown exception in command batch"));
+        }
+        for (std::size_t i = 0; i < batch.indices.size(); ++i) {
+            auto result = i < results.size()
+                ? std::move(results[i])
+                : make_error<QJsonObject>(PluginErrorCode::ExecutionFailed, "Plugin returned too few results");
+            record_command(info.get(), !result);
+            deliver(batch.indices[i], std::move(result));
+        }
+    };
+
+    auto run_lane = [&](const std::vector<std::size_t>& lane) {
+        for (auto batch : lane) {
+            run_batch(batches[batch]);
+        }
+    };
+
+    auto* pool = QThreadPool::globalInstance();
+    const std::size_t worker_count = std::min<std::size_t>(
+        lanes.size(), static_cast<std::size_t>(std::max(1, pool->maxThreadCount())));
+    if (worker_count <= 1) {
+        for (const auto& lane : lanes) {
+            run_lane(lane);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next_lane{0};
+    auto worker = [&]() {
+        for (auto lane = next_lane.fetch_add(1); lane < lanes.size(); lane = next_lane.fetch_add(1)) {
+            run_lane(lanes[lane]);
+        }
+    };
+
+    // Helpers are borrowed from the global pool only while it has idle threads.
+    // The caller works through the lanes as well and then waits only for
+    // helpers that actually started; a helper starting after that returns
+    // without touching this frame.
+    struct Helpers {
+        std::mutex mutex;
+        std::condition_variable idle;
+        std::size_t active = 0;
+        bool closed = false;
+    };
+    auto helpers = std::make_shared<Helpers>();
+    for (std::size_t i = 1; i < worker_count; ++i) {
+        const bool started = pool->tryStart([helpers, &worker]() {
+            {
+                std::lock_guard lock(helpers->mutex);
+                if (helpers->closed) {
+                    return;
+                }
+                ++helpers->active;
+            }
+            worker();
+            std::lock_guard lock(helpers->mutex);
+            if (--helpers->active == 0) {
+                helpers->idle.notify_all();
+            }
+        });
+        if (!started) {
+            break;
+        }
+    }
+    worker();
+
+    std::unique_lock lock(helpers->mutex);
+    helpers->closed = true;
+    helpers->idle.wait(lock, [&helpers] { return helpers->active == 0; });
+}
+
+qtplugin::expected<CommandHandle, PluginError> PluginManager::resolve_command(std::string_view plugin_id,
+                                                                              std::string_view command) {
+    auto epoch_guard = m_call_epoch.enter();
+
+    auto plugin = activate_plugin(plugin_id);
+    if (!plugin) {
+        return qtplugin::unexpected<PluginError>{plugin.error()};
+    }
+
+    auto handle = plugin.value()->resolve_command(command);
+    if (!handle) {
+        return make_error<CommandHandle>(PluginErrorCode::CommandNotFound,
+                                         "No command handle for " + std::string(command));
+    }
+    return *handle;
+}
+
+qtplugin::expected<QCborValue, PluginError> PluginManager::send_command(std::string_view plugin_id,
+                                                                        CommandHandle command,
+                                                                        const QCborValue& parameters) {
+    auto epoch_guard = m_call_epoch.enter();
+
+    // Hot path: one snapshot load and a heterogeneous lookup, no allocation
+    auto info = plugin_info_view(plugin_id);
+    std::shared_ptr<IPlugin> plugin = info ? info->instance : nullptr;
+    if (!plugin) {
+        auto activated = activate_plugin(plugin_id);
+        if (!activated) {
+            return qtplugin::unexpected<PluginError>{activated.error()};
+        }
+        plugin = activated.value();
+    }
+
+    auto result = plugin->invoke_command(command, parameters);
+    record_command(info.get(), !result);
+    return result;
 }
 
 IConfigurationManager& PluginManager::configuration_manager() const {
@@ -905,16 +2521,124 @@ IResourceMonitor& PluginManager::resource_monitor() const {
 
 // === Helper Methods ===
 
+bool PluginManager::update_plugin_info(std::string_view plugin_id,
+                                       const std::function<void(PluginInfo&)>& mutate) {
+    std::lock_guard lock(m_registry_write_mutex);
+
+    auto current = m_registry.load();
+    auto it = current->find(plugin_id);
+    if (it == current->end()) {
+        return false;
+    }
+
+    // Copy-on-write: readers holding the old entry keep seeing it unchanged
+    auto info = std::make_shared<PluginInfo>(*it->second);
+    mutate(*info);
+
+    auto registry = std::make_shared<PluginRegistry>(*current);
+    const PluginInfo* added = info.get();
+    (*registry)[it->first] = std::move(info);
+    publish_registry(std::move(registry), it->second.get(), added);
+    return true;
+}
+
+bool PluginManager::insert_plugin_info(std::shared_ptr<const PluginInfo> info) {
+    std::lock_guard lock(m_registry_write_mutex);
+
+    auto current = m_registry.load();
+    if (current->contains(info->id)) {
+        return false;
+    }
+
+    const std::string plugin_id = info->id;
+    const PluginInfo* added = info.get();
+    auto registry = std::make_shared<PluginRegistry>(*current);
+    registry->emplace(plugin_id, std::move(info));
+    publish_registry(std::move(registry), nullptr, added);
+    return true;
+}
+
+std::shared_ptr<const PluginInfo> PluginManager::remove_plugin_info(std::string_view plugin_id) {
+    std::lock_guard lock(m_registry_write_mutex);
+
+    auto current = m_registry.load();
+    auto it = current->find(plugin_id);
+    if (it == current->end()) {
+        return nullptr;
+    }
+
+    auto removed = it->second;
+    auto registry = std::make_shared<PluginRegistry>(*current);
+    registry->erase(it->first);
+    publish_registry(std::move(registry), removed.get(), nullptr);
+    return removed;
+}
+
+void PluginManager::publish_registry(std::shared_ptr<const PluginRegistry> registry,
+                                     const PluginInfo* removed, const PluginInfo* added) {
+    // Called with m_registry_write_mutex held; only the entry that changed is accounted
+    auto stats = std::make_shared<RegistryStats>(*m_registry_stats.load());
+    const auto account = [&](const PluginInfo& info, int sign) {
+        stats->state_counts[static_cast<std::size_t>(info.state)] += sign;
+        stats->total += sign;
+        stats->error_count += sign * static_cast<qint64>(info.error_log.size());
+        stats->estimated_memory_bytes += sign * static_cast<qint64>(estimated_memory_bytes(info));
+        if (info.instance) {
+            if (sign > 0) {
+                m_load_times.insert(info.load_time);
+            } else if (auto it = m_load_times.find(info.load_time); it != m_load_times.end()) {
+                m_load_times.erase(it);
+            }
+        }
+    };
+    if (removed) {
+        account(*removed, -1);
+    }
+    if (added) {
+        account(*added, 1);
+    }
+    stats->earliest_load_time = m_load_times.empty()
+        ? std::nullopt
+        : std::optional<std::chrono::system_clock::time_point>(*m_load_times.begin());
+
+    m_registry.store(std::move(registry));
+    m_registry_stats.store(std::move(stats));
+}
+
+void PluginManager::record_command(const PluginInfo* info, bool failed) {
+    m_command_count.fetch_add(1, std::memory_order_relaxed);
+    if (failed) {
+        m_command_error_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!info || !info->metrics_slot) {
+        return;
+    }
+    info->metrics_slot->record_command(failed);
+
+    if (info->metrics_slot->mark_used()) {
+        // Without an instance when the command started, it waited for activation
+        PluginFirstUse first_use{info->id, 0};
+        if (!info->instance) {
+            if (auto current = plugin_info_view(info->id)) {
+                first_use.latency_us = current->metrics["activation_latency_us"].toInteger();
+            }
+        }
+        std::lock_guard lock(m_usage_mutex);
+        m_first_uses.push_back(std::move(first_use));
+    }
+}
+
 int PluginManager::calculate_dependency_level(const std::string& plugin_id,
                                             const std::vector<std::string>& dependencies) const {
     if (dependencies.empty()) {
         return 0;
     }
 
+    auto registry = registry_snapshot();
     int max_level = 0;
     for (const auto& dep : dependencies) {
-        auto it = m_plugins.find(dep);
-        if (it != m_plugins.end() && it->second) {
+        auto it = registry->find(dep);
+        if (it != registry->end() && it->second) {
             int dep_level = calculate_dependency_level(dep, it->second->metadata.dependencies);
             max_level = std::max(max_level, dep_level + 1);
         }
@@ -971,6 +2695,7 @@ std::string PluginManager::plugin_state_to_string(PluginState state) const {
         case PluginState::Running: return "Running";
         case PluginState::Stopping: return "Stopping";
         case PluginState::Error: return "Error";
+        case PluginState::Discovered: return "Discovered";
         default: return "Unknown";
     }
 }
@@ -0,0 +1,208 @@
+/**
+ * @file plugin_metadata_reader.cpp
+ * @brief Implementation of the Qt plugin metadata reader
+ * @version 3.0.0
+ */
+
+#include "qtplugin/core/plugin_metadata_reader.hpp"
+#include "qtplugin/utils/trace.hpp"
+#include <QCborMap>
+#include <QCborValue>
+#include <QFile>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+namespace qtplugin {
+
+namespace {
+
+// Upper bound for the section header table; real plugins are far below
+constexpr std::uint64_t max_section_count = 4096;
+
+// Layout written by moc: magic string, four header bytes, then a CBOR map
+constexpr std::string_view metadata_magic{"QTMETADATA !", 12};
+constexpr std::size_t metadata_header_size = 4;
+
+// CBOR keys of the metadata map, as in QtPluginMetaDataKeys
+enum class MetaDataKey : qint64 {
+    QtVersion = 0,
+    Requirements = 1,
+    IID = 2,
+    ClassName = 3,
+    MetaData = 4,
+    URI = 5
+};
+
+std::uint64_t read_uint(const char* data, std::size_t size, bool big_endian) {
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        const auto byte = static_cast<std::uint64_t>(static_cast<unsigned char>(data[big_endian ? i : size - 1 - i]));
+        value = (value << 8) | byte;
+    }
+    return value;
+}
+
+bool in_bounds(std::span<const char> image, std::uint64_t offset, std::uint64_t size) {
+    return offset <= image.size() && size <= image.size() - offset;
+}
+
+std::optional<std::span<const char>> find_magic(std::span<const char> haystack) {
+    const auto it = std::search(haystack.begin(), haystack.end(),
+                                std::boyer_moore_horspool_searcher(metadata_magic.begin(), metadata_magic.end()));
+    if (it == haystack.end()) {
+        return std::nullopt;
+    }
+    return haystack.subspan(static_cast<std::size_t>(it - haystack.begin()));
+}
+
+} // namespace
+
+std::optional<std::span<const char>> find_elf_section(std::span<const char> image, std::string_view name) {
+    if (image.size() < 64 || std::memcmp(image.data(), "\x7f" "ELF", 4) != 0) {
+        return std::nullopt;
+    }
+
+    const char* header = image.data();
+    const bool is_64 = header[4] == 2;
+    const bool big_endian = header[5] == 2;
+    if ((header[4] != 1 && !is_64) || (header[5] != 1 && !big_endian)) {
+        return std::nullopt;
+    }
+
+    const std::uint64_t section_offset = is_64 ? read_uint(&header[0x28], 8, big_endian)
+                                               : read_uint(&header[0x20], 4, big_endian);
+    const std::uint64_t entry_size = read_uint(&header[is_64 ? 0x3A : 0x2E], 2, big_endian);
+    const std::uint64_t section_count = read_uint(&header[is_64 ? 0x3C : 0x30], 2, big_endian);
+    const std::uint64_t names_index = read_uint(&header[is_64 ? 0x3E : 0x32], 2, big_endian);
+    const std::uint64_t min_entry_size = is_64 ? 0x28 : 0x18;
+    if (section_offset == 0 || section_count == 0 || section_count > max_section_count ||
+        entry_size < min_entry_size || names_index >= section_count ||
+        !in_bounds(image, section_offset, entry_size * section_count)) {
+        return std::nullopt;
+    }
+
+    const char* sections = image.data() + section_offset;
+    auto section_range = [&](std::uint64_t index) {
+        const char* entry = sections + index * entry_size;
+        const std::uint64_t offset = is_64 ? read_uint(entry + 0x18, 8, big_endian)
+                                           : read_uint(entry + 0x10, 4, big_endian);
+        const std::uint64_t size = is_64 ? read_uint(entry + 0x20, 8, big_endian)
+                                         : read_uint(entry + 0x14, 4, big_endian);
+        return std::pair{offset, size};
+    };
+
+    const auto [names_offset, names_size] = section_range(names_index);
+    if (names_size == 0 || !in_bounds(image, names_offset, names_size)) {
+        return std::nullopt;
+    }
+    const std::string_view names(image.data() + names_offset, static_cast<std::size_t>(names_size));
+
+    for (std::uint64_t i = 0; i < section_count; ++i) {
+        const std::uint64_t name_offset = read_uint(sections + i * entry_size, 4, big_endian);
+        if (name_offset >= names.size()) {
+            continue;
+        }
+        const auto candidate = names.substr(static_cast<std::size_t>(name_offset));
+        if (candidate.substr(0, candidate.find('\0')) != name) {
+            continue;
+        }
+
+        const auto [offset, size] = section_range(i);
+        if (!in_bounds(image, offset, size)) {
+            return std::nullopt;
+        }
+        return image.subspan(static_cast<std::size_t>(offset), static_cast<std::size_t>(size));
+    }
+    return std::nullopt;
+}
+
+std::optional<std::span<const char>> find_qt_plugin_metadata(std::span<const char> image) {
+    if (auto section = find_elf_section(image, ".qtmetadata")) {
+        return find_magic(*section);
+    }
+    return find_magic(image.first(std::min(image.size(), metadata_scan_limit)));
+}
+
+qtplugin::expected<QJsonObject, PluginError> decode_qt_plugin_metadata(std::span<const char> blob) {
+    const std::size_t payload_offset = metadata_magic.size() + metadata_header_size;
+    if (blob.size() <= payload_offset ||
+        std::string_view(blob.data(), metadata_magic.size()) != metadata_magic) {
+        return make_error<QJsonObject>(PluginErrorCode::InvalidFormat, "Truncated plugin metadata");
+    }
+
+    const auto* header = reinterpret_cast<const quint8*>(blob.data() + metadata_magic.size());
+    if (header[0] != 0) {
+        return make_error<QJsonObject>(PluginErrorCode::InvalidFormat,
+                                       "Unsupported plugin metadata version " + std::to_string(header[0]));
+    }
+
+    QCborParserError parse_error;
+    const auto value = QCborValue::fromCbor(blob.data() + payload_offset,
+                                            static_cast<qsizetype>(blob.size() - payload_offset), &parse_error);
+    if (parse_error.error != QCborError::NoError || !value.isMap()) {
+        return make_error<QJsonObject>(PluginErrorCode::InvalidFormat,
+                                       "Invalid plugin metadata: " + parse_error.errorString().toStdString());
+    }
+
+    // Same keys as QPluginLoader::metaData(); the Qt version and build
+    // requirements come from the header bytes
+    QJsonObject metadata;
+    metadata["version"] = (int(header[1]) << 16) | (int(header[2]) << 8);
+    metadata["debug"] = (header[3] & 0x80) != 0;
+    metadata["archlevel"] = int(header[3] & 0x7F);
+
+    const auto map = value.toMap();
+    for (auto it = map.constBegin(); it != map.constEnd(); ++it) {
+        switch (static_cast<MetaDataKey>(it.key().toInteger())) {
+        case MetaDataKey::IID:
+            metadata["IID"] = it.value().toString();
+            break;
+        case MetaDataKey::ClassName:
+            metadata["className"] = it.value().toString();
+            break;
+        case MetaDataKey::MetaData:
+            metadata["MetaData"] = it.value().toJsonValue();
+            break;
+        case MetaDataKey::URI:
+            metadata["URI"] = it.value().toString();
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (!metadata.contains("IID")) {
+        return make_error<QJsonObject>(PluginErrorCode::InvalidFormat, "Plugin metadata has no IID");
+    }
+    return metadata;
+}
+
+qtplugin::expected<QJsonObject, PluginError> read_qt_plugin_metadata(const std::filesystem::path& file_path) {
+    QTPLUGIN_TRACE_SCOPE("loader", "read_qt_plugin_metadata", file_path);
+
+    QFile file(QString::fromStdString(file_path.string()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return make_error<QJsonObject>(PluginErrorCode::FileNotFound, "Cannot open plugin file: " + file_path.string());
+    }
+    const qint64 size = file.size();
+    if (size <= 0) {
+        return make_error<QJsonObject>(PluginErrorCode::InvalidFormat, "Empty plugin file: " + file_path.string());
+    }
+
+    // Unmapped when the file is closed
+    const uchar* data = file.map(0, size);
+    if (!data) {
+        return make_error<QJsonObject>(PluginErrorCode::FileSystemError, "Cannot map plugin file: " + file_path.string());
+    }
+
+    const std::span<const char> image(reinterpret_cast<const char*>(data), static_cast<std::size_t>(size));
+    auto blob = find_qt_plugin_metadata(image);
+    if (!blob) {
+        return make_error<QJsonObject>(PluginErrorCode::InvalidFormat, "No metadata found in plugin file");
+    }
+    return decode_qt_plugin_metadata(*blob);
+}
+
+} // namespace qtplugin
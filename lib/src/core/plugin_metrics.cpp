@@ -0,0 +1,70 @@
+/**
+ * @file plugin_metrics.cpp
+ * @brief Implementation of plugin metric slots and the background sampler
+ * @version 3.0.0
+ */
+
+#include "qtplugin/core/plugin_metrics.hpp"
+
+namespace qtplugin {
+
+std::optional<std::size_t> PluginMetricsSlot::register_metric(std::string_view name) {
+    std::lock_guard lock(m_register_mutex);
+    const auto count = m_size.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (m_names[i] == name) {
+            return i;
+        }
+    }
+    if (count == capacity) {
+        return std::nullopt;
+    }
+
+    // Publish the name before the index becomes visible to readers
+    m_names[count].assign(name);
+    m_values[count].store(0.0, std::memory_order_relaxed);
+    m_size.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+MetricsSampler::~MetricsSampler() {
+    stop();
+}
+
+bool MetricsSampler::start(std::chrono::milliseconds interval, std::function<void()> sample) {
+    std::lock_guard control_lock(m_control_mutex);
+    std::lock_guard lock(m_mutex);
+    if (m_thread.joinable()) {
+        return false;
+    }
+
+    m_stop_requested = false;
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread([this, interval, sample = std::move(sample)]() {
+        std::unique_lock lock(m_mutex);
+        while (!m_stop_requested) {
+            lock.unlock();
+            sample();
+            lock.lock();
+            m_wakeup.wait_for(lock, interval, [this] { return m_stop_requested; });
+        }
+    });
+    return true;
+}
+
+void MetricsSampler::stop() {
+    std::lock_guard control_lock(m_control_mutex);
+    std::thread thread;
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop_requested = true;
+        thread = std::move(m_thread);
+    }
+    m_wakeup.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+    m_running.store(false, std::memory_order_release);
+}
+
+} // namespace qtplugin
@@ -0,0 +1,122 @@
+/**
+ * @file plugin_usage_profile.cpp
+ * @brief Implementation of the persisted plugin usage profile
+ * @version 3.0.0
+ */
+
+#include "qtplugin/core/plugin_usage_profile.hpp"
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QFile>
+#include <algorithm>
+
+namespace qtplugin {
+
+void PluginUsageProfile::record_run(std::span<const PluginFirstUse> first_uses) {
+    ++m_runs;
+    for (auto& [plugin_id, record] : m_records) {
+        record.usage_score *= decay;
+    }
+
+    for (std::size_t position = 0; position < first_uses.size(); ++position) {
+        const auto& use = first_uses[position];
+        auto& record = m_records[use.plugin_id];
+        record.usage_score += 1.0 - decay;
+        record.first_use_rank = record.runs_used == 0
+            ? static_cast<double>(position)
+            : decay * record.first_use_rank + (1.0 - decay) * static_cast<double>(position);
+        record.first_use_latency_us = use.latency_us;
+        ++record.runs_used;
+    }
+
+    std::erase_if(m_records, [](const auto& entry) { return entry.second.usage_score < forget_below; });
+}
+
+std::vector<std::string> PluginUsageProfile::hot_set(double min_score) const {
+    std::vector<std::pair<double, std::string>> ranked;
+    for (const auto& [plugin_id, record] : m_records) {
+        if (record.usage_score >= min_score) {
+            ranked.emplace_back(record.first_use_rank, plugin_id);
+        }
+    }
+    std::sort(ranked.begin(), ranked.end());
+
+    std::vector<std::string> plugin_ids;
+    plugin_ids.reserve(ranked.size());
+    for (auto& [rank, plugin_id] : ranked) {
+        plugin_ids.push_back(std::move(plugin_id));
+    }
+    return plugin_ids;
+}
+
+const PluginUsageRecord* PluginUsageProfile::find(std::string_view plugin_id) const {
+    auto it = m_records.find(plugin_id);
+    return it != m_records.end() ? &it->second : nullptr;
+}
+
+qtplugin::expected<PluginUsageProfile, PluginError> PluginUsageProfile::load(const std::filesystem::path& file_path) {
+    QFile file(QString::fromStdString(file_path.string()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return make_error<PluginUsageProfile>(PluginErrorCode::FileNotFound,
+                                              "Cannot open usage profile: " + file_path.string());
+    }
+
+    QJsonParseError parse_error;
+    const auto document = QJsonDocument::fromJson(file.readAll(), &parse_error);
+    if (parse_error.error != QJsonParseError::NoError || !document.isObject()) {
+        return make_error<PluginUsageProfile>(PluginErrorCode::InvalidFormat,
+                                              "Invalid usage profile: " + parse_error.errorString().toStdString());
+    }
+
+    const auto root = document.object();
+    if (root["version"].toInt() != format_version) {
+        return make_error<PluginUsageProfile>(PluginErrorCode::InvalidFormat,
+                                              "Unsupported usage profile version: " + file_path.string());
+    }
+
+    PluginUsageProfile profile;
+    profile.m_runs = static_cast<std::uint64_t>(root["runs"].toInteger());
+    const auto plugins = root["plugins"].toObject();
+    for (auto it = plugins.begin(); it != plugins.end(); ++it) {
+        const auto item = it.value().toObject();
+        PluginUsageRecord record;
+        record.usage_score = item["score"].toDouble();
+        record.first_use_rank = item["rank"].toDouble();
+        record.first_use_latency_us = item["latency_us"].toInteger();
+        record.runs_used = static_cast<std::uint64_t>(item["runs_used"].toInteger());
+        profile.m_records.insert_or_assign(it.key().toStdString(), record);
+    }
+    return profile;
+}
+
+qtplugin::expected<void, PluginError> PluginUsageProfile::save(const std::filesystem::path& file_path) const {
+    QJsonObject plugins;
+    for (const auto& [plugin_id, record] : m_records) {
+        plugins[QString::fromStdString(plugin_id)] = QJsonObject{
+            {"score", record.usage_score},
+            {"rank", record.first_use_rank},
+            {"latency_us", static_cast<qint64>(record.first_use_latency_us)},
+            {"runs_used", static_cast<qint64>(record.runs_used)}
+        };
+    }
+
+    QJsonObject root;
+    root["version"] = format_version;
+    root["runs"] = static_cast<qint64>(m_runs);
+    root["plugins"] = plugins;
+
+    QSaveFile file(QString::fromStdString(file_path.string()));
+    if (!file.open(QIODevice::WriteOnly)) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                               "Cannot write usage profile: " + file_path.string());
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                               "Cannot write usage profile: " + file_path.string());
+    }
+    return make_success();
+}
+
+} // namespace qtplugin
@@ -0,0 +1,49 @@
+/**
+ * @file static_plugin_registry.cpp
+ * @brief Implementation of the static plugin registry
+ * @version 3.0.0
+ */
+
+#include "qtplugin/core/static_plugin_registry.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace qtplugin {
+
+namespace {
+
+// Constant-initialized, so registrars in other translation units can run first
+constinit std::atomic<StaticPluginTableNode*> g_static_plugin_tables{nullptr};
+
+} // namespace
+
+PluginMetadata StaticPluginInfo::metadata() const {
+    PluginMetadata meta;
+    meta.name = std::string(name);
+    meta.description = std::string(description);
+    meta.author = std::string(author);
+    meta.version = Version(version[0], version[1], version[2]);
+    meta.dependencies.assign(dependencies.begin(), dependencies.end());
+    return meta;
+}
+
+StaticPluginRegistrar::StaticPluginRegistrar(StaticPluginTableNode& node) noexcept {
+    node.next = g_static_plugin_tables.load(std::memory_order_relaxed);
+    while (!g_static_plugin_tables.compare_exchange_weak(node.next, &node, std::memory_order_release,
+                                                         std::memory_order_relaxed)) {
+    }
+}
+
+std::vector<const StaticPluginEntry*> registered_static_plugins() {
+    std::vector<const StaticPluginEntry*> entries;
+    for (auto* node = g_static_plugin_tables.load(std::memory_order_acquire); node; node = node->next) {
+        for (const auto& entry : node->entries) {
+            entries.push_back(&entry);
+        }
+    }
+    // The list is built newest first
+    std::reverse(entries.begin(), entries.end());
+    return entries;
+}
+
+} // namespace qtplugin
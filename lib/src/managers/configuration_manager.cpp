@@ -9,10 +9,12 @@
 #include <QJsonParseError>
 #include <QJsonArray>
 #include <QFile>
+#include <QSaveFile>
 #include <QDir>
 #include <QStandardPaths>
 #include <QLoggingCategory>
 #include <QRegularExpression>
+#include <QThread>
 #include <random>
 #include <mutex>
 
@@ -21,17 +23,20 @@ Q_LOGGING_CATEGORY(configLog, "qtplugin.configuration")
 namespace qtplugin {
 
 ConfigurationManager::ConfigurationManager(QObject* parent)
-    : QObject(parent) {
+    : QObject(parent)
+    , m_persister([this](ConfigurationScope scope, const std::string& plugin_id) { write_scope(scope, plugin_id); }) {
     qCDebug(configLog) << "Configuration manager initialized";
     
     // Initialize global configurations
     for (auto scope : {ConfigurationScope::Global, ConfigurationScope::User, ConfigurationScope::Session}) {
         m_global_configs[scope] = std::make_unique<ConfigurationData>();
     }
+    publish_directory();
 }
 
 ConfigurationManager::~ConfigurationManager() {
-    // Save any dirty configurations
+    // Write what the persister still holds, then any other dirty configurations
+    m_persister.stop();
     if (m_auto_persist.load()) {
         for (const auto& [scope, config] : m_global_configs) {
             if (config && config->is_dirty) {
@@ -51,26 +56,84 @@ ConfigurationManager::~ConfigurationManager() {
     qCDebug(configLog) << "Configuration manager destroyed";
 }
 
+ConfigKey::ConfigKey(std::string_view key) : m_key(key) {
+    std::size_t start = 0;
+    for (;;) {
+        const std::size_t end = key.find('.', start);
+        m_segments.emplace_back(key.substr(start, end == std::string_view::npos ? end : end - start));
+        if (end == std::string_view::npos) {
+            break;
+        }
+        start = end + 1;
+    }
+}
+
+qtplugin::expected<QJsonValue, PluginError>
+ConfigurationSnapshot::get_value(std::string_view key) const {
+    auto value = m_tree.value(key);
+    if (value.isUndefined()) {
+        return make_error<QJsonValue>(PluginErrorCode::ConfigurationError,
+                                     std::format("Configuration key '{}' not found", key));
+    }
+    return value;
+}
+
+qtplugin::expected<QJsonValue, PluginError>
+ConfigurationSnapshot::get_value(const ConfigKey& key) const {
+    auto value = m_tree.value(key.segments());
+    if (value.isUndefined()) {
+        return make_error<QJsonValue>(PluginErrorCode::ConfigurationError,
+                                     std::format("Configuration key '{}' not found", key.str()));
+    }
+    return value;
+}
+
+QJsonValue ConfigurationSnapshot::get_value_or_default(std::string_view key, const QJsonValue& default_value) const {
+    auto value = m_tree.value(key);
+    return value.isUndefined() ? default_value : value;
+}
+
+QJsonValue ConfigurationSnapshot::get_value_or_default(const ConfigKey& key, const QJsonValue& default_value) const {
+    auto value = m_tree.value(key.segments());
+    return value.isUndefined() ? default_value : value;
+}
+
 qtplugin::expected<QJsonValue, PluginError>
 ConfigurationManager::get_value(std::string_view key, ConfigurationScope scope,
                                std::string_view plugin_id) const {
-    const_cast<std::atomic<size_t>&>(m_access_count).fetch_add(1);
+    const_cast<std::atomic<size_t>&>(m_access_count).fetch_add(1, std::memory_order_relaxed);
     
-    auto* config = get_config_data(scope, plugin_id);
-    if (!config) {
+    const auto snapshot = current_snapshot(scope, plugin_id);
+    if (!snapshot) {
         return make_error<QJsonValue>(PluginErrorCode::ConfigurationError,
                                      "Configuration not found for scope");
     }
     
-    std::shared_lock lock(config->mutex);
-    auto value = get_nested_value(config->data, key);
-    
-    if (value.isUndefined()) {
+    return snapshot->get_value(key);
+}
+
+qtplugin::expected<QJsonValue, PluginError>
+ConfigurationManager::get_value(const ConfigKey& key, ConfigurationScope scope,
+                               std::string_view plugin_id) const {
+    const_cast<std::atomic<size_t>&>(m_access_count).fetch_add(1, std::memory_order_relaxed);
+
+    const auto snapshot = current_snapshot(scope, plugin_id);
+    if (!snapshot) {
         return make_error<QJsonValue>(PluginErrorCode::ConfigurationError,
-                                     std::format("Configuration key '{}' not found", key));
+                                     "Configuration not found for scope");
     }
-    
-    return value;
+
+    return snapshot->get_value(key);
+}
+
+qtplugin::expected<std::shared_ptr<const ConfigurationSnapshot>, PluginError>
+ConfigurationManager::snapshot(ConfigurationScope scope, std::string_view plugin_id) const {
+    auto snapshot = current_snapshot(scope, plugin_id);
+    if (!snapshot) {
+        return make_error<std::shared_ptr<const ConfigurationSnapshot>>(PluginErrorCode::ConfigurationError,
+                                                                        "Configuration not found for scope");
+    }
+    return snapshot;
 }
 
 QJsonValue ConfigurationManager::get_value_or_default(std::string_view key, const QJsonValue& default_value,
@@ -82,6 +145,16 @@ QJsonValue ConfigurationManager::get_value_or_default(std::string_view key, cons
 qtplugin::expected<void, PluginError>
 ConfigurationManager::set_value(std::string_view key, const QJsonValue& value,
                                ConfigurationScope scope, std::string_view plugin_id) {
+    return set_value(ConfigKey(key), value, scope, plugin_id);
+}
+
+qtplugin::expected<void, PluginError>
+ConfigurationManager::set_value(const ConfigKey& key, const QJsonValue& value,
+                               ConfigurationScope scope, std::string_view plugin_id) {
+    if (key.empty()) {
+        return make_error<void>(PluginErrorCode::InvalidArgument, "Empty configuration key");
+    }
+
     auto* config = get_or_create_config_data(scope, plugin_id);
     if (!config) {
         return make_error<void>(PluginErrorCode::ConfigurationError,
@@ -91,20 +164,18 @@ ConfigurationManager::set_value(std::string_view key, const QJsonValue& value,
     QJsonValue old_value;
     {
         std::unique_lock lock(config->mutex);
-        old_value = get_nested_value(config->data, key);
-        
-        if (!set_nested_value(config->data, key, value)) {
-            return make_error<void>(PluginErrorCode::ConfigurationError,
-                                   std::format("Failed to set configuration key '{}'", key));
-        }
-        
-        config->is_dirty = true;
+        const auto current = config->current.load();
+        old_value = current->tree().value(key.segments());
+
+        ConfigurationTree next = current->tree();
+        next.set(key.segments(), value);
+        publish_version(*config, std::move(next));
     }
     
     // Notify change
     ConfigurationChangeEvent event(
         old_value.isUndefined() ? ConfigurationChangeType::Added : ConfigurationChangeType::Modified,
-        key, old_value, value, scope, plugin_id
+        key.str(), old_value, value, scope, plugin_id
     );
     notify_change(event);
     
@@ -129,19 +200,21 @@ ConfigurationManager::remove_key(std::string_view key, ConfigurationScope scope,
     QJsonValue old_value;
     {
         std::unique_lock lock(config->mutex);
-        old_value = get_nested_value(config->data, key);
+        const auto current = config->current.load();
+        old_value = current->tree().value(key);
 
         if (old_value.isUndefined()) {
             return make_error<void>(PluginErrorCode::ConfigurationError,
                                    std::format("Configuration key '{}' not found", key));
         }
 
-        if (!remove_nested_key(config->data, key)) {
+        ConfigurationTree next = current->tree();
+        if (!next.remove(key)) {
             return make_error<void>(PluginErrorCode::ConfigurationError,
                                    std::format("Failed to remove configuration key '{}'", key));
         }
 
-        config->is_dirty = true;
+        publish_version(*config, std::move(next));
     }
 
     // Notify change
@@ -159,25 +232,19 @@ ConfigurationManager::remove_key(std::string_view key, ConfigurationScope scope,
 }
 
 bool ConfigurationManager::has_key(std::string_view key, ConfigurationScope scope, std::string_view plugin_id) const {
-    auto* config = get_config_data(scope, plugin_id);
-    if (!config) {
-        return false;
-    }
-
-    std::shared_lock lock(config->mutex);
-    return !get_nested_value(config->data, key).isUndefined();
+    const auto snapshot = current_snapshot(scope, plugin_id);
+    return snapshot && snapshot->has_key(key);
 }
 
 qtplugin::expected<QJsonObject, PluginError>
 ConfigurationManager::get_configuration(ConfigurationScope scope, std::string_view plugin_id) const {
-    auto* config = get_config_data(scope, plugin_id);
-    if (!config) {
+    const auto snapshot = current_snapshot(scope, plugin_id);
+    if (!snapshot) {
         return make_error<QJsonObject>(PluginErrorCode::ConfigurationError,
                                       "Configuration not found for scope");
     }
 
-    std::shared_lock lock(config->mutex);
-    return config->data;
+    return snapshot->to_json();
 }
 
 qtplugin::expected<void, PluginError>
@@ -192,18 +259,17 @@ ConfigurationManager::set_configuration(const QJsonObject& configuration, Config
     QJsonObject old_config;
     {
         std::unique_lock lock(config->mutex);
-        old_config = config->data;
+        const auto current = config->current.load();
+        old_config = current->to_json();
 
+        ConfigurationTree next = current->tree();
         if (merge) {
-            // Merge configurations
-            for (auto it = configuration.begin(); it != configuration.end(); ++it) {
-                config->data[it.key()] = it.value();
-            }
+            next.merge(configuration);
         } else {
-            config->data = configuration;
+            next.assign(configuration);
         }
 
-        config->is_dirty = true;
+        publish_version(*config, std::move(next));
     }
 
     // Notify change
@@ -232,9 +298,8 @@ ConfigurationManager::clear_configuration(ConfigurationScope scope, std::string_
     QJsonObject old_config;
     {
         std::unique_lock lock(config->mutex);
-        old_config = config->data;
-        config->data = QJsonObject();
-        config->is_dirty = true;
+        old_config = config->current.load()->to_json();
+        publish_version(*config, ConfigurationTree());
     }
 
     // Notify change
@@ -259,47 +324,60 @@ ConfigurationManager::get_config_data(ConfigurationScope scope, std::string_view
         return nullptr;
     }
 
+    const auto directory = m_directory.load();
     if (scope == ConfigurationScope::Plugin) {
-        std::shared_lock lock(m_global_mutex);
-        auto plugin_it = m_plugin_configs.find(std::string(plugin_id));
-        if (plugin_it != m_plugin_configs.end()) {
-            auto scope_it = plugin_it->second.find(scope);
-            if (scope_it != plugin_it->second.end()) {
-                return scope_it->second.get();
-            }
-        }
-        return nullptr;
+        auto it = directory->plugins.find(plugin_id);
+        return (it != directory->plugins.end()) ? it->second : nullptr;
     } else {
-        std::shared_lock lock(m_global_mutex);
-        auto it = m_global_configs.find(scope);
-        return (it != m_global_configs.end()) ? it->second.get() : nullptr;
+        auto it = directory->scopes.find(scope);
+        return (it != directory->scopes.end()) ? it->second : nullptr;
     }
 }
 
 ConfigurationManager::ConfigurationData*
 ConfigurationManager::get_or_create_config_data(ConfigurationScope scope, std::string_view plugin_id) {
+    if (auto* config = get_config_data(scope, plugin_id)) {
+        return config;
+    }
     if (scope == ConfigurationScope::Plugin && plugin_id.empty()) {
         return nullptr;
     }
 
-    if (scope == ConfigurationScope::Plugin) {
-        std::unique_lock lock(m_global_mutex);
-        auto& plugin_configs = m_plugin_configs[std::string(plugin_id)];
-        auto& config = plugin_configs[scope];
-        if (!config) {
-            config = std::make_unique<ConfigurationData>();
-            config->file_path = get_default_config_path(scope, plugin_id);
-        }
-        return config.get();
-    } else {
-        std::unique_lock lock(m_global_mutex);
-        auto& config = m_global_configs[scope];
-        if (!config) {
-            config = std::make_unique<ConfigurationData>();
-            config->file_path = get_default_config_path(scope, plugin_id);
+    std::unique_lock lock(m_global_mutex);
+    auto& config = (scope == ConfigurationScope::Plugin) ? m_plugin_configs[std::string(plugin_id)][scope]
+                                                         : m_global_configs[scope];
+    if (!config) {
+        config = std::make_unique<ConfigurationData>();
+        config->file_path = get_default_config_path(scope, plugin_id);
+        publish_directory();
+    }
+    return config.get();
+}
+
+void ConfigurationManager::publish_directory() {
+    auto directory = std::make_shared<ConfigurationDirectory>();
+    for (const auto& [scope, config] : m_global_configs) {
+        directory->scopes.emplace(scope, config.get());
+    }
+    for (const auto& [plugin_id, plugin_configs] : m_plugin_configs) {
+        auto it = plugin_configs.find(ConfigurationScope::Plugin);
+        if (it != plugin_configs.end()) {
+            directory->plugins.emplace(plugin_id, it->second.get());
         }
-        return config.get();
     }
+    m_directory.store(std::move(directory));
+}
+
+std::shared_ptr<const ConfigurationSnapshot>
+ConfigurationManager::current_snapshot(ConfigurationScope scope, std::string_view plugin_id) const {
+    auto* config = get_config_data(scope, plugin_id);
+    return config ? config->current.load() : nullptr;
+}
+
+void ConfigurationManager::publish_version(ConfigurationData& config, ConfigurationTree tree) {
+    const auto version = config.current.load(std::memory_order_relaxed)->version() + 1;
+    config.current.store(std::make_shared<const ConfigurationSnapshot>(std::move(tree), version));
+    config.is_dirty = true;
 }
 
 std::string ConfigurationManager::generate_subscription_id() const {
@@ -315,63 +393,6 @@ std::string ConfigurationManager::generate_subscription_id() const {
     return id;
 }
 
-QJsonValue ConfigurationManager::get_nested_value(const QJsonObject& obj, std::string_view key) const {
-    if (key.find('.') == std::string_view::npos) {
-        return obj.value(QString::fromUtf8(key.data(), key.size()));
-    }
-
-    // Handle nested keys
-    QJsonObject current = obj;
-    std::string key_str(key);
-    size_t start = 0;
-    size_t pos = 0;
-
-    while ((pos = key_str.find('.', start)) != std::string::npos) {
-        std::string part = key_str.substr(start, pos - start);
-        QJsonValue value = current.value(QString::fromStdString(part));
-        if (!value.isObject()) {
-            return QJsonValue();
-        }
-        current = value.toObject();
-        start = pos + 1;
-    }
-
-    std::string final_part = key_str.substr(start);
-    return current.value(QString::fromStdString(final_part));
-}
-
-bool ConfigurationManager::set_nested_value(QJsonObject& obj, std::string_view key, const QJsonValue& value) {
-    QString qkey = QString::fromUtf8(key.data(), key.size());
-
-    if (!qkey.contains('.')) {
-        obj[qkey] = value;
-        return true;
-    }
-
-    // For nested keys, we'll use a recursive approach with QJsonDocument
-    QStringList parts = qkey.split('.');
-
-    std::function<void(QJsonObject&, const QStringList&, int, const QJsonValue&)> setNested =
-        [&](QJsonObject& current, const QStringList& keyParts, int index, const QJsonValue& val) {
-            if (index == keyParts.size() - 1) {
-                current[keyParts[index]] = val;
-                return;
-            }
-
-            QString part = keyParts[index];
-            if (!current.contains(part) || !current[part].isObject()) {
-                current[part] = QJsonObject();
-            }
-
-            QJsonObject nested = current[part].toObject();
-            setNested(nested, keyParts, index + 1, val);
-            current[part] = nested;
-        };
-
-    setNested(obj, parts, 0, value);
-    return true;
-}
-
 std::filesystem::path ConfigurationManager::get_default_config_path(ConfigurationScope scope, std::string_view plugin_id) const {
     QString base_path;
 
@@ -423,7 +444,7 @@ ConfigurationManager::validate_configuration(ConfigurationScope scope, std::stri
         return ConfigurationValidationResult{true, {}, {"No schema defined for validation"}};
     }
 
-    return validate_configuration(config->data, config->schema.value());
+    return validate_configuration(config->current.load()->to_json(), config->schema.value());
 }
 
 ConfigurationValidationResult
@@ -539,11 +560,8 @@ ConfigurationManager::save_to_file(const std::filesystem::path& file_path, Confi
                                "Configuration not found for scope");
     }
 
-    QJsonObject data;
-    {
-        std::shared_lock lock(config->mutex);
-        data = config->data;
-    }
+    const auto snapshot = config->current.load();
+    const QJsonObject data = snapshot->to_json();
 
     // Create directory if it doesn't exist
     std::filesystem::path dir = file_path.parent_path();
@@ -560,30 +578,44 @@ ConfigurationManager::save_to_file(const std::filesystem::path& file_path, Confi
     QJsonDocument doc(data);
     QByteArray jsonData = doc.toJson(QJsonDocument::Indented);
 
-    // Write to file
-    QFile file(QString::fromStdString(file_path.string()));
+    // QSaveFile writes a temporary file, syncs it to disk and renames it over
+    // the target, so readers never see a partially written configuration
+    QSaveFile file(QString::fromStdString(file_path.string()));
     if (!file.open(QIODevice::WriteOnly)) {
         return make_error<void>(PluginErrorCode::FileSystemError,
                                "Failed to open file for writing: " + file.errorString().toStdString());
     }
 
-    qint64 written = file.write(jsonData);
-    file.close();
-
-    if (written != jsonData.size()) {
+    if (file.write(jsonData) != jsonData.size()) {
+        file.cancelWriting();
         return make_error<void>(PluginErrorCode::FileSystemError,
                                "Failed to write complete configuration data");
     }
 
-    // Update file path and mark as clean
+    if (!file.commit()) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                               "Failed to commit configuration file: " + file.errorString().toStdString());
+    }
+
+    // Update file path and mark as clean unless it changed while writing
     {
         std::unique_lock lock(config->mutex);
         config->file_path = file_path;
-        config->is_dirty = false;
+        if (config->current.load()->version() == snapshot->version()) {
+            config->is_dirty = false;
+        }
     }
 
-    emit const_cast<ConfigurationManager*>(this)->configuration_saved(static_cast<int>(scope),
-                                                                      QString::fromStdString(std::string(plugin_id)));
+    // The persister saves on its own thread; deliver the signal on ours
+    auto* self = const_cast<ConfigurationManager*>(this);
+    const QString saved_plugin_id = QString::fromStdString(std::string(plugin_id));
+    if (QThread::currentThread() == thread()) {
+        emit self->configuration_saved(static_cast<int>(scope), saved_plugin_id);
+    } else {
+        QMetaObject::invokeMethod(self, [self, scope, saved_plugin_id]() {
+            emit self->configuration_saved(static_cast<int>(scope), saved_plugin_id);
+        }, Qt::QueuedConnection);
+    }
 
     qCDebug(configLog) << "Configuration saved to" << QString::fromStdString(file_path.string());
 
@@ -651,7 +683,9 @@ QJsonObject ConfigurationManager::get_statistics() const {
     return QJsonObject{
         {"access_count", static_cast<qint64>(m_access_count.load())},
         {"change_count", static_cast<qint64>(m_change_count.load())},
-        {"auto_persist", m_auto_persist.load()}
+        {"auto_persist", m_auto_persist.load()},
+        {"persist_writes", static_cast<qint64>(m_persister.writes())},
+        {"pending_writes", static_cast<qint64>(m_persister.pending())}
     };
 }
 
@@ -663,6 +697,18 @@ bool ConfigurationManager::is_auto_persist_enabled() const {
     return m_auto_persist.load();
 }
 
+void ConfigurationManager::flush_pending_writes() {
+    m_persister.flush();
+}
+
+void ConfigurationManager::set_persist_delay(std::chrono::milliseconds delay) {
+    m_persister.set_delay(delay);
+}
+
+std::chrono::milliseconds ConfigurationManager::persist_delay() const {
+    return m_persister.delay();
+}
+
 void ConfigurationManager::notify_change(const ConfigurationChangeEvent& event) {
     std::shared_lock lock(m_subscriptions_mutex);
 
@@ -753,48 +799,35 @@ qtplugin::expected<void, PluginError> ConfigurationManager::persist_if_needed(Co
                                "No file path available for persistence");
     }
 
-    return save_to_file(file_path, scope, plugin_id);
+    // Written behind by the persister, once per scope for a burst of changes
+    m_persister.mark_dirty(scope, plugin_id);
+    return make_success();
 }
 
-bool ConfigurationManager::remove_nested_key(QJsonObject& obj, std::string_view key) {
-    QString qkey = QString::fromUtf8(key.data(), key.size());
+void ConfigurationManager::write_scope(ConfigurationScope scope, const std::string& plugin_id) {
+    auto* config = get_config_data(scope, plugin_id);
+    if (!config) {
+        return;
+    }
 
-    if (!qkey.contains('.')) {
-        if (obj.contains(qkey)) {
-            obj.remove(qkey);
-            return true;
+    std::filesystem::path file_path;
+    {
+        std::shared_lock lock(config->mutex);
+        if (!config->is_dirty) {
+            return; // Saved or reloaded since it was marked
         }
-        return false;
+        file_path = config->file_path;
     }
 
-    // For nested keys, use a recursive approach similar to set_nested_value
-    QStringList parts = qkey.split('.');
-
-    std::function<bool(QJsonObject&, const QStringList&, int)> removeNested =
-        [&](QJsonObject& current, const QStringList& keyParts, int index) -> bool {
-            if (index == keyParts.size() - 1) {
-                // Last part - remove the key
-                if (current.contains(keyParts[index])) {
-                    current.remove(keyParts[index]);
-                    return true;
-                }
-                return false;
-            }
-
-            QString part = keyParts[index];
-            if (!current.contains(part) || !current[part].isObject()) {
-                return false; // Path doesn't exist
-            }
-
-            QJsonObject nested = current[part].toObject();
-            bool result = removeNested(nested, keyParts, index + 1);
-            if (result) {
-                current[part] = nested; // Update the modified nested object
-            }
-            return result;
-        };
+    if (file_path.empty()) {
+        file_path = get_default_config_path(scope, plugin_id);
+    }
 
-    return removeNested(obj, parts, 0);
+    auto result = save_to_file(file_path, scope, plugin_id);
+    if (!result) {
+        qCWarning(configLog) << "Failed to persist configuration to" << QString::fromStdString(file_path.string())
+                             << ":" << QString::fromStdString(result.error().message);
+    }
 }
 
 void ConfigurationManager::collect_keys(const QJsonObject& obj, std::vector<std::string>& keys, const std::string& prefix) const {
@@ -0,0 +1,112 @@
+/**
+ * @file configuration_persister.cpp
+ * @brief Implementation of write-behind configuration persistence
+ * @version 3.0.0
+ */
+
+#include "qtplugin/managers/configuration_persister.hpp"
+
+namespace qtplugin {
+
+ConfigurationPersister::ConfigurationPersister(WriteFunction write, std::chrono::milliseconds delay)
+    : m_write(std::move(write)), m_delay(delay) {}
+
+ConfigurationPersister::~ConfigurationPersister() {
+    stop();
+}
+
+void ConfigurationPersister::mark_dirty(ConfigurationScope scope, std::string_view plugin_id) {
+    std::unique_lock lock(m_mutex);
+    if (m_stop_requested) {
+        // No thread to hand the write to any more
+        m_pending.emplace(scope, std::string(plugin_id));
+        write_pending(lock);
+        return;
+    }
+
+    if (m_pending.empty()) {
+        m_first_pending = std::chrono::steady_clock::now();
+    }
+    m_pending.emplace(scope, std::string(plugin_id));
+    if (!m_thread.joinable()) {
+        m_thread = std::thread([this]() { run(); });
+    }
+    m_wakeup.notify_one();
+}
+
+void ConfigurationPersister::flush() {
+    std::unique_lock lock(m_mutex);
+    write_pending(lock);
+}
+
+void ConfigurationPersister::stop() {
+    std::thread thread;
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop_requested = true;
+        thread = std::move(m_thread);
+    }
+    m_wakeup.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+    flush();
+}
+
+void ConfigurationPersister::set_delay(std::chrono::milliseconds delay) {
+    {
+        std::lock_guard lock(m_mutex);
+        m_delay = delay;
+    }
+    m_wakeup.notify_all();
+}
+
+std::chrono::milliseconds ConfigurationPersister::delay() const {
+    std::lock_guard lock(m_mutex);
+    return m_delay;
+}
+
+std::size_t ConfigurationPersister::pending() const {
+    std::lock_guard lock(m_mutex);
+    return m_pending.size();
+}
+
+void ConfigurationPersister::run() {
+    std::unique_lock lock(m_mutex);
+    for (;;) {
+        m_wakeup.wait(lock, [this] { return m_stop_requested || !m_pending.empty(); });
+        if (m_pending.empty()) {
+            return;
+        }
+
+        // Let further changes accumulate until the window of the first one closes
+        m_wakeup.wait_until(lock, m_first_pending + m_delay, [this] {
+            return m_stop_requested || std::chrono::steady_clock::now() >= m_first_pending + m_delay;
+        });
+        write_pending(lock);
+        if (m_stop_requested && m_pending.empty()) {
+            return;
+        }
+    }
+}
+
+void ConfigurationPersister::write_pending(std::unique_lock<std::mutex>& lock) {
+    // One writer at a time, so a flush never overtakes an older in-flight write
+    m_idle.wait(lock, [this] { return !m_writing; });
+    auto pending = std::exchange(m_pending, {});
+    if (pending.empty()) {
+        return;
+    }
+
+    m_writing = true;
+    lock.unlock();
+    for (const auto& [scope, plugin_id] : pending) {
+        m_write(scope, plugin_id);
+    }
+    lock.lock();
+    m_writes.fetch_add(pending.size(), std::memory_order_relaxed);
+    m_writing = false;
+    m_idle.notify_all();
+}
+
+} // namespace qtplugin
@@ -0,0 +1,197 @@
+/**
+ * @file configuration_tree.cpp
+ * @brief Implementation of the configuration tree
+ * @version 3.0.0
+ */
+
+#include "qtplugin/managers/configuration_tree.hpp"
+#include <vector>
+
+namespace qtplugin {
+
+ConfigurationTree::ConfigurationTree() : m_root(make_node(QJsonObject())) {}
+
+ConfigurationTree::ConfigurationTree(const QJsonObject& object) : m_root(make_node(object)) {}
+
+ConfigurationTree::~ConfigurationTree() = default;
+ConfigurationTree::ConfigurationTree(const ConfigurationTree&) = default;
+ConfigurationTree& ConfigurationTree::operator=(const ConfigurationTree&) = default;
+ConfigurationTree::ConfigurationTree(ConfigurationTree&&) noexcept = default;
+ConfigurationTree& ConfigurationTree::operator=(ConfigurationTree&&) noexcept = default;
+
+QJsonValue ConfigurationTree::value(std::span<const ConfigKeySegment> path) const {
+    const Node* node = find(path);
+    return node ? node_value(*node) : QJsonValue(QJsonValue::Undefined);
+}
+
+QJsonValue ConfigurationTree::value(std::string_view key) const {
+    const Node* node = find(key);
+    return node ? node_value(*node) : QJsonValue(QJsonValue::Undefined);
+}
+
+bool ConfigurationTree::contains(std::span<const ConfigKeySegment> path) const {
+    return find(path) != nullptr;
+}
+
+bool ConfigurationTree::contains(std::string_view key) const {
+    return find(key) != nullptr;
+}
+
+void ConfigurationTree::set(std::span<const ConfigKeySegment> path, const QJsonValue& value) {
+    if (!path.empty()) {
+        m_root = with_value(m_root.get(), path, value);
+    }
+}
+
+bool ConfigurationTree::remove(std::span<const ConfigKeySegment> path) {
+    if (path.empty()) {
+        return false;
+    }
+    auto root = without(*m_root, path);
+    if (!root) {
+        return false;
+    }
+    m_root = std::move(root);
+    return true;
+}
+
+bool ConfigurationTree::remove(std::string_view key) {
+    std::vector<ConfigKeySegment> path;
+    std::size_t start = 0;
+    for (;;) {
+        const std::size_t end = key.find('.', start);
+        path.emplace_back(key.substr(start, end == std::string_view::npos ? end : end - start));
+        if (end == std::string_view::npos) {
+            return remove(path);
+        }
+        start = end + 1;
+    }
+}
+
+void ConfigurationTree::assign(const QJsonObject& object) {
+    m_root = make_node(object);
+}
+
+void ConfigurationTree::merge(const QJsonObject& object) {
+    auto root = std::make_shared<Node>(*m_root);
+    for (auto it = object.begin(); it != object.end(); ++it) {
+        root->children[it.key().toStdString()] = make_node(it.value());
+    }
+    m_root = std::move(root);
+}
+
+void ConfigurationTree::clear() {
+    m_root = make_node(QJsonObject());
+}
+
+QJsonObject ConfigurationTree::to_json() const {
+    return node_object(*m_root);
+}
+
+std::shared_ptr<const ConfigurationTree::Node> ConfigurationTree::make_node(const QJsonValue& value) {
+    auto node = std::make_shared<Node>();
+    node->is_object = value.isObject();
+    if (!node->is_object) {
+        node->value = value;
+        return node;
+    }
+
+    const QJsonObject object = value.toObject();
+    node->children.reserve(static_cast<std::size_t>(object.size()));
+    for (auto it = object.begin(); it != object.end(); ++it) {
+        node->children.emplace(it.key().toStdString(), make_node(it.value()));
+    }
+    return node;
+}
+
+std::shared_ptr<const ConfigurationTree::Node>
+ConfigurationTree::with_value(const Node* node, std::span<const ConfigKeySegment> path, const QJsonValue& value) {
+    if (path.empty()) {
+        return make_node(value);
+    }
+
+    // Copy this object, or replace a value in the way with a new object
+    auto copy = (node && node->is_object) ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+    copy->is_object = true;
+    copy->value = QJsonValue();
+
+    auto it = copy->children.find(path.front());
+    if (it == copy->children.end()) {
+        it = copy->children.emplace(path.front().name, nullptr).first;
+    }
+    it->second = with_value(it->second.get(), path.subspan(1), value);
+    return copy;
+}
+
+std::shared_ptr<const ConfigurationTree::Node>
+ConfigurationTree::without(const Node& node, std::span<const ConfigKeySegment> path) {
+    auto it = node.children.find(path.front());
+    if (it == node.children.end()) {
+        return nullptr;
+    }
+
+    auto copy = std::make_shared<Node>(node);
+    if (path.size() == 1) {
+        copy->children.erase(copy->children.find(path.front()));
+        return copy;
+    }
+    if (!it->second->is_object) {
+        return nullptr;
+    }
+    auto child = without(*it->second, path.subspan(1));
+    if (!child) {
+        return nullptr;
+    }
+    copy->children.find(path.front())->second = std::move(child);
+    return copy;
+}
+
+QJsonValue ConfigurationTree::node_value(const Node& node) {
+    return node.is_object ? QJsonValue(node_object(node)) : node.value;
+}
+
+QJsonObject ConfigurationTree::node_object(const Node& node) {
+    QJsonObject object;
+    for (const auto& [name, child] : node.children) {
+        object.insert(QString::fromStdString(name), node_value(*child));
+    }
+    return object;
+}
+
+const ConfigurationTree::Node* ConfigurationTree::find(std::span<const ConfigKeySegment> path) const {
+    const Node* node = m_root.get();
+    for (const auto& segment : path) {
+        if (!node->is_object) {
+            return nullptr;
+        }
+        auto it = node->children.find(segment);
+        if (it == node->children.end()) {
+            return nullptr;
+        }
+        node = it->second.get();
+    }
+    return path.empty() ? nullptr : node;
+}
+
+const ConfigurationTree::Node* ConfigurationTree::find(std::string_view key) const {
+    const Node* node = m_root.get();
+    std::size_t start = 0;
+    for (;;) {
+        const std::size_t end = key.find('.', start);
+        const std::string_view segment = key.substr(start, end == std::string_view::npos ? end : end - start);
+        if (!node->is_object) {
+            return nullptr;
+        }
+        auto it = node->children.find(segment);
+        if (it == node->children.end()) {
+            return nullptr;
+        }
+        node = it->second.get();
+        if (end == std::string_view::npos) {
+            return node;
+        }
+        start = end + 1;
+    }
+}
+
+} // namespace qtplugin
@@ -0,0 +1,1045 @@
+/**
+ * @file platform_plugin_loader.cpp
+ * @brief Linux implementation of the platform-optimized plugin loader
+ * @version 3.0.0
+ */
+
+#include "qtplugin/platform/platform_plugin_loader.hpp"
+#include "qtplugin/core/plugin_discovery.hpp"
+#include "qtplugin/core/plugin_metadata_reader.hpp"
+#include "qtplugin/utils/file_fingerprint.hpp"
+#include "qtplugin/utils/trace.hpp"
+#include "qtplugin/utils/transparent_hash.hpp"
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QPointer>
+#include <QSaveFile>
+#include <QSysInfo>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+
+namespace qtplugin {
+
+namespace {
+
+constexpr int metadata_cache_format_version = 1;
+constexpr const char* metadata_cache_file_name = "platform_metadata_cache.json";
+
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t elapsed_us(Clock::time_point start) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+}
+
+bool has_optimization(PlatformOptimizations optimizations, PlatformOptimization optimization) {
+    return (optimizations & static_cast<PlatformOptimizations>(optimization)) != 0;
+}
+
+QString strategy_name(PlatformLoadingStrategy strategy) {
+    switch (strategy) {
+    case PlatformLoadingStrategy::Default:
+        return "default";
+    case PlatformLoadingStrategy::MemoryMapped:
+        return "memory_mapped";
+    case PlatformLoadingStrategy::LazyLoading:
+        return "lazy_loading";
+    case PlatformLoadingStrategy::PreloadSymbols:
+        return "preload_symbols";
+    case PlatformLoadingStrategy::OptimizedSearch:
+        return "optimized_search";
+    case PlatformLoadingStrategy::CachedMetadata:
+        return "cached_metadata";
+    }
+    return "default";
+}
+
+PlatformLoadingStrategy strategy_from_name(const QString& name) {
+    for (auto strategy : {PlatformLoadingStrategy::MemoryMapped, PlatformLoadingStrategy::LazyLoading,
+                          PlatformLoadingStrategy::PreloadSymbols, PlatformLoadingStrategy::OptimizedSearch,
+                          PlatformLoadingStrategy::CachedMetadata}) {
+        if (strategy_name(strategy) == name) {
+            return strategy;
+        }
+    }
+    return PlatformLoadingStrategy::Default;
+}
+
+int dlopen_flags(const PlatformLoadingConfig& config) {
+    const bool immediate = config.strategy == PlatformLoadingStrategy::PreloadSymbols &&
+                           !has_optimization(config.optimizations, PlatformOptimization::LazyInitialization);
+    int flags = RTLD_LOCAL | (immediate ? RTLD_NOW : RTLD_LAZY);
+    if (has_optimization(config.optimizations, PlatformOptimization::SymbolCaching)) {
+        flags |= RTLD_NODELETE;
+    }
+    return flags;
+}
+
+bool should_prefetch(const PlatformLoadingConfig& config) {
+    return config.strategy == PlatformLoadingStrategy::MemoryMapped ||
+           has_optimization(config.optimizations, PlatformOptimization::MemoryMapping);
+}
+
+// Pull the whole file into the page cache so the dynamic loader's own
+// mappings fault in from memory instead of disk
+std::uint64_t prefetch_image(const std::filesystem::path& file_path) {
+    const int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return 0;
+    }
+
+    std::uint64_t prefetched = 0;
+    struct stat info {};
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+        const auto size = static_cast<std::size_t>(info.st_size);
+        if (::readahead(fd, 0, size) == 0) {
+            prefetched = size;
+        } else {
+            // readahead() is not supported on every filesystem
+            void* image = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (image != MAP_FAILED) {
+                if (::madvise(image, size, MADV_WILLNEED) == 0) {
+                    prefetched = size;
+                }
+                ::munmap(image, size);
+            }
+        }
+    }
+    ::close(fd);
+    return prefetched;
+}
+
+struct LibraryMapping {
+    std::uintptr_t base = 0;
+    std::size_t size = 0;
+};
+
+// Address range of a loaded library's PT_LOAD segments
+LibraryMapping library_mapping(void* handle) {
+    link_map* map = nullptr;
+    if (::dlinfo(handle, RTLD_DI_LINKMAP, &map) != 0 || !map) {
+        return {};
+    }
+
+    struct Search {
+        const link_map* map;
+        LibraryMapping result;
+    } search{map, {}};
+
+    ::dl_iterate_phdr([](dl_phdr_info* info, std::size_t, void* data) -> int {
+        auto* search = static_cast<Search*>(data);
+        if (info->dlpi_addr != search->map->l_addr || !info->dlpi_name ||
+            std::strcmp(info->dlpi_name, search->map->l_name) != 0) {
+            return 0;
+        }
+        std::uintptr_t begin = UINTPTR_MAX;
+        std::uintptr_t end = 0;
+        for (int i = 0; i < info->dlpi_phnum; ++i) {
+            const auto& segment = info->dlpi_phdr[i];
+            if (segment.p_type == PT_LOAD) {
+                begin = std::min<std::uintptr_t>(begin, info->dlpi_addr + segment.p_vaddr);
+                end = std::max<std::uintptr_t>(end, info->dlpi_addr + segment.p_vaddr + segment.p_memsz);
+            }
+        }
+        if (end > begin) {
+            search->result = {begin, end - begin};
+        }
+        return 1;
+    }, &search);
+    return search.result;
+}
+
+// ELF identification: class, byte order and machine
+std::optional<std::array<unsigned char, 4>> elf_identity(const std::filesystem::path& file_path) {
+    QFile file(QString::fromStdString(file_path.string()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return std::nullopt;
+    }
+    const QByteArray header = file.read(20);
+    if (header.size() < 20 || !header.startsWith("\x7f" "ELF")) {
+        return std::nullopt;
+    }
+    return std::array<unsigned char, 4>{static_cast<unsigned char>(header[4]), static_cast<unsigned char>(header[5]),
+                                        static_cast<unsigned char>(header[18]), static_cast<unsigned char>(header[19])};
+}
+
+// Identity of the library this loader is built into, i.e. the host ABI
+const std::optional<std::array<unsigned char, 4>>& host_elf_identity() {
+    static const auto identity = []() -> std::optional<std::array<unsigned char, 4>> {
+        Dl_info info{};
+        if (::dladdr(reinterpret_cast<void*>(&prefetch_image), &info) == 0 || !info.dli_fname) {
+            return std::nullopt;
+        }
+        return elf_identity(info.dli_fname);
+    }();
+    return identity;
+}
+
+qtplugin::expected<void, PluginError> check_qt_version(const QJsonObject& metadata) {
+    const int version = metadata.value("version").toInt();
+    const int major = (version >> 16) & 0xFF;
+    const int minor = (version >> 8) & 0xFF;
+    if (major != QT_VERSION_MAJOR || minor > QT_VERSION_MINOR) {
+        return make_error<void>(PluginErrorCode::VersionMismatch,
+                                "Plugin built for Qt " + std::to_string(major) + "." + std::to_string(minor));
+    }
+    return make_success();
+}
+
+} // namespace
+
+class PlatformPluginLoader::Private {
+public:
+    struct LoadedLibrary {
+        std::filesystem::path file_path;
+        std::shared_ptr<void> library;         ///< dlopen() handle, shared with the instance
+        std::shared_ptr<IPlugin> instance;
+        LibraryMapping mapping;
+        bool prefetched = false;
+        QJsonObject metrics;
+    };
+
+    // Everything up to and including dlopen(); safe to produce on worker threads
+    struct OpenedLibrary {
+        std::filesystem::path file_path;
+        std::string plugin_id;
+        void* handle = nullptr;
+        int flags = 0;
+        bool prefetched = false;
+        bool resident = false;
+        std::uint64_t metadata_us = 0;
+        std::uint64_t prefetch_us = 0;
+        std::uint64_t dlopen_us = 0;
+        Clock::time_point start;
+    };
+
+    struct CachedMetadata {
+        FileFingerprint fingerprint;
+        QJsonObject metadata;
+    };
+
+    explicit Private(PlatformPluginLoader* owner) : q(owner) {}
+
+    PlatformLoadingConfig config_snapshot() const {
+        std::shared_lock lock(config_mutex);
+        return config;
+    }
+
+    qtplugin::expected<QJsonObject, PluginError> metadata(const std::filesystem::path& file_path,
+                                                          bool use_cache);
+    qtplugin::expected<OpenedLibrary, PluginError> open(const std::filesystem::path& file_path,
+                                                        const PlatformLoadingConfig& config);
+    qtplugin::expected<std::shared_ptr<IPlugin>, PluginError> instantiate(OpenedLibrary opened,
+                                                                         const PlatformLoadingConfig& config);
+    qtplugin::expected<std::shared_ptr<IPlugin>, PluginError> load(const std::filesystem::path& file_path,
+                                                                  const PlatformLoadingConfig& config);
+    void record_failure(const std::filesystem::path& file_path, Clock::time_point start);
+
+    qtplugin::expected<void, PluginError> load_metadata_cache(const QString& directory);
+    qtplugin::expected<void, PluginError> save_metadata_cache(const QString& directory) const;
+
+    PlatformPluginLoader* q;
+
+    mutable std::shared_mutex config_mutex;
+    PlatformLoadingConfig config;
+    std::atomic<bool> monitoring{true};
+
+    mutable std::shared_mutex plugins_mutex;
+    StringMap<LoadedLibrary> loaded;
+    std::mutex instantiate_mutex;
+
+    mutable std::mutex cache_mutex;
+    std::unordered_map<std::string, CachedMetadata> metadata_cache;
+
+    mutable std::mutex stats_mutex;
+    PlatformLoadingStatistics stats;
+};
+
+qtplugin::expected<QJsonObject, PluginError>
+PlatformPluginLoader::Private::metadata(const std::filesystem::path& file_path, bool use_cache) {
+    if (!use_cache) {
+        return read_qt_plugin_metadata(file_path);
+    }
+
+    const auto fingerprint = fingerprint_file(file_path);
+    if (!fingerprint) {
+        return make_error<QJsonObject>(PluginErrorCode::FileNotFound, "Plugin file not found: " + file_path.string());
+    }
+
+    const std::string key = file_path.string();
+    std::optional<QJsonObject> cached;
+    {
+        std::lock_guard lock(cache_mutex);
+        auto it = metadata_cache.find(key);
+        if (it != metadata_cache.end() && it->second.fingerprint == *fingerprint) {
+            cached = it->second.metadata;
+        }
+    }
+    if (cached) {
+        {
+            std::lock_guard lock(stats_mutex);
+            ++stats.cached_metadata_hits;
+        }
+        emit q->metadata_cached(QString::fromStdString(key), true);
+        return *cached;
+    }
+
+    auto result = read_qt_plugin_metadata(file_path);
+    if (!result) {
+        return result;
+    }
+    {
+        std::lock_guard lock(cache_mutex);
+        metadata_cache[key] = CachedMetadata{*fingerprint, result.value()};
+    }
+    {
+        std::lock_guard stats_lock(stats_mutex);
+        ++stats.cached_metadata_misses;
+    }
+    emit q->metadata_cached(QString::fromStdString(key), false);
+    return result;
+}
+
+qtplugin::expected<PlatformPluginLoader::Private::OpenedLibrary, PluginError>
+PlatformPluginLoader::Private::open(const std::filesystem::path& file_path, const PlatformLoadingConfig& config) {
+    QTPLUGIN_TRACE_SCOPE("loader", "PlatformPluginLoader::open", file_path);
+
+    OpenedLibrary opened;
+    opened.file_path = file_path;
+    opened.start = Clock::now();
+
+    auto phase_start = Clock::now();
+    auto metadata_result = metadata(file_path, config.enable_metadata_cache);
+    if (!metadata_result) {
+        return qtplugin::unexpected<PluginError>{metadata_result.error()};
+    }
+    auto version_check = check_qt_version(metadata_result.value());
+    if (!version_check) {
+        return qtplugin::unexpected<PluginError>{version_check.error()};
+    }
+    auto plugin_id = plugin_id_from_metadata(metadata_result.value());
+    if (!plugin_id) {
+        return qtplugin::unexpected<PluginError>{plugin_id.error()};
+    }
+    opened.plugin_id = std::move(plugin_id.value());
+    opened.metadata_us = elapsed_us(phase_start);
+
+    {
+        std::shared_lock lock(plugins_mutex);
+        if (loaded.contains(opened.plugin_id)) {
+            return make_error<OpenedLibrary>(PluginErrorCode::AlreadyLoaded, "Plugin already loaded: " + opened.plugin_id);
+        }
+    }
+
+    if (should_prefetch(config)) {
+        phase_start = Clock::now();
+        const auto bytes = prefetch_image(file_path);
+        opened.prefetched = bytes > 0;
+        opened.prefetch_us = elapsed_us(phase_start);
+        std::lock_guard lock(stats_mutex);
+        stats.platform_stats["prefetched_bytes"] += bytes;
+    }
+
+    const std::string native_path = file_path.string();
+    if (void* resident = ::dlopen(native_path.c_str(), RTLD_LAZY | RTLD_NOLOAD)) {
+        opened.resident = true;
+        ::dlclose(resident);
+    }
+
+    opened.flags = dlopen_flags(config);
+    phase_start = Clock::now();
+    opened.handle = ::dlopen(native_path.c_str(), opened.flags);
+    opened.dlopen_us = elapsed_us(phase_start);
+    if (!opened.handle) {
+        const char* error = ::dlerror();
+        return make_error<OpenedLibrary>(PluginErrorCode::LoadFailed,
+                                         "Failed to load plugin: " + std::string(error ? error : native_path));
+    }
+    return opened;
+}
+
+qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+PlatformPluginLoader::Private::instantiate(OpenedLibrary opened, const PlatformLoadingConfig& config) {
+    QTPLUGIN_TRACE_SCOPE("loader", "PlatformPluginLoader::instantiate", opened.file_path);
+
+    // Opening the same library twice yields the same root object, so the
+    // duplicate check and the instance creation must not interleave
+    std::lock_guard instantiate_lock(instantiate_mutex);
+    {
+        std::shared_lock lock(plugins_mutex);
+        if (loaded.contains(opened.plugin_id)) {
+            ::dlclose(opened.handle);
+            return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::AlreadyLoaded,
+                                                       "Plugin already loaded: " + opened.plugin_id);
+        }
+    }
+
+    const auto phase_start = Clock::now();
+    using InstanceFunction = QObject* (*)();
+    auto entry = reinterpret_cast<InstanceFunction>(::dlsym(opened.handle, "qt_plugin_instance"));
+    if (!entry) {
+        ::dlclose(opened.handle);
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::SymbolNotFound,
+                                                   "Plugin does not export qt_plugin_instance: " + opened.file_path.string());
+    }
+
+    QObject* root = entry();
+    IPlugin* plugin_interface = root ? qobject_cast<IPlugin*>(root) : nullptr;
+    if (!plugin_interface) {
+        delete root;
+        ::dlclose(opened.handle);
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::LoadFailed,
+                                                   "Plugin does not implement IPlugin interface");
+    }
+
+    // As with QtPluginLoader, the instance shares ownership of the library:
+    // the root object is deleted and the library closed only once the last
+    // plugin reference is released
+    std::shared_ptr<void> library(opened.handle, [root = QPointer<QObject>(root)](void* handle) {
+        delete root.data();
+        ::dlclose(handle);
+    });
+
+    LoadedLibrary entry_info;
+    entry_info.file_path = opened.file_path;
+    entry_info.instance = std::shared_ptr<IPlugin>(library, plugin_interface);
+    entry_info.library = std::move(library);
+    entry_info.mapping = library_mapping(opened.handle);
+    entry_info.prefetched = opened.prefetched;
+    const std::uint64_t instance_us = elapsed_us(phase_start);
+    const std::uint64_t load_us = elapsed_us(opened.start);
+
+    if (monitoring.load(std::memory_order_relaxed)) {
+        QJsonObject metrics;
+        metrics["file_path"] = QString::fromStdString(opened.file_path.string());
+        metrics["strategy"] = strategy_name(config.strategy);
+        metrics["lazy_binding"] = (opened.flags & RTLD_NOW) == 0;
+        metrics["resident"] = opened.resident;
+        metrics["prefetched"] = opened.prefetched;
+        metrics["metadata_us"] = static_cast<qint64>(opened.metadata_us);
+        metrics["prefetch_us"] = static_cast<qint64>(opened.prefetch_us);
+        metrics["dlopen_us"] = static_cast<qint64>(opened.dlopen_us);
+        metrics["instance_us"] = static_cast<qint64>(instance_us);
+        metrics["load_time_us"] = static_cast<qint64>(load_us);
+        metrics["mapped_size"] = static_cast<qint64>(entry_info.mapping.size);
+        entry_info.metrics = metrics;
+    }
+
+    auto instance = entry_info.instance;
+    const auto mapped_size = entry_info.mapping.size;
+    {
+        std::unique_lock lock(plugins_mutex);
+        loaded.emplace(opened.plugin_id, std::move(entry_info));
+    }
+
+    {
+        std::lock_guard lock(stats_mutex);
+        ++stats.total_plugins_loaded;
+        if (opened.prefetched) {
+            ++stats.memory_mapped_plugins;
+        }
+        stats.total_memory_used += mapped_size;
+        auto& platform_stats = stats.platform_stats;
+        ++platform_stats[(opened.flags & RTLD_NOW) ? "dlopen_now" : "dlopen_lazy"];
+        if (opened.flags & RTLD_NODELETE) {
+            ++platform_stats["dlopen_nodelete"];
+        }
+        if (opened.resident) {
+            ++platform_stats["resident_reuses"];
+        }
+        platform_stats["metadata_us"] += opened.metadata_us;
+        platform_stats["prefetch_us"] += opened.prefetch_us;
+        platform_stats["dlopen_us"] += opened.dlopen_us;
+        platform_stats["instance_us"] += instance_us;
+        platform_stats["load_time_us"] += load_us;
+        stats.total_load_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::microseconds(platform_stats["load_time_us"]));
+        stats.average_load_time = stats.total_load_time / static_cast<long>(stats.total_plugins_loaded);
+    }
+
+    emit q->loading_completed(QString::fromStdString(opened.file_path.string()), true,
+                              static_cast<qint64>(load_us / 1000));
+    return instance;
+}
+
+qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+PlatformPluginLoader::Private::load(const std::filesystem::path& file_path, const PlatformLoadingConfig& config) {
+    const auto start = Clock::now();
+    emit q->loading_started(QString::fromStdString(file_path.string()));
+
+    auto opened = open(file_path, config);
+    if (!opened) {
+        record_failure(file_path, start);
+        return qtplugin::unexpected<PluginError>{opened.error()};
+    }
+    auto result = instantiate(std::move(opened.value()), config);
+    if (!result) {
+        record_failure(file_path, start);
+    }
+    return result;
+}
+
+void PlatformPluginLoader::Private::record_failure(const std::filesystem::path& file_path, Clock::time_point start) {
+    {
+        std::lock_guard lock(stats_mutex);
+        ++stats.total_plugins_failed;
+    }
+    emit q->loading_completed(QString::fromStdString(file_path.string()), false,
+                              static_cast<qint64>(elapsed_us(start) / 1000));
+}
+
+qtplugin::expected<void, PluginError> PlatformPluginLoader::Private::load_metadata_cache(const QString& directory) {
+    QFile file(directory + "/" + metadata_cache_file_name);
+    if (!file.exists()) {
+        return make_success();
+    }
+    if (!file.open(QIODevice::ReadOnly)) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                                "Cannot open metadata cache: " + file.fileName().toStdString());
+    }
+
+    QJsonParseError parse_error;
+    const auto document = QJsonDocument::fromJson(file.readAll(), &parse_error);
+    if (parse_error.error != QJsonParseError::NoError || !document.isObject()) {
+        return make_error<void>(PluginErrorCode::InvalidFormat,
+                                "Invalid metadata cache: " + parse_error.errorString().toStdString());
+    }
+    const QJsonObject root = document.object();
+    if (root.value("format_version").toInt() != metadata_cache_format_version) {
+        // Written by another version; rebuilt on the next save
+        return make_success();
+    }
+
+    std::lock_guard lock(cache_mutex);
+    for (const auto& value : root.value("entries").toArray()) {
+        const QJsonObject entry = value.toObject();
+        CachedMetadata cached;
+        cached.fingerprint.size = static_cast<std::uint64_t>(entry.value("size").toInteger());
+        cached.fingerprint.modified_ns = entry.value("modified_ns").toInteger();
+        cached.metadata = entry.value("metadata").toObject();
+        metadata_cache.insert_or_assign(entry.value("path").toString().toStdString(), std::move(cached));
+    }
+    return make_success();
+}
+
+qtplugin::expected<void, PluginError> PlatformPluginLoader::Private::save_metadata_cache(const QString& directory) const {
+    QJsonArray entries;
+    {
+        std::lock_guard lock(cache_mutex);
+        for (const auto& [path, cached] : metadata_cache) {
+            QJsonObject entry;
+            entry["path"] = QString::fromStdString(path);
+            entry["size"] = static_cast<qint64>(cached.fingerprint.size);
+            entry["modified_ns"] = static_cast<qint64>(cached.fingerprint.modified_ns);
+            entry["metadata"] = cached.metadata;
+            entries.append(entry);
+        }
+    }
+
+    QJsonObject root;
+    root["format_version"] = metadata_cache_format_version;
+    root["entries"] = entries;
+
+    QSaveFile file(directory + "/" + metadata_cache_file_name);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                                "Cannot write metadata cache: " + file.fileName().toStdString());
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                                "Cannot write metadata cache: " + file.fileName().toStdString());
+    }
+    return make_success();
+}
+
+// === PlatformPluginLoader ===
+
+PlatformPluginLoader::PlatformPluginLoader(QObject* parent)
+    : QObject(parent), d(std::make_unique<Private>(this)) {}
+
+PlatformPluginLoader::~PlatformPluginLoader() {
+    const auto config = d->config_snapshot();
+    if (config.enable_metadata_cache && !config.cache_directory.isEmpty()) {
+        d->save_metadata_cache(config.cache_directory);
+    }
+    // Libraries close once the last outstanding plugin reference is released
+    std::unique_lock lock(d->plugins_mutex);
+    d->loaded.clear();
+}
+
+bool PlatformPluginLoader::can_load(const std::filesystem::path& file_path) const {
+    if (file_path.extension() != ".so") {
+        return false;
+    }
+    auto metadata = d->metadata(file_path, d->config_snapshot().enable_metadata_cache);
+    return metadata && check_qt_version(metadata.value());
+}
+
+qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+PlatformPluginLoader::load(const std::filesystem::path& file_path) {
+    QTPLUGIN_TRACE_SCOPE("loader", "PlatformPluginLoader::load", file_path);
+    return d->load(file_path, d->config_snapshot());
+}
+
+qtplugin::expected<void, PluginError> PlatformPluginLoader::unload(std::string_view plugin_id) {
+    std::size_t mapped_size = 0;
+    {
+        std::unique_lock lock(d->plugins_mutex);
+        auto it = d->loaded.find(plugin_id);
+        if (it == d->loaded.end()) {
+            return make_error<void>(PluginErrorCode::NotLoaded, "Plugin not loaded: " + std::string(plugin_id));
+        }
+        mapped_size = it->second.mapping.size;
+        d->loaded.erase(it);
+    }
+
+    std::lock_guard lock(d->stats_mutex);
+    d->stats.total_memory_used -= std::min<std::uint64_t>(d->stats.total_memory_used, mapped_size);
+    return make_success();
+}
+
+qtplugin::expected<QJsonObject, PluginError>
+PlatformPluginLoader::read_plugin_metadata(const std::filesystem::path& file_path) const {
+    return d->metadata(file_path, d->config_snapshot().enable_metadata_cache);
+}
+
+std::vector<std::string> PlatformPluginLoader::supported_extensions() const {
+    return {".so"};
+}
+
+std::string_view PlatformPluginLoader::name() const noexcept {
+    return "PlatformPluginLoader";
+}
+
+bool PlatformPluginLoader::supports_hot_reload() const noexcept {
+    return false;
+}
+
+// === Configuration ===
+
+qtplugin::expected<void, PluginError>
+PlatformPluginLoader::set_loading_config(const PlatformLoadingConfig& config) {
+    if (config.max_parallel_loads < 1) {
+        return make_error<void>(PluginErrorCode::ConfigurationError, "max_parallel_loads must be at least 1");
+    }
+    std::unique_lock lock(d->config_mutex);
+    d->config = config;
+    return make_success();
+}
+
+PlatformLoadingConfig PlatformPluginLoader::get_loading_config() const {
+    return d->config_snapshot();
+}
+
+qtplugin::expected<void, PluginError>
+PlatformPluginLoader::enable_optimization(PlatformOptimization optimization) {
+    if (optimization == PlatformOptimization::CompressedStorage) {
+        return make_error<void>(PluginErrorCode::NotImplemented, "Compressed plugin storage is not supported on Linux");
+    }
+    if (optimization == PlatformOptimization::PerformanceMonitoring) {
+        set_performance_monitoring_enabled(true);
+    }
+    std::unique_lock lock(d->config_mutex);
+    d->config.optimizations |= static_cast<PlatformOptimizations>(optimization);
+    return make_success();
+}
+
+qtplugin::expected<void, PluginError>
+PlatformPluginLoader::disable_optimization(PlatformOptimization optimization) {
+    if (optimization == PlatformOptimization::PerformanceMonitoring) {
+        set_performance_monitoring_enabled(false);
+    }
+    std::unique_lock lock(d->config_mutex);
+    d->config.optimizations &= ~static_cast<PlatformOptimizations>(optimization);
+    return make_success();
+}
+
+bool PlatformPluginLoader::is_optimization_enabled(PlatformOptimization optimization) const {
+    return has_optimization(d->config_snapshot().optimizations, optimization);
+}
+
+// === Memory-Mapped Loading ===
+
+qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+PlatformPluginLoader::load_memory_mapped(const std::filesystem::path& file_path) {
+    auto config = d->config_snapshot();
+    config.strategy = PlatformLoadingStrategy::MemoryMapped;
+    return d->load(file_path, config);
+}
+
+qtplugin::expected<void, PluginError> PlatformPluginLoader::unload_memory_mapped(std::string_view plugin_id) {
+    return unload(plugin_id);
+}
+
+qtplugin::expected<QJsonObject, PluginError>
+PlatformPluginLoader::get_memory_mapping_info(std::string_view plugin_id) const {
+    std::shared_lock lock(d->plugins_mutex);
+    auto it = d->loaded.find(plugin_id);
+    if (it == d->loaded.end()) {
+        return make_error<QJsonObject>(PluginErrorCode::NotLoaded, "Plugin not loaded: " + std::string(plugin_id));
+    }
+
+    const auto& library = it->second;
+    QJsonObject info;
+    info["plugin_id"] = QString::fromStdString(it->first);
+    info["file_path"] = QString::fromStdString(library.file_path.string());
+    info["base_address"] = QString("0x%1").arg(static_cast<qulonglong>(library.mapping.base), 0, 16);
+    info["mapped_size"] = static_cast<qint64>(library.mapping.size);
+    info["prefetched"] = library.prefetched;
+    return info;
+}
+
+// === Parallel Loading ===
+
+std::vector<qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>>
+PlatformPluginLoader::load_parallel(const std::vector<std::filesystem::path>& file_paths, int max_parallel) {
+    QTPLUGIN_TRACE_SCOPE("loader", "PlatformPluginLoader::load_parallel");
+    const auto config = d->config_snapshot();
+    const auto start = Clock::now();
+
+    std::size_t workers = 1;
+    if (has_optimization(config.optimizations, PlatformOptimization::ParallelLoading)) {
+        workers = static_cast<std::size_t>(std::max(1, std::min(max_parallel, config.max_parallel_loads)));
+        workers = std::min(workers, std::max<std::size_t>(file_paths.size(), 1));
+    }
+
+    for (const auto& file_path : file_paths) {
+        emit loading_started(QString::fromStdString(file_path.string()));
+    }
+
+    // Metadata, prefetch and dlopen() run on the workers; glibc serializes the
+    // dlopen() calls themselves, so the gain comes from overlapping file I/O
+    std::vector<std::optional<qtplugin::expected<Private::OpenedLibrary, PluginError>>> opened(file_paths.size());
+    std::atomic<std::size_t> next{0};
+    auto open_next = [&]() {
+        for (std::size_t i = next.fetch_add(1); i < file_paths.size(); i = next.fetch_add(1)) {
+            opened[i].emplace(d->open(file_paths[i], config));
+        }
+    };
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(workers - 1);
+        for (std::size_t i = 1; i < workers; ++i) {
+            threads.emplace_back(open_next);
+        }
+        open_next();
+    }
+
+    // Plugin objects are created here so they live on the calling thread
+    std::vector<qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>> results;
+    results.reserve(file_paths.size());
+    for (std::size_t i = 0; i < file_paths.size(); ++i) {
+        auto& library = *opened[i];
+        if (!library) {
+            d->record_failure(file_paths[i], start);
+            results.emplace_back(qtplugin::unexpected<PluginError>{library.error()});
+            continue;
+        }
+        auto instance = d->instantiate(std::move(library.value()), config);
+        if (!instance) {
+            d->record_failure(file_paths[i], start);
+        }
+        results.push_back(std::move(instance));
+    }
+
+    std::lock_guard lock(d->stats_mutex);
+    ++d->stats.platform_stats["parallel_batches"];
+    d->stats.platform_stats["parallel_workers"] = workers;
+    return results;
+}
+
+std::vector<qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>>
+PlatformPluginLoader::load_directory_parallel(const std::filesystem::path& directory, bool recursive, int max_parallel) {
+    return load_parallel(discover_plugins_platform_optimized({directory}, recursive), max_parallel);
+}
+
+// === Metadata Caching ===
+
+qtplugin::expected<void, PluginError> PlatformPluginLoader::enable_metadata_cache(const QString& cache_directory) {
+    if (!QDir().mkpath(cache_directory)) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                                "Cannot create cache directory: " + cache_directory.toStdString());
+    }
+    auto loaded = d->load_metadata_cache(cache_directory);
+
+    std::unique_lock lock(d->config_mutex);
+    d->config.cache_directory = cache_directory;
+    d->config.enable_metadata_cache = true;
+    d->config.optimizations |= static_cast<PlatformOptimizations>(PlatformOptimization::MetadataCaching);
+    return loaded;
+}
+
+qtplugin::expected<void, PluginError> PlatformPluginLoader::disable_metadata_cache() {
+    PlatformLoadingConfig config;
+    {
+        std::unique_lock lock(d->config_mutex);
+        config = d->config;
+        d->config.enable_metadata_cache = false;
+        d->config.optimizations &= ~static_cast<PlatformOptimizations>(PlatformOptimization::MetadataCaching);
+    }
+
+    auto saved = config.cache_directory.isEmpty() ? make_success() : d->save_metadata_cache(config.cache_directory);
+    clear_metadata_cache();
+    return saved;
+}
+
+int PlatformPluginLoader::clear_metadata_cache() {
+    std::lock_guard lock(d->cache_mutex);
+    const auto cleared = static_cast<int>(d->metadata_cache.size());
+    d->metadata_cache.clear();
+    return cleared;
+}
+
+qtplugin::expected<QJsonObject, PluginError>
+PlatformPluginLoader::get_cached_metadata(const std::filesystem::path& file_path) const {
+    const auto fingerprint = fingerprint_file(file_path);
+    std::lock_guard lock(d->cache_mutex);
+    auto it = d->metadata_cache.find(file_path.string());
+    if (!fingerprint || it == d->metadata_cache.end() || it->second.fingerprint != *fingerprint) {
+        return make_error<QJsonObject>(PluginErrorCode::NotFound, "No cached metadata for " + file_path.string());
+    }
+    return it->second.metadata;
+}
+
+qtplugin::expected<void, PluginError>
+PlatformPluginLoader::cache_metadata(const std::filesystem::path& file_path, const QJsonObject& metadata) {
+    const auto fingerprint = fingerprint_file(file_path);
+    if (!fingerprint) {
+        return make_error<void>(PluginErrorCode::FileNotFound, "Plugin file not found: " + file_path.string());
+    }
+    std::lock_guard lock(d->cache_mutex);
+    d->metadata_cache.insert_or_assign(file_path.string(), Private::CachedMetadata{*fingerprint, metadata});
+    return make_success();
+}
+
+// === Platform-Specific Discovery ===
+
+std::vector<std::filesystem::path>
+PlatformPluginLoader::discover_plugins_platform_optimized(const std::vector<std::filesystem::path>& search_paths,
+                                                          bool recursive) {
+    PluginDiscovery discovery(supported_extensions(),
+                              [this](const std::filesystem::path& file_path) { return can_load(file_path); });
+    discovery.set_max_threads(static_cast<std::size_t>(get_loading_config().max_parallel_loads));
+    return discovery.scan(search_paths, recursive);
+}
+
+qtplugin::expected<PlatformPluginInfo, PluginError>
+PlatformPluginLoader::get_platform_plugin_info(const std::filesystem::path& file_path) const {
+    QFile file(QString::fromStdString(file_path.string()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return make_error<PlatformPluginInfo>(PluginErrorCode::FileNotFound,
+                                              "Plugin file not found: " + file_path.string());
+    }
+
+    PlatformPluginInfo info;
+    info.file_path = file.fileName();
+    info.platform = QSysInfo::kernelType();
+    info.architecture = QSysInfo::currentCpuArchitecture();
+    info.file_size = static_cast<uint64_t>(file.size());
+    info.modification_time = std::chrono::system_clock::time_point(
+        std::chrono::milliseconds(QFileInfo(file).lastModified().toMSecsSinceEpoch()));
+
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(&file);
+    info.file_hash = QString::fromLatin1(hash.result().toHex());
+    info.platform_metadata = get_unix_library_info(file_path);
+
+    std::shared_lock lock(d->plugins_mutex);
+    for (const auto& [id, library] : d->loaded) {
+        if (library.file_path == file_path) {
+            info.is_memory_mapped = library.mapping.size > 0;
+            info.memory_address = reinterpret_cast<void*>(library.mapping.base);
+            info.memory_size = library.mapping.size;
+            info.performance_metrics = library.metrics;
+            break;
+        }
+    }
+    return info;
+}
+
+qtplugin::expected<bool, PluginError>
+PlatformPluginLoader::validate_plugin_integrity(const std::filesystem::path& file_path) const {
+    const auto identity = elf_identity(file_path);
+    if (!identity) {
+        if (!std::filesystem::exists(file_path)) {
+            return make_error<bool>(PluginErrorCode::FileNotFound, "Plugin file not found: " + file_path.string());
+        }
+        return false;
+    }
+
+    // Must match the host ABI and carry readable, compatible plugin metadata
+    const auto& host = host_elf_identity();
+    if (host && *identity != *host) {
+        return false;
+    }
+    auto metadata = read_qt_plugin_metadata(file_path);
+    return metadata.has_value() && check_qt_version(metadata.value()).has_value();
+}
+
+// === Performance Monitoring ===
+
+PlatformLoadingStatistics PlatformPluginLoader::get_loading_statistics() const {
+    std::lock_guard lock(d->stats_mutex);
+    return d->stats;
+}
+
+void PlatformPluginLoader::reset_statistics() {
+    std::uint64_t memory_used = 0;
+    {
+        std::shared_lock lock(d->plugins_mutex);
+        for (const auto& [id, library] : d->loaded) {
+            memory_used += library.mapping.size;
+        }
+    }
+    std::lock_guard lock(d->stats_mutex);
+    d->stats = PlatformLoadingStatistics{};
+    d->stats.total_memory_used = memory_used;
+}
+
+qtplugin::expected<QJsonObject, PluginError>
+PlatformPluginLoader::get_plugin_performance_metrics(std::string_view plugin_id) const {
+    std::shared_lock lock(d->plugins_mutex);
+    auto it = d->loaded.find(plugin_id);
+    if (it == d->loaded.end()) {
+        return make_error<QJsonObject>(PluginErrorCode::NotLoaded, "Plugin not loaded: " + std::string(plugin_id));
+    }
+    return it->second.metrics;
+}
+
+void PlatformPluginLoader::set_performance_monitoring_enabled(bool enabled) {
+    d->monitoring.store(enabled, std::memory_order_relaxed);
+}
+
+bool PlatformPluginLoader::is_performance_monitoring_enabled() const {
+    return d->monitoring.load(std::memory_order_relaxed);
+}
+
+// === Unix-Specific ===
+
+qtplugin::expected<std::shared_ptr<IPlugin>, PluginError>
+PlatformPluginLoader::load_unix_specific(const std::filesystem::path& file_path) {
+    return load(file_path);
+}
+
+QJsonObject PlatformPluginLoader::get_unix_library_info(const std::filesystem::path& file_path) const {
+    QJsonObject info;
+    const auto identity = elf_identity(file_path);
+    info["elf"] = identity.has_value();
+    if (!identity) {
+        return info;
+    }
+
+    const auto& id = *identity;
+    info["elf_class"] = id[0] == 2 ? 64 : 32;
+    info["byte_order"] = id[1] == 2 ? "big" : "little";
+    info["machine"] = id[1] == 2 ? (id[2] << 8) | id[3] : (id[3] << 8) | id[2];
+    info["host_compatible"] = host_elf_identity() == identity;
+
+    const std::string native_path = file_path.string();
+    void* resident = ::dlopen(native_path.c_str(), RTLD_LAZY | RTLD_NOLOAD);
+    info["resident"] = resident != nullptr;
+    if (resident) {
+        ::dlclose(resident);
+    }
+    return info;
+}
+
+// === Serialization ===
+
+QJsonObject PlatformPluginInfo::to_json() const {
+    QJsonObject json;
+    json["file_path"] = file_path;
+    json["platform"] = platform;
+    json["architecture"] = architecture;
+    json["file_size"] = static_cast<qint64>(file_size);
+    json["modification_time"] = static_cast<qint64>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        modification_time.time_since_epoch()).count());
+    json["file_hash"] = file_hash;
+    json["platform_metadata"] = platform_metadata;
+    json["performance_metrics"] = performance_metrics;
+    json["is_memory_mapped"] = is_memory_mapped;
+    json["memory_address"] = QString("0x%1").arg(reinterpret_cast<qulonglong>(memory_address), 0, 16);
+    json["memory_size"] = static_cast<qint64>(memory_size);
+    return json;
+}
+
+PlatformPluginInfo PlatformPluginInfo::from_json(const QJsonObject& json) {
+    PlatformPluginInfo info;
+    info.file_path = json.value("file_path").toString();
+    info.platform = json.value("platform").toString();
+    info.architecture = json.value("architecture").toString();
+    info.file_size = static_cast<uint64_t>(json.value("file_size").toInteger());
+    info.modification_time = std::chrono::system_clock::time_point(
+        std::chrono::milliseconds(json.value("modification_time").toInteger()));
+    info.file_hash = json.value("file_hash").toString();
+    info.platform_metadata = json.value("platform_metadata").toObject();
+    info.performance_metrics = json.value("performance_metrics").toObject();
+    // Addresses are only meaningful in the process that produced them
+    info.is_memory_mapped = false;
+    info.memory_size = static_cast<size_t>(json.value("memory_size").toInteger());
+    return info;
+}
+
+QJsonObject PlatformLoadingConfig::to_json() const {
+    QJsonObject json;
+    json["strategy"] = strategy_name(strategy);
+    json["optimizations"] = static_cast<qint64>(optimizations);
+    json["cache_directory"] = cache_directory;
+    json["max_parallel_loads"] = max_parallel_loads;
+    json["load_timeout"] = static_cast<qint64>(load_timeout.count());
+    json["enable_symbol_prefetch"] = enable_symbol_prefetch;
+    json["enable_metadata_cache"] = enable_metadata_cache;
+    json["enable_security_checks"] = enable_security_checks;
+    json["platform_specific_config"] = platform_specific_config;
+    return json;
+}
+
+PlatformLoadingConfig PlatformLoadingConfig::from_json(const QJsonObject& json) {
+    PlatformLoadingConfig config;
+    config.strategy = strategy_from_name(json.value("strategy").toString());
+    config.optimizations = static_cast<PlatformOptimizations>(json.value("optimizations").toInteger());
+    config.cache_directory = json.value("cache_directory").toString();
+    config.max_parallel_loads = json.value("max_parallel_loads").toInt(config.max_parallel_loads);
+    config.load_timeout = std::chrono::milliseconds(json.value("load_timeout").toInteger(config.load_timeout.count()));
+    config.enable_symbol_prefetch = json.value("enable_symbol_prefetch").toBool(config.enable_symbol_prefetch);
+    config.enable_metadata_cache = json.value("enable_metadata_cache").toBool(config.enable_metadata_cache);
+    config.enable_security_checks = json.value("enable_security_checks").toBool(config.enable_security_checks);
+    config.platform_specific_config = json.value("platform_specific_config").toObject();
+    return config;
+}
+
+QJsonObject PlatformLoadingStatistics::to_json() const {
+    QJsonObject json;
+    json["total_plugins_loaded"] = static_cast<qint64>(total_plugins_loaded);
+    json["total_plugins_failed"] = static_cast<qint64>(total_plugins_failed);
+    json["memory_mapped_plugins"] = static_cast<qint64>(memory_mapped_plugins);
+    json["cached_metadata_hits"] = static_cast<qint64>(cached_metadata_hits);
+    json["cached_metadata_misses"] = static_cast<qint64>(cached_metadata_misses);
+    json["total_load_time"] = static_cast<qint64>(total_load_time.count());
+    json["average_load_time"] = static_cast<qint64>(average_load_time.count());
+    json["total_memory_used"] = static_cast<qint64>(total_memory_used);
+
+    QJsonObject platform;
+    for (const auto& [key, value] : platform_stats) {
+        platform[key] = static_cast<qint64>(value);
+    }
+    json["platform_stats"] = platform;
+    return json;
+}
+
+} // namespace qtplugin
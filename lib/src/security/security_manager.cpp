@@ -5,84 +5,188 @@
  */
 
 #include <qtplugin/security/security_manager.hpp>
+#include <qtplugin/core/plugin_metadata_reader.hpp>
+#include <qtplugin/utils/trace.hpp>
 #include <QJsonDocument>
 #include <QJsonArray>
 #include <QFileInfo>
 #include <QDir>
 #include <QCryptographicHash>
-#include <QPluginLoader>
 #include <QFile>
 #include <QIODevice>
 #include <QRegularExpression>
 #include <QDebug>
 #include <QLoggingCategory>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <mutex>
+#include <thread>
 #include <filesystem>
 #include <algorithm>
 
 namespace qtplugin {
 
+namespace {
+
+// Adds one check to the overall result; false if the check failed
+bool merge_check(SecurityValidationResult& result, const SecurityValidationResult& check) {
+    if (!check.is_valid) {
+        result.errors.insert(result.errors.end(), check.errors.begin(), check.errors.end());
+        return false;
+    }
+    result.warnings.insert(result.warnings.end(), check.warnings.begin(), check.warnings.end());
+    return true;
+}
+
+std::size_t worker_count(std::size_t jobs) {
+    return std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, jobs);
+}
+
+} // namespace
+
 SecurityManager::SecurityManager() = default;
 
 SecurityManager::~SecurityManager() = default;
 
 SecurityValidationResult SecurityManager::validate_plugin(const std::filesystem::path& file_path,
                                                          SecurityLevel required_level) {
+    QTPLUGIN_TRACE_SCOPE("security", "SecurityManager::validate_plugin", file_path);
     m_validations_performed.fetch_add(1);
     
     SecurityValidationResult result;
     result.validated_level = SecurityLevel::None;
+    if (run_parse_stage(file_path, required_level, result)) {
+        run_hash_stage(file_path, required_level, result);
+    }
+    record_validation(result);
     
+    return result;
+}
+
+std::vector<SecurityValidationResult> SecurityManager::validate_plugins(std::span<const std::filesystem::path> file_paths,
+                                                                        SecurityLevel required_level,
+                                                                        const SecurityValidationCallback& on_result) {
+    QTPLUGIN_TRACE_SCOPE("security", "SecurityManager::validate_plugins");
+    std::vector<SecurityValidationResult> results(file_paths.size());
+    if (file_paths.empty()) {
+        return results;
+    }
+    m_validations_performed.fetch_add(file_paths.size());
+
+    auto finish = [&](std::size_t index) {
+        record_validation(results[index]);
+        if (on_result) {
+            on_result(index, results[index]);
+        }
+    };
+
+    const std::size_t parse_workers = worker_count(file_paths.size());
+    const std::size_t hash_workers = worker_count(file_paths.size());
+
+    // Files that passed the parse stage wait here for the hash stage
+    std::mutex queue_mutex;
+    std::condition_variable queue_ready;
+    std::deque<std::size_t> hash_queue;
+    std::size_t parsers_running = parse_workers;
+    std::atomic<std::size_t> next_index{0};
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(parse_workers + hash_workers);
+        for (std::size_t i = 0; i < parse_workers; ++i) {
+            workers.emplace_back([&]() {
+                for (std::size_t index; (index = next_index.fetch_add(1)) < file_paths.size();) {
+                    if (!run_parse_stage(file_paths[index], required_level, results[index])) {
+                        finish(index);
+                        continue;
+                    }
+                    {
+                        std::lock_guard lock(queue_mutex);
+                        hash_queue.push_back(index);
+                    }
+                    queue_ready.notify_one();
+                }
+                {
+                    std::lock_guard lock(queue_mutex);
+                    --parsers_running;
+                }
+                queue_ready.notify_all();
+            });
+        }
+        for (std::size_t i = 0; i < hash_workers; ++i) {
+            workers.emplace_back([&]() {
+                for (;;) {
+                    std::unique_lock lock(queue_mutex);
+                    queue_ready.wait(lock, [&]() { return !hash_queue.empty() || parsers_running == 0; });
+                    if (hash_queue.empty()) {
+                        return;
+                    }
+                    const std::size_t index = hash_queue.front();
+                    hash_queue.pop_front();
+                    lock.unlock();
+
+                    run_hash_stage(file_paths[index], required_level, results[index]);
+                    finish(index);
+                }
+            });
+        }
+    }
+
+    return results;
+}
+
+bool SecurityManager::run_parse_stage(const std::filesystem::path& file_path, SecurityLevel required_level,
+                                      SecurityValidationResult& result) const {
+    // Identified first, so the result cannot vouch for a file swapped while it is read
+    result.file_identity = identify_file(file_path);
+
     // Basic file validation (always performed)
-    auto file_result = validate_file_integrity(file_path);
-    if (!file_result.is_valid) {
-        result.errors.insert(result.errors.end(), file_result.errors.begin(), file_result.errors.end());
-        m_validations_failed.fetch_add(1);
-        return result;
+    if (!merge_check(result, validate_file_integrity(file_path))) {
+        return false;
     }
     result.validated_level = SecurityLevel::Basic;
-    result.warnings.insert(result.warnings.end(), file_result.warnings.begin(), file_result.warnings.end());
     
     // Metadata validation
-    if (required_level >= SecurityLevel::Basic) {
-        auto metadata_result = validate_metadata(file_path);
-        if (!metadata_result.is_valid) {
-            result.errors.insert(result.errors.end(), metadata_result.errors.begin(), metadata_result.errors.end());
-            m_validations_failed.fetch_add(1);
-            return result;
-        }
-        result.warnings.insert(result.warnings.end(), metadata_result.warnings.begin(), metadata_result.warnings.end());
+    if (required_level >= SecurityLevel::Basic && !merge_check(result, validate_metadata(file_path))) {
+        return false;
     }
-    
+    return true;
+}
+
+bool SecurityManager::run_hash_stage(const std::filesystem::path& file_path, SecurityLevel required_level,
+                                     SecurityValidationResult& result) const {
     // Signature validation
     if (required_level >= SecurityLevel::Standard && m_signature_verification_enabled) {
-        auto signature_result = validate_signature(file_path);
-        if (!signature_result.is_valid) {
-            result.errors.insert(result.errors.end(), signature_result.errors.begin(), signature_result.errors.end());
-            m_validations_failed.fetch_add(1);
-            return result;
+        if (!merge_check(result, validate_signature(file_path))) {
+            return false;
         }
         result.validated_level = SecurityLevel::Standard;
-        result.warnings.insert(result.warnings.end(), signature_result.warnings.begin(), signature_result.warnings.end());
     }
     
     // Permission validation
     if (required_level >= SecurityLevel::Strict) {
-        auto permission_result = validate_permissions(file_path);
-        if (!permission_result.is_valid) {
-            result.errors.insert(result.errors.end(), permission_result.errors.begin(), permission_result.errors.end());
-            m_validations_failed.fetch_add(1);
-            return result;
+        if (!merge_check(result, validate_permissions(file_path))) {
+            return false;
         }
         result.validated_level = SecurityLevel::Strict;
-        result.warnings.insert(result.warnings.end(), permission_result.warnings.begin(), permission_result.warnings.end());
+    }
+
+    if (!result.file_identity || identify_file(file_path) != result.file_identity) {
+        result.errors.push_back("Plugin file changed during validation");
+        return false;
     }
     
     result.is_valid = true;
-    m_validations_passed.fetch_add(1);
-    
-    return result;
+    return true;
+}
+
+void SecurityManager::record_validation(const SecurityValidationResult& result) const {
+    if (result.is_valid) {
+        m_validations_passed.fetch_add(1);
+    } else {
+        m_validations_failed.fetch_add(1);
+    }
 }
 
 bool SecurityManager::is_trusted(std::string_view plugin_id) const {
@@ -115,10 +219,43 @@ QJsonObject SecurityManager::security_statistics() const {
         {"validations_failed", static_cast<qint64>(m_validations_failed.load())},
         {"trusted_plugins_count", static_cast<int>(m_trusted_plugins.size())},
         {"current_security_level", security_level_to_string(m_security_level)},
-        {"signature_verification_enabled", m_signature_verification_enabled}
+        {"signature_verification_enabled", m_signature_verification_enabled},
+        {"digest_cache_hits", static_cast<qint64>(m_digest_cache_hits.load())},
+        {"digest_cache_misses", static_cast<qint64>(m_digest_cache_misses.load())}
     };
 }
 
+void SecurityManager::invalidate_file(const std::filesystem::path& file_path) {
+    std::lock_guard lock(m_digest_cache_mutex);
+    m_digest_cache.erase(file_path.string());
+}
+
+qtplugin::expected<QByteArray, PluginError> SecurityManager::file_digest(const std::filesystem::path& file_path) const {
+    const std::string key = file_path.string();
+    const auto identity = identify_file(file_path);
+    if (identity) {
+        std::lock_guard lock(m_digest_cache_mutex);
+        auto it = m_digest_cache.find(key);
+        if (it != m_digest_cache.end() && it->second.identity == *identity) {
+            m_digest_cache_hits.fetch_add(1);
+            return it->second.sha256;
+        }
+    }
+
+    m_digest_cache_misses.fetch_add(1);
+    auto digest = file_sha256(file_path);
+    if (!digest) {
+        return digest;
+    }
+
+    // A file rewritten while it was hashed is not cached
+    if (identity && identify_file(file_path) == identity) {
+        std::lock_guard lock(m_digest_cache_mutex);
+        m_digest_cache.insert_or_assign(key, CachedDigest{*identity, digest.value()});
+    }
+    return digest;
+}
+
 qtplugin::expected<void, PluginError> SecurityManager::load_trusted_plugins(const std::filesystem::path& file_path) {
     if (!std::filesystem::exists(file_path)) {
         return make_error<void>(PluginErrorCode::FileNotFound, "Trusted plugins file not found");
@@ -218,6 +355,7 @@ bool SecurityManager::is_signature_verification_enabled() const noexcept {
 }
 
 SecurityValidationResult SecurityManager::validate_file_integrity(const std::filesystem::path& file_path) const {
+    QTPLUGIN_TRACE_SCOPE("security", "validate_file_integrity");
     SecurityValidationResult result;
     
     if (!is_safe_file_path(file_path)) {
@@ -262,6 +400,7 @@ SecurityValidationResult SecurityManager::validate_file_integrity(const std::fil
 }
 
 SecurityValidationResult SecurityManager::validate_metadata(const std::filesystem::path& file_path) const {
+    QTPLUGIN_TRACE_SCOPE("security", "validate_metadata");
     SecurityValidationResult result;
     result.is_valid = false;
 
@@ -272,14 +411,13 @@ SecurityValidationResult SecurityManager::validate_metadata(const std::filesyste
             return result;
         }
 
-        // Load plugin to extract metadata
-        QPluginLoader loader(QString::fromStdString(file_path.string()));
-        QJsonObject metadata = loader.metaData();
-
-        if (metadata.isEmpty()) {
-            result.errors.push_back("Failed to load plugin metadata");
+        // Read metadata straight from the file; the library is never loaded
+        auto metadata_result = read_qt_plugin_metadata(file_path);
+        if (!metadata_result) {
+            result.errors.push_back("Failed to load plugin metadata: " + metadata_result.error().message);
             return result;
         }
+        const QJsonObject& metadata = metadata_result.value();
 
         // Validate required metadata fields
         QJsonObject plugin_metadata = metadata["MetaData"].toObject();
@@ -376,6 +514,7 @@ SecurityValidationResult SecurityManager::validate_metadata(const std::filesyste
 }
 
 SecurityValidationResult SecurityManager::validate_signature(const std::filesystem::path& file_path) const {
+    QTPLUGIN_TRACE_SCOPE("security", "validate_signature");
     SecurityValidationResult result;
     result.is_valid = false;
 
@@ -407,8 +546,8 @@ SecurityValidationResult SecurityManager::validate_signature(const std::filesyst
         bool has_signature_file = std::filesystem::exists(sig_file);
 
         // Look for embedded signature in plugin metadata
-        QPluginLoader loader(QString::fromStdString(file_path.string()));
-        QJsonObject metadata = loader.metaData();
+        auto metadata_result = read_qt_plugin_metadata(file_path);
+        QJsonObject metadata = metadata_result ? metadata_result.value() : QJsonObject();
         bool has_embedded_signature = false;
 
         if (!metadata.isEmpty()) {
@@ -434,19 +573,19 @@ SecurityValidationResult SecurityManager::validate_signature(const std::filesyst
             if (plugin_metadata.contains("checksum")) {
                 QString expected_checksum = plugin_metadata["checksum"].toString();
                 if (!expected_checksum.isEmpty()) {
-                    // Calculate actual file checksum (simplified implementation)
-                    QFile file(QString::fromStdString(file_path.string()));
-                    if (file.open(QIODevice::ReadOnly)) {
-                        QCryptographicHash hash(QCryptographicHash::Sha256);
-                        hash.addData(file.readAll());
-                        QString actual_checksum = hash.result().toHex();
-
-                        if (actual_checksum.toLower() != expected_checksum.toLower()) {
-                            result.errors.push_back("File checksum verification failed");
-                            return result;
-                        } else {
-                            result.details["checksum_verified"] = true;
-                        }
+                    // Unchanged files are not hashed again, e.g. on reload
+                    auto digest = file_digest(file_path);
+                    if (!digest) {
+                        result.errors.push_back("File checksum verification failed: " + digest.error().message);
+                        return result;
+                    }
+                    QString actual_checksum = QString::fromLatin1(digest.value().toHex());
+
+                    if (actual_checksum.toLower() != expected_checksum.toLower()) {
+                        result.errors.push_back("File checksum verification failed");
+                        return result;
+                    } else {
+                        result.details["checksum_verified"] = true;
                     }
                 }
             }
@@ -474,6 +613,7 @@ SecurityValidationResult SecurityManager::validate_signature(const std::filesyst
 }
 
 SecurityValidationResult SecurityManager::validate_permissions(const std::filesystem::path& file_path) const {
+    QTPLUGIN_TRACE_SCOPE("security", "validate_permissions");
     SecurityValidationResult result;
     result.is_valid = false;
 
@@ -502,8 +642,8 @@ SecurityValidationResult SecurityManager::validate_permissions(const std::filesy
         }
 
         // Load plugin metadata to check requested permissions
-        QPluginLoader loader(QString::fromStdString(file_path.string()));
-        QJsonObject metadata = loader.metaData();
+        auto metadata_result = read_qt_plugin_metadata(file_path);
+        QJsonObject metadata = metadata_result ? metadata_result.value() : QJsonObject();
 
         if (!metadata.isEmpty()) {
             QJsonObject plugin_metadata = metadata["MetaData"].toObject();
@@ -0,0 +1,157 @@
+/**
+ * @file epoch.cpp
+ * @brief Implementation of epoch-based reader tracking
+ * @version 3.0.0
+ */
+
+#include "qtplugin/utils/epoch.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace qtplugin {
+
+namespace {
+
+// Innermost live guard on this thread, linked through EpochGuard::m_previous
+thread_local EpochGuard* t_innermost_guard = nullptr;
+
+std::uint32_t this_thread_slot() noexcept {
+    static std::atomic<std::uint32_t> next_slot{0};
+    thread_local const std::uint32_t slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+} // namespace
+
+// EpochGuard implementation
+
+EpochGuard::EpochGuard(const EpochDomain& domain) noexcept
+    : m_domain(&domain), m_previous(t_innermost_guard) {
+    m_phase = domain.enter_slot(m_slot);
+    t_innermost_guard = this;
+}
+
+EpochGuard::~EpochGuard() {
+    release();
+}
+
+EpochGuard::EpochGuard(EpochGuard&& other) noexcept
+    : m_domain(other.m_domain), m_previous(other.m_previous),
+      m_phase(other.m_phase), m_slot(other.m_slot) {
+    if (m_domain && t_innermost_guard == &other) {
+        t_innermost_guard = this;
+    }
+    other.m_domain = nullptr;
+}
+
+EpochGuard& EpochGuard::operator=(EpochGuard&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_domain = other.m_domain;
+        m_previous = other.m_previous;
+        m_phase = other.m_phase;
+        m_slot = other.m_slot;
+        if (m_domain && t_innermost_guard == &other) {
+            t_innermost_guard = this;
+        }
+        other.m_domain = nullptr;
+    }
+    return *this;
+}
+
+void EpochGuard::release() noexcept {
+    if (!m_domain) {
+        return;
+    }
+    m_domain->leave_slot(m_phase, m_slot);
+    if (t_innermost_guard == this) {
+        t_innermost_guard = m_previous;
+    }
+    m_domain = nullptr;
+}
+
+// EpochDomain implementation
+
+EpochDomain::EpochDomain() noexcept = default;
+
+std::uint32_t EpochDomain::enter_slot(std::uint32_t& slot) const noexcept {
+    slot = this_thread_slot() % slot_count;
+    const auto phase = m_phase.load(std::memory_order_seq_cst);
+    // seq_cst orders the increment before any load of the protected resource
+    m_slots[phase][slot].readers.fetch_add(1, std::memory_order_seq_cst);
+    return phase;
+}
+
+void EpochDomain::leave_slot(std::uint32_t phase, std::uint32_t slot) const noexcept {
+    m_slots[phase][slot].readers.fetch_sub(1, std::memory_order_release);
+}
+
+bool EpochDomain::wait_for_phase(std::uint32_t phase,
+                                 std::chrono::steady_clock::time_point deadline) const {
+    auto backoff = std::chrono::microseconds(0);
+    for (;;) {
+        std::int64_t readers = 0;
+        for (const auto& slot : m_slots[phase]) {
+            readers += slot.readers.load(std::memory_order_seq_cst);
+        }
+        if (readers == 0) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+
+        // Readers are expected to be short; spin briefly, then back off
+        if (backoff.count() == 0) {
+            std::this_thread::yield();
+            backoff = std::chrono::microseconds(50);
+        } else {
+            std::this_thread::sleep_for(backoff);
+            backoff = std::min(backoff * 2, std::chrono::microseconds(1000));
+        }
+    }
+}
+
+bool EpochDomain::synchronize_until(std::chrono::steady_clock::time_point deadline) {
+    std::lock_guard lock(m_writer_mutex);
+
+    const auto current = m_phase.load(std::memory_order_relaxed);
+
+    // Readers that loaded the inactive phase before the previous flip may not
+    // have incremented yet; drain them before reusing that phase
+    if (!wait_for_phase(current ^ 1u, deadline)) {
+        return false;
+    }
+
+    m_phase.store(current ^ 1u, std::memory_order_seq_cst);
+    return wait_for_phase(current, deadline);
+}
+
+void EpochDomain::synchronize() {
+    synchronize_until(std::chrono::steady_clock::time_point::max());
+}
+
+bool EpochDomain::try_synchronize(std::chrono::milliseconds timeout) {
+    return synchronize_until(std::chrono::steady_clock::now() + timeout);
+}
+
+bool EpochDomain::in_read_section() const noexcept {
+    for (const auto* guard = t_innermost_guard; guard; guard = guard->m_previous) {
+        if (guard->m_domain == this) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::size_t EpochDomain::active_readers() const noexcept {
+    std::int64_t readers = 0;
+    for (const auto& phase : m_slots) {
+        for (const auto& slot : phase) {
+            readers += slot.readers.load(std::memory_order_relaxed);
+        }
+    }
+    return readers > 0 ? static_cast<std::size_t>(readers) : 0;
+}
+
+} // namespace qtplugin
@@ -0,0 +1,118 @@
+/**
+ * @file file_fingerprint.cpp
+ * @brief Implementation of file fingerprints
+ * @version 3.0.0
+ */
+
+#include "qtplugin/utils/file_fingerprint.hpp"
+#include "qtplugin/utils/trace.hpp"
+#include <QCryptographicHash>
+#include <QFile>
+#include <chrono>
+#include <system_error>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace qtplugin {
+
+namespace {
+
+// Fixed-size reads keep memory use flat regardless of the file size
+constexpr qint64 digest_chunk_size = qint64{1} << 20;
+
+} // namespace
+
+std::optional<FileFingerprint> fingerprint_file(const std::filesystem::path& file_path) noexcept {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(file_path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const auto modified = std::filesystem::last_write_time(file_path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    FileFingerprint fingerprint;
+    fingerprint.size = static_cast<std::uint64_t>(size);
+    fingerprint.modified_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        modified.time_since_epoch()).count();
+    return fingerprint;
+}
+
+std::optional<FileIdentity> identify_file(const std::filesystem::path& file_path) noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat status {};
+    if (::stat(file_path.c_str(), &status) != 0 || !S_ISREG(status.st_mode)) {
+        return std::nullopt;
+    }
+
+#if defined(__APPLE__)
+    const auto& modified = status.st_mtimespec;
+    const auto& changed = status.st_ctimespec;
+#else
+    const auto& modified = status.st_mtim;
+    const auto& changed = status.st_ctim;
+#endif
+    auto to_ns = [](const timespec& time) {
+        return static_cast<std::int64_t>(time.tv_sec) * 1'000'000'000 + static_cast<std::int64_t>(time.tv_nsec);
+    };
+
+    FileIdentity identity;
+    identity.device = static_cast<std::uint64_t>(status.st_dev);
+    identity.inode = static_cast<std::uint64_t>(status.st_ino);
+    identity.size = static_cast<std::uint64_t>(status.st_size);
+    identity.modified_ns = to_ns(modified);
+    identity.changed_ns = to_ns(changed);
+    return identity;
+#else
+    auto fingerprint = fingerprint_file(file_path);
+    if (!fingerprint) {
+        return std::nullopt;
+    }
+    FileIdentity identity;
+    identity.size = fingerprint->size;
+    identity.modified_ns = fingerprint->modified_ns;
+    return identity;
+#endif
+}
+
+qtplugin::expected<QByteArray, PluginError> file_sha256(const std::filesystem::path& file_path) {
+    QTPLUGIN_TRACE_SCOPE("security", "sha256_file", file_path);
+    QFile file(QString::fromStdString(file_path.string()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return make_error<QByteArray>(PluginErrorCode::FileNotFound, "Cannot open plugin file: " + file_path.string());
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    std::vector<char> chunk(static_cast<std::size_t>(digest_chunk_size));
+    for (;;) {
+        const qint64 count = file.read(chunk.data(), digest_chunk_size);
+        if (count < 0) {
+            return make_error<QByteArray>(PluginErrorCode::FileSystemError,
+                                          "Cannot read plugin file: " + file_path.string());
+        }
+        if (count == 0) {
+            break;
+        }
+        hash.addData(QByteArrayView(chunk.data(), count));
+    }
+    return hash.result();
+}
+
+bool is_user_private_file(const std::filesystem::path& file_path) noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat status {};
+    return ::lstat(file_path.c_str(), &status) == 0 && S_ISREG(status.st_mode) && status.st_uid == ::geteuid() &&
+           (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+#else
+    std::error_code ec;
+    return std::filesystem::is_regular_file(std::filesystem::symlink_status(file_path, ec));
+#endif
+}
+
+} // namespace qtplugin
@@ -0,0 +1,119 @@
+/**
+ * @file id_interner.cpp
+ * @brief Implementation of the process-wide identifier interner
+ * @version 3.0.0
+ */
+
+#include "qtplugin/utils/id_interner.hpp"
+#include <mutex>
+#include <stdexcept>
+
+namespace qtplugin {
+
+IdInterner& IdInterner::instance() {
+    static IdInterner interner;
+    return interner;
+}
+
+IdInterner::Index::Index(std::size_t capacity)
+    : mask(capacity - 1), cells(std::make_unique<std::atomic<std::uint32_t>[]>(capacity)) {}
+
+SymbolId IdInterner::intern(std::string_view value) {
+    if (auto known = find(value)) {
+        return *known;
+    }
+
+    std::lock_guard lock(m_mutex);
+    if (auto known = find(value)) {
+        return *known;
+    }
+
+    const auto index = m_size.load(std::memory_order_relaxed);
+    const auto chunk = index >> chunk_bits;
+    if (chunk >= max_chunks) {
+        throw std::length_error("IdInterner capacity exhausted");
+    }
+    if (!m_chunk_storage[chunk]) {
+        m_chunk_storage[chunk] = std::make_unique<Entry[]>(chunk_size);
+        m_chunks[chunk].store(m_chunk_storage[chunk].get(), std::memory_order_release);
+    }
+
+    auto& entry = m_chunk_storage[chunk][index & (chunk_size - 1)];
+    entry.name.assign(value);
+    entry.qname = QString::fromStdString(entry.name);
+
+    // The entry is published before the cell that leads readers to it
+    const SymbolId symbol(static_cast<std::uint32_t>(index));
+    m_size.store(index + 1, std::memory_order_release);
+    index_symbol(symbol);
+    return symbol;
+}
+
+void IdInterner::index_symbol(SymbolId symbol) {
+    Index* index = m_index.load(std::memory_order_relaxed);
+    const std::size_t count = symbol.value() + 1;
+    if (index && count * 2 <= index->mask + 1) {
+        insert_cell(*index, name(symbol), symbol);
+        return;
+    }
+
+    // Grow at half load: build a larger index holding every symbol, then
+    // swap it in. The old one stays alive for readers still probing it
+    std::size_t capacity = index ? (index->mask + 1) * 2 : 64;
+    while (count * 2 > capacity) {
+        capacity *= 2;
+    }
+    auto grown = std::make_unique<Index>(capacity);
+    for (std::uint32_t value = 0; value < count; ++value) {
+        insert_cell(*grown, name(SymbolId(value)), SymbolId(value));
+    }
+    m_indexes.push_back(std::move(grown));
+    m_index.store(m_indexes.back().get(), std::memory_order_release);
+}
+
+void IdInterner::insert_cell(Index& index, std::string_view value, SymbolId symbol) noexcept {
+    for (std::size_t cell = TransparentStringHash{}(value) & index.mask;; cell = (cell + 1) & index.mask) {
+        if (index.cells[cell].load(std::memory_order_relaxed) == 0) {
+            index.cells[cell].store(symbol.value() + 1, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+std::optional<SymbolId> IdInterner::find(std::string_view value) const {
+    const Index* index = m_index.load(std::memory_order_acquire);
+    if (!index) {
+        return std::nullopt;
+    }
+    for (std::size_t cell = TransparentStringHash{}(value) & index->mask;; cell = (cell + 1) & index->mask) {
+        const auto stored = index->cells[cell].load(std::memory_order_acquire);
+        if (stored == 0) {
+            return std::nullopt;
+        }
+        const SymbolId symbol(stored - 1);
+        if (name(symbol) == value) {
+            return symbol;
+        }
+    }
+}
+
+const IdInterner::Entry* IdInterner::entry(SymbolId symbol) const noexcept {
+    if (!symbol.is_valid() || symbol.value() >= size()) {
+        return nullptr;
+    }
+    const auto* chunk = m_chunks[symbol.value() >> chunk_bits].load(std::memory_order_acquire);
+    return &chunk[symbol.value() & (chunk_size - 1)];
+}
+
+std::string_view IdInterner::name(SymbolId symbol) const noexcept {
+    const auto* found = entry(symbol);
+    return found ? std::string_view(found->name) : std::string_view();
+}
+
+const QString& IdInterner::qname(SymbolId symbol) const noexcept {
+    static const QString empty;
+    const auto* found = entry(symbol);
+    return found ? found->qname : empty;
+}
+
+} // namespace qtplugin
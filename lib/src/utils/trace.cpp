@@ -0,0 +1,154 @@
+/**
+ * @file trace.cpp
+ * @brief Implementation of the trace recorder and Chrome trace export
+ * @version 3.0.0
+ */
+
+#include "qtplugin/utils/trace.hpp"
+#include <QCoreApplication>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QString>
+
+namespace qtplugin {
+
+struct TraceRecorder::ThreadBuffer {
+    // Only contended while exporting or clearing
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::size_t dropped = 0;
+    std::uint64_t thread_id = 0;
+    std::string thread_name;
+};
+
+TraceRecorder::TraceRecorder() : m_origin(std::chrono::steady_clock::now()) {}
+
+TraceRecorder& TraceRecorder::instance() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::this_thread_buffer() {
+    // The recorder keeps the buffer alive after the thread exits
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [this] {
+        auto created = std::make_shared<ThreadBuffer>();
+        std::lock_guard lock(m_buffers_mutex);
+        created->thread_id = m_buffers.size() + 1;
+        m_buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+void TraceRecorder::set_thread_name(std::string_view name) {
+    auto& buffer = this_thread_buffer();
+    std::lock_guard lock(buffer.mutex);
+    buffer.thread_name.assign(name);
+}
+
+void TraceRecorder::record(TraceEvent event) {
+    auto& buffer = this_thread_buffer();
+    std::lock_guard lock(buffer.mutex);
+    if (buffer.events.size() >= max_events_per_thread) {
+        ++buffer.dropped;
+        return;
+    }
+    buffer.events.push_back(std::move(event));
+}
+
+std::int64_t TraceRecorder::now_ns() const noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_origin).count();
+}
+
+void TraceRecorder::clear() {
+    std::lock_guard lock(m_buffers_mutex);
+    for (const auto& buffer : m_buffers) {
+        std::lock_guard buffer_lock(buffer->mutex);
+        buffer->events.clear();
+        buffer->dropped = 0;
+    }
+}
+
+std::size_t TraceRecorder::event_count() const {
+    std::lock_guard lock(m_buffers_mutex);
+    std::size_t count = 0;
+    for (const auto& buffer : m_buffers) {
+        std::lock_guard buffer_lock(buffer->mutex);
+        count += buffer->events.size();
+    }
+    return count;
+}
+
+std::size_t TraceRecorder::dropped_count() const {
+    std::lock_guard lock(m_buffers_mutex);
+    std::size_t count = 0;
+    for (const auto& buffer : m_buffers) {
+        std::lock_guard buffer_lock(buffer->mutex);
+        count += buffer->dropped;
+    }
+    return count;
+}
+
+QJsonDocument TraceRecorder::to_chrome_trace() const {
+    const auto pid = static_cast<qint64>(QCoreApplication::applicationPid());
+    QJsonArray trace_events;
+
+    std::lock_guard lock(m_buffers_mutex);
+    for (const auto& buffer : m_buffers) {
+        std::lock_guard buffer_lock(buffer->mutex);
+        const auto tid = static_cast<qint64>(buffer->thread_id);
+
+        QJsonObject thread_name;
+        thread_name["ph"] = "M";
+        thread_name["name"] = "thread_name";
+        thread_name["pid"] = pid;
+        thread_name["tid"] = tid;
+        QJsonObject thread_args;
+        thread_args["name"] = buffer->thread_name.empty()
+            ? QString("thread %1").arg(tid)
+            : QString::fromStdString(buffer->thread_name);
+        thread_name["args"] = thread_args;
+        trace_events.append(thread_name);
+
+        for (const auto& event : buffer->events) {
+            QJsonObject json;
+            json["ph"] = "X";
+            json["cat"] = QString::fromUtf8(event.category);
+            json["name"] = QString::fromUtf8(event.name);
+            json["pid"] = pid;
+            json["tid"] = tid;
+            // Chrome traces use microseconds
+            json["ts"] = static_cast<double>(event.start_ns) / 1000.0;
+            json["dur"] = static_cast<double>(event.duration_ns) / 1000.0;
+            if (!event.detail.empty()) {
+                QJsonObject args;
+                args["detail"] = QString::fromStdString(event.detail);
+                json["args"] = args;
+            }
+            trace_events.append(json);
+        }
+    }
+
+    QJsonObject root;
+    root["traceEvents"] = trace_events;
+    root["displayTimeUnit"] = "ms";
+    return QJsonDocument(root);
+}
+
+qtplugin::expected<void, PluginError> TraceRecorder::export_chrome_trace(const std::filesystem::path& file_path) const {
+    QSaveFile file(QString::fromStdString(file_path.string()));
+    if (!file.open(QIODevice::WriteOnly)) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                                "Cannot write trace file: " + file_path.string());
+    }
+    file.write(to_chrome_trace().toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        return make_error<void>(PluginErrorCode::FileSystemError,
+                                "Cannot write trace file: " + file_path.string());
+    }
+    return make_success();
+}
+
+} // namespace qtplugin
@@ -9,10 +9,14 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QThread>
+#include <atomic>
 #include <memory>
 #include <filesystem>
+#include <string>
 
 #include "qtplugin/managers/configuration_manager_impl.hpp"
+#include "qtplugin/utils/id_interner.hpp"
 
 class ConfigurationManagerTest : public QObject
 {
@@ -30,6 +34,9 @@ private slots:
     void testDefaultValues();
     void testKeyExistence();
     void testRemoveKey();
+    void testKeyHandles();
+    void testKeysStayOutOfInterner();
+    void testSnapshots();
 
     // Scope tests
     void testDifferentScopes();
@@ -49,6 +56,8 @@ private slots:
     void testSaveLoad();
     void testReload();
     void testAutoPersist();
+    void testWriteBehindPersistence();
+    void testSavedSignalOnManagerThread();
 
     // Integration tests
     void testConfigurationManager();
@@ -184,6 +193,114 @@ void ConfigurationManagerTest::testRemoveKey()
     QVERIFY(!remove_nonexistent.has_value());
 }
 
+void ConfigurationManagerTest::testKeyHandles()
+{
+    using namespace qtplugin;
+
+    // Handles and dotted keys address the same values
+    const ConfigKey timeout("network.http.timeout");
+    QCOMPARE(timeout.segments().size(), std::size_t(3));
+    QVERIFY(m_config_manager->set_value(timeout, QJsonValue(30)).has_value());
+
+    auto value_result = m_config_manager->get_value("network.http.timeout");
+    QVERIFY(value_result.has_value());
+    QCOMPARE(value_result.value().toInt(), 30);
+
+    QVERIFY(m_config_manager->set_value("network.http.timeout", QJsonValue(60)).has_value());
+    auto handle_result = m_config_manager->get_value(timeout);
+    QVERIFY(handle_result.has_value());
+    QCOMPARE(handle_result.value().toInt(), 60);
+
+    // Members of an object value are addressable by nested keys
+    QJsonObject proxy;
+    proxy["host"] = "localhost";
+    proxy["port"] = 8080;
+    QVERIFY(m_config_manager->set_value(ConfigKey("network.proxy"), proxy).has_value());
+    auto port_result = m_config_manager->get_value(ConfigKey("network.proxy.port"));
+    QVERIFY(port_result.has_value());
+    QCOMPARE(port_result.value().toInt(), 8080);
+
+    auto network_result = m_config_manager->get_value("network");
+    QVERIFY(network_result.has_value());
+    QCOMPARE(network_result.value().toObject()["proxy"].toObject(), proxy);
+
+    // Missing keys and paths through values are not found
+    QVERIFY(!m_config_manager->get_value(ConfigKey("network.http.retries")).has_value());
+    QVERIFY(!m_config_manager->get_value(ConfigKey("network.http.timeout.value")).has_value());
+    QVERIFY(!m_config_manager->set_value(ConfigKey(), QJsonValue(1)).has_value());
+
+    QVERIFY(m_config_manager->remove_key("network.proxy.host").has_value());
+    QVERIFY(!m_config_manager->get_value(ConfigKey("network.proxy.host")).has_value());
+    QVERIFY(m_config_manager->get_value(ConfigKey("network.proxy.port")).has_value());
+}
+
+void ConfigurationManagerTest::testKeysStayOutOfInterner()
+{
+    using namespace qtplugin;
+
+    const auto interned = IdInterner::instance().size();
+
+    // Data-driven keys live in the configuration, not the process-wide interner
+    QJsonObject imported;
+    for (int i = 0; i < 100; ++i) {
+        imported[QString("imported_%1").arg(i)] = i;
+    }
+    QVERIFY(m_config_manager->set_configuration(imported).has_value());
+    for (int i = 0; i < 100; ++i) {
+        const std::string key = "written.key_" + std::to_string(i);
+        QVERIFY(m_config_manager->set_value(key, QJsonValue(i)).has_value());
+        QVERIFY(m_config_manager->set_value(ConfigKey("handle." + std::to_string(i)), QJsonValue(i)).has_value());
+        QVERIFY(!m_config_manager->get_value("lookup.unknown_" + std::to_string(i)).has_value());
+        QVERIFY(!m_config_manager->remove_key("lookup.unknown_" + std::to_string(i)).has_value());
+    }
+    QCOMPARE(IdInterner::instance().size(), interned);
+
+    // They are found, removed and exported by name
+    QCOMPARE(m_config_manager->get_value("written.key_42").value().toInt(), 42);
+    QCOMPARE(m_config_manager->get_value(ConfigKey("imported_7")).value().toInt(), 7);
+    QVERIFY(m_config_manager->remove_key("written.key_42").has_value());
+    QVERIFY(!m_config_manager->has_key("written.key_42"));
+    auto exported = m_config_manager->get_configuration();
+    QVERIFY(exported.has_value());
+    QCOMPARE(exported.value()["handle"].toObject()["99"].toInt(), 99);
+}
+
+void ConfigurationManagerTest::testSnapshots()
+{
+    using namespace qtplugin;
+
+    QVERIFY(m_config_manager->set_value("snapshot.first", QJsonValue(1)).has_value());
+    QVERIFY(m_config_manager->set_value("snapshot.second", QJsonValue(2)).has_value());
+
+    auto before_result = m_config_manager->snapshot();
+    QVERIFY(before_result.has_value());
+    auto before = before_result.value();
+
+    // Later changes publish a new version and leave the snapshot untouched
+    QVERIFY(m_config_manager->set_value("snapshot.first", QJsonValue(10)).has_value());
+    QVERIFY(m_config_manager->remove_key("snapshot.second").has_value());
+
+    QCOMPARE(before->get_value("snapshot.first").value().toInt(), 1);
+    QCOMPARE(before->get_value(ConfigKey("snapshot.second")).value().toInt(), 2);
+
+    auto after_result = m_config_manager->snapshot();
+    QVERIFY(after_result.has_value());
+    auto after = after_result.value();
+    QVERIFY(after->version() > before->version());
+    QCOMPARE(after->get_value("snapshot.first").value().toInt(), 10);
+    QVERIFY(!after->has_key("snapshot.second"));
+    QCOMPARE(after->get_value_or_default("snapshot.second", QJsonValue(-1)).toInt(), -1);
+
+    // Scopes are versioned independently
+    QVERIFY(m_config_manager->set_value("snapshot.user", QJsonValue(true), ConfigurationScope::User).has_value());
+    auto global_result = m_config_manager->snapshot();
+    QVERIFY(global_result.has_value());
+    QCOMPARE(global_result.value()->version(), after->version());
+
+    // A plugin scope that was never written has no snapshot
+    QVERIFY(!m_config_manager->snapshot(ConfigurationScope::Plugin, "snapshot.missing").has_value());
+}
+
 void ConfigurationManagerTest::testDifferentScopes()
 {
     using namespace qtplugin;
@@ -466,6 +583,72 @@ void ConfigurationManagerTest::testAutoPersist()
     QVERIFY(m_config_manager->is_auto_persist_enabled());
 }
 
+void ConfigurationManagerTest::testWriteBehindPersistence()
+{
+    using namespace qtplugin;
+
+    // Point the User scope at a temporary file
+    QFile file(QString::fromStdString(m_test_config_path.string()));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("{}");
+    file.close();
+    QVERIFY(m_config_manager->load_from_file(m_test_config_path, ConfigurationScope::User).has_value());
+
+    // A bulk update is written once or twice, not once per key
+    const auto writes_before = m_config_manager->get_statistics()["persist_writes"].toInteger();
+    for (int i = 0; i < 1000; ++i) {
+        QVERIFY(m_config_manager->set_value(QString("bulk.key%1").arg(i).toStdString(), QJsonValue(i),
+                                            ConfigurationScope::User).has_value());
+    }
+    m_config_manager->flush_pending_writes();
+
+    const auto stats = m_config_manager->get_statistics();
+    QVERIFY(stats["persist_writes"].toInteger() - writes_before <= 2);
+    QCOMPARE(stats["pending_writes"].toInteger(), qint64(0));
+
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    auto saved = QJsonDocument::fromJson(file.readAll()).object();
+    file.close();
+    QCOMPARE(saved["bulk"].toObject().size(), 1000);
+    QCOMPARE(saved["bulk"].toObject()["key999"].toInt(), 999);
+
+    // Pending changes are written on shutdown
+    QVERIFY(m_config_manager->set_value("last", QJsonValue("written"), ConfigurationScope::User).has_value());
+    m_config_manager.reset();
+
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    saved = QJsonDocument::fromJson(file.readAll()).object();
+    QCOMPARE(saved["last"].toString(), QString("written"));
+}
+
+void ConfigurationManagerTest::testSavedSignalOnManagerThread()
+{
+    using namespace qtplugin;
+
+    auto* manager = dynamic_cast<ConfigurationManager*>(m_config_manager.get());
+    QVERIFY(manager != nullptr);
+    manager->set_persist_delay(std::chrono::milliseconds(10));
+
+    QFile file(QString::fromStdString(m_test_config_path.string()));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("{}");
+    file.close();
+    QVERIFY(manager->load_from_file(m_test_config_path, ConfigurationScope::User).has_value());
+
+    std::atomic<int> saved{0};
+    std::atomic<QThread*> saved_thread{nullptr};
+    connect(manager, &ConfigurationManager::configuration_saved, manager,
+            [&saved, &saved_thread](int, const QString&) {
+                saved_thread = QThread::currentThread();
+                ++saved;
+            }, Qt::DirectConnection);
+
+    // The persister writes in the background, the signal arrives on this thread
+    QVERIFY(manager->set_value("background", QJsonValue(true), ConfigurationScope::User).has_value());
+    QTRY_VERIFY(saved.load() > 0);
+    QCOMPARE(saved_thread.load(), QThread::currentThread());
+}
+
 void ConfigurationManagerTest::testConfigurationManager()
 {
     // Test configuration manager statistics
@@ -3,15 +3,28 @@
 #include <QElapsedTimer>
 #include <QThread>
 #include <QDebug>
+#include <QCborMap>
+#include <QCborValue>
+#include <QJsonObject>
+#include <QPluginLoader>
+#include <QTemporaryDir>
+#include <QtEndian>
 #include <memory>
 #include <vector>
 #include <chrono>
+#include <filesystem>
+#include <limits>
 
 // Include the plugin system headers
 #include "qtplugin/core/plugin_manager.hpp"
+#include "qtplugin/core/plugin_metadata_reader.hpp"
+#ifdef Q_OS_LINUX
+#include "qtplugin/platform/platform_plugin_loader.hpp"
+#endif
 #include "qtplugin/managers/configuration_manager_impl.hpp"
 #include "qtplugin/communication/message_bus.hpp"
 #include "qtplugin/communication/message_types.hpp"
+#include "qtplugin/security/security_manager.hpp"
 
 class PerformanceTests : public QObject
 {
@@ -25,9 +38,14 @@ private slots:
     void testPluginLoadingPerformance();
     void testMultiplePluginLoadingPerformance();
     void testPluginUnloadingPerformance();
+    void testMetadataReadPerformance();
+    void testBatchValidationPerformance();
+    void testPlatformLoadingStrategies();
     
     // Configuration performance tests
     void testConfigurationReadPerformance();
+    void testConfigurationKeyHandlePerformance();
+    void testConfigurationSnapshotReadPerformance();
     void testConfigurationWritePerformance();
     void testLargeConfigurationPerformance();
     
@@ -49,6 +67,7 @@ private:
     // Performance measurement helpers
     void measureExecutionTime(const QString& testName, std::function<void()> testFunction);
     void logPerformanceResult(const QString& testName, qint64 elapsedMs, const QString& details = QString());
+    QByteArray syntheticPluginImage(int index) const;
 };
 
 void PerformanceTests::initTestCase()
@@ -117,6 +136,147 @@ void PerformanceTests::testPluginUnloadingPerformance()
     });
 }
 
+void PerformanceTests::testMetadataReadPerformance()
+{
+    const int fileCount = 1000;
+    QTemporaryDir corpus;
+    QVERIFY(corpus.isValid());
+
+    QStringList files;
+    for (int i = 0; i < fileCount; ++i) {
+        const QString path = corpus.filePath(QString("libplugin_%1.so").arg(i));
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(syntheticPluginImage(i));
+        files.append(path);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    std::vector<QJsonObject> mapped;
+    mapped.reserve(fileCount);
+    for (const auto& path : files) {
+        auto result = qtplugin::read_qt_plugin_metadata(path.toStdString());
+        QVERIFY2(result.has_value(), path.toLocal8Bit());
+        mapped.push_back(result.value());
+    }
+    const qint64 mappedElapsed = timer.elapsed();
+
+    timer.restart();
+    int loaderParsed = 0;
+    for (int i = 0; i < fileCount; ++i) {
+        QPluginLoader loader(files[i]);
+        const QJsonObject metadata = loader.metaData();
+        // Qt may reject the synthetic image for a foreign ELF machine type
+        if (!metadata.isEmpty()) {
+            ++loaderParsed;
+            QCOMPARE(metadata.value("IID"), mapped[i].value("IID"));
+            QCOMPARE(metadata.value("MetaData"), mapped[i].value("MetaData"));
+        }
+    }
+    const qint64 loaderElapsed = timer.elapsed();
+
+    QCOMPARE(mapped[42].value("MetaData").toObject().value("id").toString(), QString("com.example.plugin42"));
+    logPerformanceResult("Metadata Read (mapped)", mappedElapsed, QString("Files: %1").arg(fileCount));
+    logPerformanceResult("Metadata Read (QPluginLoader)", loaderElapsed,
+                         QString("Files: %1, parsed: %2").arg(fileCount).arg(loaderParsed));
+}
+
+void PerformanceTests::testBatchValidationPerformance()
+{
+    // Size of a typical application bundle
+    const int fileCount = 400;
+    QTemporaryDir corpus;
+    QVERIFY(corpus.isValid());
+
+    std::vector<std::filesystem::path> files;
+    for (int i = 0; i < fileCount; ++i) {
+        const QString path = corpus.filePath(QString("libplugin_%1.so").arg(i));
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(syntheticPluginImage(i));
+        files.push_back(path.toStdString());
+    }
+
+    qtplugin::SecurityManager sequential;
+    QElapsedTimer timer;
+    timer.start();
+    std::vector<qtplugin::SecurityValidationResult> expected;
+    expected.reserve(files.size());
+    for (const auto& file : files) {
+        expected.push_back(sequential.validate_plugin(file, qtplugin::SecurityLevel::Strict));
+    }
+    const qint64 sequentialElapsed = timer.elapsed();
+
+    qtplugin::SecurityManager batched;
+    timer.restart();
+    auto results = batched.validate_plugins(files, qtplugin::SecurityLevel::Strict);
+    const qint64 batchedElapsed = timer.elapsed();
+
+    QCOMPARE(results.size(), expected.size());
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        QCOMPARE(results[i].is_valid, expected[i].is_valid);
+        QCOMPARE(results[i].errors, expected[i].errors);
+    }
+    logPerformanceResult("Security Validation (sequential)", sequentialElapsed, QString("Files: %1").arg(fileCount));
+    logPerformanceResult("Security Validation (batched)", batchedElapsed, QString("Files: %1").arg(fileCount));
+}
+
+void PerformanceTests::testPlatformLoadingStrategies()
+{
+#ifdef Q_OS_LINUX
+    // Compares dlopen strategies on a real plugin set, e.g. the built examples
+    const QString pluginDir = qEnvironmentVariable("QTPLUGIN_BENCHMARK_PLUGIN_DIR");
+    if (pluginDir.isEmpty()) {
+        QSKIP("Set QTPLUGIN_BENCHMARK_PLUGIN_DIR to a directory of plugins to compare loading strategies");
+    }
+
+    const std::vector<std::pair<QString, qtplugin::PlatformLoadingStrategy>> strategies = {
+        {"warm-up", qtplugin::PlatformLoadingStrategy::Default},
+        {"default", qtplugin::PlatformLoadingStrategy::Default},
+        {"lazy", qtplugin::PlatformLoadingStrategy::LazyLoading},
+        {"preload symbols", qtplugin::PlatformLoadingStrategy::PreloadSymbols},
+        {"memory mapped", qtplugin::PlatformLoadingStrategy::MemoryMapped},
+    };
+
+    QString fastest;
+    quint64 fastestUs = std::numeric_limits<quint64>::max();
+    for (const auto& [label, strategy] : strategies) {
+        qtplugin::PlatformPluginLoader loader;
+        qtplugin::PlatformLoadingConfig config;
+        config.strategy = strategy;
+        config.optimizations = static_cast<qtplugin::PlatformOptimizations>(qtplugin::PlatformOptimization::ParallelLoading);
+        config.enable_metadata_cache = false;
+        QVERIFY(loader.set_loading_config(config).has_value());
+
+        auto results = loader.load_directory_parallel(pluginDir.toStdString(), true, config.max_parallel_loads);
+        const auto stats = loader.get_loading_statistics();
+        QCOMPARE(stats.total_plugins_loaded + stats.total_plugins_failed, quint64(results.size()));
+
+        const auto platformStats = stats.platform_stats;
+        const auto statValue = [&platformStats](const char* key) {
+            auto it = platformStats.find(QString(key));
+            return it == platformStats.end() ? quint64(0) : quint64(it->second);
+        };
+        const quint64 loadUs = statValue("load_time_us");
+        logPerformanceResult(QString("Platform Loading (%1)").arg(label), qint64(loadUs / 1000),
+                             QString("Plugins: %1, failed: %2, dlopen: %3us, prefetch: %4us")
+                                 .arg(stats.total_plugins_loaded).arg(stats.total_plugins_failed)
+                                 .arg(statValue("dlopen_us")).arg(statValue("prefetch_us")));
+        if (label != "warm-up" && stats.total_plugins_loaded > 0 && loadUs < fastestUs) {
+            fastestUs = loadUs;
+            fastest = label;
+        }
+    }
+
+    if (!fastest.isEmpty()) {
+        logPerformanceResult("Platform Loading fastest strategy", qint64(fastestUs / 1000), fastest);
+    }
+#else
+    QSKIP("PlatformPluginLoader is implemented for Linux only");
+#endif
+}
+
 void PerformanceTests::testConfigurationReadPerformance()
 {
     // Prepare test data
@@ -133,6 +293,50 @@ void PerformanceTests::testConfigurationReadPerformance()
     });
 }
 
+void PerformanceTests::testConfigurationKeyHandlePerformance()
+{
+    const int iterations = 100000;
+    std::vector<qtplugin::ConfigKey> keys;
+    for (int i = 0; i < 100; ++i) {
+        keys.emplace_back(QString("handle.section.key%1").arg(i).toStdString());
+        m_configManager->set_value(keys.back(), QString("value_%1").arg(i));
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        auto value = m_configManager->get_value(keys[static_cast<size_t>(i % 100)]);
+        QVERIFY(value.has_value());
+    }
+    const qint64 elapsedNs = timer.nsecsElapsed();
+
+    logPerformanceResult("Configuration Key Handle Read", elapsedNs / 1000000,
+                         QString("%1 ns per read").arg(elapsedNs / iterations));
+}
+
+void PerformanceTests::testConfigurationSnapshotReadPerformance()
+{
+    const int iterations = 100000;
+    std::vector<qtplugin::ConfigKey> keys;
+    for (int i = 0; i < 100; ++i) {
+        keys.emplace_back(QString("snapshot.section.key%1").arg(i).toStdString());
+        m_configManager->set_value(keys.back(), QString("value_%1").arg(i));
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    auto snapshot = m_configManager->snapshot();
+    QVERIFY(snapshot.has_value());
+    for (int i = 0; i < iterations; ++i) {
+        auto value = snapshot.value()->get_value(keys[static_cast<size_t>(i % 100)]);
+        QVERIFY(value.has_value());
+    }
+    const qint64 elapsedNs = timer.nsecsElapsed();
+
+    logPerformanceResult("Configuration Snapshot Read", elapsedNs / 1000000,
+                         QString("%1 ns per read").arg(elapsedNs / iterations));
+}
+
 void PerformanceTests::testConfigurationWritePerformance()
 {
     const int iterations = 1000;
@@ -263,5 +467,67 @@ void PerformanceTests::logPerformanceResult(const QString& testName, qint64 elap
     // You could also write results to a file or database for analysis
 }
 
+QByteArray PerformanceTests::syntheticPluginImage(int index) const
+{
+    // Minimal little-endian ELF64 shared object: header, section name table,
+    // .qtmetadata section and three section headers (null, names, metadata)
+    QJsonObject pluginMetadata;
+    pluginMetadata["id"] = QString("com.example.plugin%1").arg(index);
+    pluginMetadata["name"] = QString("Plugin %1").arg(index);
+    pluginMetadata["version"] = "1.0.0";
+
+    QCborMap cbor;
+    cbor.insert(2, QString("qtplugin.IPlugin/3.0"));
+    cbor.insert(3, QString("Plugin%1").arg(index));
+    cbor.insert(4, QCborMap::fromJsonObject(pluginMetadata));
+
+    QByteArray blob("QTMETADATA !");
+    blob.append(char(0));
+    blob.append(char(QT_VERSION_MAJOR));
+    blob.append(char(QT_VERSION_MINOR));
+    blob.append(char(0));
+    blob.append(cbor.toCborValue().toCbor());
+
+    const QByteArray names("\0.shstrtab\0.qtmetadata\0", 23);
+    const quint64 namesOffset = 64;
+    const quint64 blobOffset = namesOffset + names.size();
+    const quint64 sectionsOffset = (blobOffset + blob.size() + 7) & ~quint64(7);
+
+    QByteArray image(int(sectionsOffset + 3 * 64), '\0');
+    auto put16 = [&](qsizetype at, quint16 v) { qToLittleEndian(v, image.data() + at); };
+    auto put32 = [&](qsizetype at, quint32 v) { qToLittleEndian(v, image.data() + at); };
+    auto put64 = [&](qsizetype at, quint64 v) { qToLittleEndian(v, image.data() + at); };
+
+    image.replace(0, 7, QByteArray("\x7f" "ELF\x02\x01\x01", 7));
+    put16(0x10, 3);                          // ET_DYN
+#if defined(Q_PROCESSOR_ARM_64)
+    put16(0x12, 183);                        // EM_AARCH64
+#else
+    put16(0x12, 62);                         // EM_X86_64
+#endif
+    put32(0x14, 1);
+    put64(0x28, sectionsOffset);
+    put16(0x34, 64);
+    put16(0x3A, 64);
+    put16(0x3C, 3);
+    put16(0x3E, 1);
+
+    image.replace(int(namesOffset), names.size(), names);
+    image.replace(int(blobOffset), blob.size(), blob);
+
+    const qsizetype namesHeader = qsizetype(sectionsOffset) + 64;
+    put32(namesHeader, 1);                   // ".shstrtab"
+    put32(namesHeader + 4, 3);               // SHT_STRTAB
+    put64(namesHeader + 0x18, namesOffset);
+    put64(namesHeader + 0x20, quint64(names.size()));
+
+    const qsizetype blobHeader = qsizetype(sectionsOffset) + 128;
+    put32(blobHeader, 11);                   // ".qtmetadata"
+    put32(blobHeader + 4, 1);                // SHT_PROGBITS
+    put64(blobHeader + 0x18, blobOffset);
+    put64(blobHeader + 0x20, quint64(blob.size()));
+    return image;
+}
+
 QTEST_MAIN(PerformanceTests)
 #include "test_performance.moc"
@@ -0,0 +1,156 @@
+/**
+ * @file test_plugin_discovery.cpp
+ * @brief Tests for the parallel, incremental plugin directory scanner
+ * @version 3.0.0
+ */
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "qtplugin/core/plugin_discovery.hpp"
+
+using namespace qtplugin;
+
+class TestPluginDiscovery : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void testRecursiveScan();
+    void testRescanReusesUnchangedDirectories();
+    void testIndexPersistence();
+    void testNativeHeaderSniffing();
+
+private:
+    std::unique_ptr<QTemporaryDir> m_temp_dir;
+    std::filesystem::path m_root;
+    std::shared_ptr<std::atomic<int>> m_checks;
+
+    std::unique_ptr<PluginDiscovery> createDiscovery() const;
+    void writeFile(const std::filesystem::path& relative_path, const std::string& content) const;
+};
+
+void TestPluginDiscovery::init()
+{
+    m_temp_dir = std::make_unique<QTemporaryDir>();
+    QVERIFY(m_temp_dir->isValid());
+    m_root = std::filesystem::path(m_temp_dir->path().toStdString());
+    m_checks = std::make_shared<std::atomic<int>>(0);
+
+    writeFile("alpha.json", "{}");
+    writeFile("nested/beta.json", "{}");
+    writeFile("nested/deeper/gamma.json", "{}");
+    writeFile("nested/deeper/notes.txt", "not a plugin");
+    writeFile("other/invalid.json", "invalid");
+}
+
+void TestPluginDiscovery::cleanup()
+{
+    m_temp_dir.reset();
+}
+
+void TestPluginDiscovery::testRecursiveScan()
+{
+    auto discovery = createDiscovery();
+    discovery->set_max_threads(4);
+
+    auto recursive = discovery->scan({m_root}, true);
+    QCOMPARE(recursive.size(), size_t(3));
+    QVERIFY(std::find(recursive.begin(), recursive.end(), m_root / "nested" / "deeper" / "gamma.json") !=
+            recursive.end());
+
+    auto flat = discovery->scan({m_root}, false);
+    QCOMPARE(flat.size(), size_t(1));
+    QCOMPARE(flat.front(), m_root / "alpha.json");
+}
+
+void TestPluginDiscovery::testRescanReusesUnchangedDirectories()
+{
+    auto discovery = createDiscovery();
+    QCOMPARE(discovery->scan({m_root}, true).size(), size_t(3));
+    const int checks_after_first_scan = m_checks->load();
+    QCOMPARE(discovery->last_scan_stats().directories_scanned, size_t(4));
+
+    // Nothing changed: every directory comes from the index, no file is opened
+    QCOMPARE(discovery->scan({m_root}, true).size(), size_t(3));
+    QCOMPARE(discovery->last_scan_stats().directories_scanned, size_t(0));
+    QCOMPARE(discovery->last_scan_stats().directories_reused, size_t(4));
+    QCOMPARE(m_checks->load(), checks_after_first_scan);
+
+    // Adding a plugin only relists its directory
+    writeFile("other/delta.json", "{}");
+    QCOMPARE(discovery->scan({m_root}, true).size(), size_t(4));
+    QCOMPARE(discovery->last_scan_stats().directories_scanned, size_t(1));
+}
+
+void TestPluginDiscovery::testIndexPersistence()
+{
+    QTemporaryDir index_dir;
+    QVERIFY(index_dir.isValid());
+    const auto index_file = std::filesystem::path(index_dir.path().toStdString()) / "discovery-index.json";
+    {
+        auto discovery = createDiscovery();
+        QCOMPARE(discovery->scan({m_root}, true).size(), size_t(3));
+        QVERIFY(discovery->save_index(index_file).has_value());
+    }
+
+    auto restored = createDiscovery();
+    QVERIFY(restored->load_index(index_file).has_value());
+    QCOMPARE(restored->scan({m_root}, true).size(), size_t(3));
+    QCOMPARE(restored->last_scan_stats().directories_scanned, size_t(0));
+    QCOMPARE(restored->last_scan_stats().directories_reused, size_t(4));
+
+    // An index written for other extensions is rejected
+    PluginDiscovery other({".so"}, nullptr);
+    QVERIFY(!other.load_index(index_file).has_value());
+}
+
+void TestPluginDiscovery::testNativeHeaderSniffing()
+{
+    writeFile("libtext.so", "INPUT(-lfoo)");
+    QCOMPARE(sniff_plugin_file(m_root / "libtext.so"), PluginFileKind::NotPlugin);
+    QCOMPARE(sniff_plugin_file(m_root / "alpha.json"), PluginFileKind::Unknown);
+
+    // ELF header without section headers cannot carry .qtmetadata
+    std::string elf(64, '\0');
+    elf.replace(0, 4, "\x7f" "ELF");
+    elf[4] = 2;
+    elf[5] = 1;
+    writeFile("libempty.so", elf);
+    QCOMPARE(sniff_plugin_file(m_root / "libempty.so"), PluginFileKind::NotPlugin);
+
+    // Rejected native files never reach the loader check
+    PluginDiscovery discovery({".so"}, [](const std::filesystem::path&) { return true; });
+    QVERIFY(discovery.scan({m_root}, false).empty());
+}
+
+std::unique_ptr<PluginDiscovery> TestPluginDiscovery::createDiscovery() const
+{
+    auto checks = m_checks;
+    return std::make_unique<PluginDiscovery>(
+        std::vector<std::string>{".json"},
+        [checks](const std::filesystem::path& file_path) {
+            checks->fetch_add(1);
+            std::ifstream file(file_path);
+            return file.get() == '{';
+        });
+}
+
+void TestPluginDiscovery::writeFile(const std::filesystem::path& relative_path, const std::string& content) const
+{
+    const auto path = m_root / relative_path;
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream file(path, std::ios::binary);
+    file << content;
+}
+
+QTEST_MAIN(TestPluginDiscovery)
+#include "test_plugin_discovery.moc"
@@ -6,13 +6,403 @@
 
 #include <QtTest/QtTest>
 #include <QTemporaryDir>
+#include <QSignalSpy>
+#include <QThread>
+#include <QTimer>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QJsonArray>
+#include <QCborArray>
+#include <QCborValue>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <filesystem>
+#include <thread>
+#include <vector>
 
 #include "qtplugin/core/plugin_manager.hpp"
+#include "qtplugin/communication/message_types.hpp"
+#include "qtplugin/utils/atomic_shared_ptr.hpp"
+#include "qtplugin/utils/id_interner.hpp"
 #include "qtplugin/utils/error_handling.hpp"
+#include "qtplugin/utils/trace.hpp"
+
+using namespace qtplugin;
+
+namespace {
+
+struct AddParams {
+    int lhs = 0;
+    int rhs = 0;
+};
+
+} // namespace
+
+// Positional encoding: no key strings on the fast path
+template<>
+struct qtplugin::CommandCodec<AddParams> {
+    static QCborValue encode(const AddParams& params) {
+        return QCborArray{params.lhs, params.rhs};
+    }
+    static expected<AddParams, PluginError> decode(const QCborValue& value) {
+        const auto array = value.toArray();
+        if (array.size() != 2) {
+            return make_error<AddParams>(PluginErrorCode::InvalidParameters, "Expected two operands");
+        }
+        return AddParams{static_cast<int>(array[0].toInteger()), static_cast<int>(array[1].toInteger())};
+    }
+};
+
+namespace {
+
+// Order in which StubPlugins were shut down
+std::mutex g_shutdown_log_mutex;
+std::vector<std::string> g_shutdown_log;
+
+// In-process plugin handed out by StubLoader
+class StubPlugin : public IPlugin
+{
+public:
+    explicit StubPlugin(std::string id) : m_id(std::move(id)) {
+        m_commands.register_command<AddParams, int>("add", [](const AddParams& params) -> expected<int, PluginError> {
+            return params.lhs + params.rhs;
+        });
+    }
+
+    std::string_view name() const noexcept override { return m_id; }
+    std::string_view description() const noexcept override { return "Stub plugin for testing"; }
+    Version version() const noexcept override { return Version(1, 0, 0); }
+    std::string_view author() const noexcept override { return "Test Suite"; }
+    std::string id() const noexcept override { return m_id; }
+
+    expected<void, PluginError> initialize() override {
+        if (m_id == "hung" || m_id == "timer_hung") {
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        }
+        m_state = PluginState::Running;
+        return make_success();
+    }
+
+    void shutdown() noexcept override {
+        if (m_busy.load()) {
+            m_shutdown_while_busy = true;
+        }
+        if (m_id == "stuck" || m_id == "hanging") {
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }
+        m_state = PluginState::Stopped;
+        std::lock_guard lock(g_shutdown_log_mutex);
+        g_shutdown_log.push_back(m_id);
+    }
+
+    PluginMetadata metadata() const override {
+        auto meta = IPlugin::metadata();
+        if (m_id == "app") {
+            meta.dependencies = {"core"};
+        } else if (m_id == "hanging") {
+            meta.dependencies = {"storage"};
+        }
+        return meta;
+    }
+    PluginState state() const noexcept override { return m_state; }
+    PluginCapabilities capabilities() const noexcept override { return 0; }
+
+    expected<QJsonObject, PluginError>
+    execute_command(std::string_view command, const QJsonObject& params = {}) override {
+        Q_UNUSED(params)
+        if (command == "sleep") {
+            m_busy = true;
+            m_entered = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            m_busy = false;
+        }
+        QJsonObject result;
+        if (command == "increment") {
+            result["counter"] = ++m_counter;
+            if (m_metrics && m_increments_metric) {
+                m_metrics->add(*m_increments_metric);
+            }
+        }
+        result["command"] = QString::fromUtf8(command.data(), static_cast<qsizetype>(command.size()));
+        return result;
+    }
+
+    std::vector<CommandResult> execute_commands(std::span<const CommandCall> calls) override {
+        m_batches.fetch_add(1);
+        m_batched_calls.fetch_add(static_cast<int>(calls.size()));
+        for (const auto& call : calls) {
+            if (call.command == "throw") {
+                throw 42;  // Not a std::exception
+            }
+        }
+        return IPlugin::execute_commands(calls);
+    }
+
+    std::vector<std::string> available_commands() const override { return {"status", "sleep", "increment"}; }
+
+    expected<QByteArray, PluginError> save_state() const override {
+        return QByteArray::number(m_counter.load());
+    }
+
+    expected<void, PluginError> restore_state(const QByteArray& state) override {
+        m_counter = state.toInt();
+        return make_success();
+    }
+
+    void attach_metrics(std::shared_ptr<PluginMetricsSlot> slot) override {
+        m_increments_metric = slot->register_metric("increments");
+        m_metrics = std::move(slot);
+    }
+
+    std::optional<CommandHandle> resolve_command(std::string_view command) const override {
+        return m_commands.find(command);
+    }
+
+    expected<QCborValue, PluginError> invoke_command(CommandHandle command, const QCborValue& params) override {
+        return m_commands.invoke(command, params);
+    }
+
+    int counter() const { return m_counter.load(); }
+    int batches() const { return m_batches.load(); }
+    int batched_calls() const { return m_batched_calls.load(); }
+    bool entered() const { return m_entered.load(); }
+    bool shutdown_while_busy() const { return m_shutdown_while_busy.load(); }
+
+private:
+    std::string m_id;
+    std::atomic<PluginState> m_state{PluginState::Unloaded};
+    std::atomic<bool> m_busy{false};
+    std::atomic<bool> m_entered{false};
+    std::atomic<bool> m_shutdown_while_busy{false};
+    std::atomic<int> m_counter{0};
+    std::atomic<int> m_batches{0};
+    std::atomic<int> m_batched_calls{0};
+    CommandTable m_commands;
+    std::shared_ptr<PluginMetricsSlot> m_metrics;
+    std::optional<std::size_t> m_increments_metric;
+};
+
+// QObject plugin that owns a timer, which only starts on the owning thread
+class TimerPlugin : public QObject, public StubPlugin
+{
+public:
+    explicit TimerPlugin(std::string id) : StubPlugin(std::move(id)) {}
+
+    expected<void, PluginError> initialize() override {
+        m_timer = new QTimer(this);
+        m_timer->setInterval(1000);
+        m_timer->start();
+        m_init_thread = QThread::currentThread();
+        return StubPlugin::initialize();
+    }
+
+    void shutdown() noexcept override {
+        if (m_timer) {
+            m_timer->stop();
+        }
+        StubPlugin::shutdown();
+    }
+
+    QTimer* timer() const { return m_timer; }
+    QThread* init_thread() const { return m_init_thread; }
+
+private:
+    QTimer* m_timer = nullptr;
+    QThread* m_init_thread = nullptr;
+};
+
+// Loader that serves StubPlugins for any existing file and counts library loads
+class StubLoader : public IPluginLoader
+{
+public:
+    explicit StubLoader(std::shared_ptr<std::atomic<int>> loads) : m_loads(std::move(loads)) {}
+
+    bool can_load(const std::filesystem::path& file_path) const override {
+        return std::filesystem::exists(file_path);
+    }
+
+    expected<std::shared_ptr<IPlugin>, PluginError>
+    load(const std::filesystem::path& file_path) override {
+        m_loads->fetch_add(1);
+        if (file_path.stem().string().starts_with("timer")) {
+            return std::shared_ptr<IPlugin>(std::make_shared<TimerPlugin>(file_path.stem().string()));
+        }
+        return std::shared_ptr<IPlugin>(std::make_shared<StubPlugin>(file_path.stem().string()));
+    }
+
+    expected<void, PluginError> unload(std::string_view plugin_id) override {
+        Q_UNUSED(plugin_id)
+        return make_success();
+    }
+
+    expected<std::shared_ptr<IPlugin>, PluginError>
+    stage_reload(std::string_view plugin_id, const std::filesystem::path& file_path,
+                 const ReloadValidator& validate = {}) override {
+        if (validate) {
+            auto validation = validate(file_path);
+            if (!validation) {
+                return qtplugin::unexpected<PluginError>{validation.error()};
+            }
+        }
+        m_loads->fetch_add(1);
+        if (plugin_id == "timer") {
+            return std::shared_ptr<IPlugin>(std::make_shared<TimerPlugin>("timer"));
+        }
+        return std::shared_ptr<IPlugin>(std::make_shared<StubPlugin>(std::string(plugin_id)));
+    }
+
+    expected<void, PluginError> commit_reload(std::string_view plugin_id) override {
+        Q_UNUSED(plugin_id)
+        return make_success();
+    }
+
+    expected<QJsonObject, PluginError>
+    read_plugin_metadata(const std::filesystem::path& file_path) const override {
+        QJsonObject meta_data;
+        meta_data["id"] = QString::fromStdString(file_path.stem().string());
+        QJsonObject metadata;
+        metadata["IID"] = "qtplugin.IPlugin/3.0";
+        metadata["MetaData"] = meta_data;
+        return metadata;
+    }
+
+    std::vector<std::string> supported_extensions() const override { return {".json"}; }
+    std::string_view name() const noexcept override { return "StubLoader"; }
+    bool supports_hot_reload() const noexcept override { return false; }
+
+private:
+    std::shared_ptr<std::atomic<int>> m_loads;
+};
+
+// Loader without side-by-side staging, so reloads replace the plugin in place
+class InPlaceLoader : public StubLoader
+{
+public:
+    InPlaceLoader(std::shared_ptr<std::atomic<int>> loads, std::shared_ptr<std::atomic<bool>> fail_loads)
+        : StubLoader(std::move(loads)), m_fail_loads(std::move(fail_loads)) {}
+
+    expected<std::shared_ptr<IPlugin>, PluginError>
+    load(const std::filesystem::path& file_path) override {
+        if (m_fail_loads->load()) {
+            return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::LoadFailed, "Broken build");
+        }
+        return StubLoader::load(file_path);
+    }
+
+    expected<std::shared_ptr<IPlugin>, PluginError>
+    stage_reload(std::string_view plugin_id, const std::filesystem::path& file_path,
+                 const ReloadValidator& validate = {}) override {
+        Q_UNUSED(plugin_id)
+        Q_UNUSED(file_path)
+        Q_UNUSED(validate)
+        return make_error<std::shared_ptr<IPlugin>>(PluginErrorCode::NotImplemented, "No staging");
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> m_fail_loads;
+};
+
+// Accepts every plugin until told to reject them
+class StubSecurityManager : public ISecurityManager
+{
+public:
+    explicit StubSecurityManager(std::shared_ptr<std::atomic<bool>> reject) : m_reject(std::move(reject)) {}
+
+    SecurityValidationResult validate_plugin(const std::filesystem::path& file_path,
+                                             SecurityLevel required_level) override {
+        Q_UNUSED(file_path)
+        SecurityValidationResult result;
+        result.is_valid = !m_reject->load();
+        result.validated_level = required_level;
+        if (!result.is_valid) {
+            result.errors.push_back("Rejected by test");
+        }
+        return result;
+    }
+
+    bool is_trusted(std::string_view plugin_id) const override {
+        Q_UNUSED(plugin_id)
+        return false;
+    }
+    void add_trusted_plugin(std::string_view plugin_id, SecurityLevel trust_level) override {
+        Q_UNUSED(plugin_id)
+        Q_UNUSED(trust_level)
+    }
+    void remove_trusted_plugin(std::string_view plugin_id) override { Q_UNUSED(plugin_id) }
+    SecurityLevel security_level() const noexcept override { return SecurityLevel::Basic; }
+    void set_security_level(SecurityLevel level) override { Q_UNUSED(level) }
+    QJsonObject security_statistics() const override { return {}; }
+
+private:
+    std::shared_ptr<std::atomic<bool>> m_reject;
+};
+
+// Order in which static plugins were initialized
+std::vector<std::string> g_static_init_log;
+
+// Statically linked plugin with a devirtualised command handler
+template<typename Derived>
+class StaticTestPlugin : public StaticPluginAdapter<Derived>
+{
+public:
+    expected<void, PluginError> initialize() override {
+        g_static_init_log.push_back(this->id());
+        m_state = PluginState::Running;
+        return make_success();
+    }
+    void shutdown() noexcept override { m_state = PluginState::Stopped; }
+    PluginState state() const noexcept override { return m_state; }
+    PluginCapabilities capabilities() const noexcept override { return 0; }
+    std::vector<std::string> available_commands() const override { return {"increment"}; }
+
+    expected<QJsonObject, PluginError> handle_command(std::string_view command, const QJsonObject& params) {
+        Q_UNUSED(params)
+        if (command != "increment") {
+            return make_error<QJsonObject>(PluginErrorCode::CommandNotFound, std::string(command));
+        }
+        QJsonObject result;
+        result["counter"] = ++m_counter;
+        return result;
+    }
+
+    int counter() const { return m_counter; }
+
+private:
+    PluginState m_state = PluginState::Unloaded;
+    int m_counter = 0;
+};
+
+class StaticCounterPlugin : public StaticTestPlugin<StaticCounterPlugin>
+{
+public:
+    static constexpr StaticPluginInfo static_info{"static.counter", "Static Counter", "Counts calls", "Test Suite", {1, 2, 0}, {}};
+};
+
+constexpr std::string_view report_dependencies[] = {"static.counter"};
+
+class StaticReportPlugin : public StaticTestPlugin<StaticReportPlugin>
+{
+public:
+    static constexpr StaticPluginInfo static_info{"static.report", "Static Report", "Depends on the counter", "Test Suite", {1, 0, 0}, report_dependencies};
+};
+
+class StaticRegisteredPlugin : public StaticTestPlugin<StaticRegisteredPlugin>
+{
+public:
+    static constexpr StaticPluginInfo static_info{"static.registered", "Static Registered", "Registered by macro", "Test Suite", {1, 0, 0}, {}};
+};
+
+// Dependent listed first: loading must still start with the dependency
+constexpr auto static_test_table = make_static_plugin_table<StaticReportPlugin, StaticCounterPlugin>();
+
+} // namespace
+
+QTPLUGIN_REGISTER_STATIC_PLUGINS(StaticRegisteredPlugin)
 
 class TestPluginManager : public QObject
 {
@@ -33,6 +423,28 @@ private slots:
     void testLoadValidPlugin();
     void testLoadInvalidPlugin();
     void testLoadNonexistentPlugin();
+    void testLazyActivation();
+    void testRegistrySnapshot();
+    void testAtomicSharedPtrPublication();
+    void testUnloadWaitsForInFlightCalls();
+    void testReloadHandsOverState();
+    void testHotReloadCoalescesChanges();
+    void testReloadRevalidatesSecurity();
+    void testReloadInPlace();
+    void testCommandHandles();
+    void testBatchedCommands();
+    void testLoadTracing();
+    void testWarmRestartSnapshot();
+    void testBackgroundMetricsSampling();
+    void testSystemMetricsAggregates();
+    void testInitializationTimeout();
+    void testQObjectPluginInitializesOnOwningThread();
+    void testReloadQObjectPluginOnManagerThread();
+    void testParallelShutdown();
+    void testShutdownSkipsDependenciesOfDetached();
+    void testUsageProfilePreloading();
+    void testInternedPluginHandles();
+    void testStaticPlugins();
 
 private:
     std::unique_ptr<qtplugin::PluginManager> m_plugin_manager;
@@ -159,6 +571,972 @@ void TestPluginManager::testLoadNonexistentPlugin()
     QCOMPARE(result.error().code, qtplugin::PluginErrorCode::FileNotFound);
 }
 
+void TestPluginManager::testLazyActivation()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("lazy_plugin");
+
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    options.lazy_activation = true;
+
+    // Registration reads metadata only
+    auto result = manager.load_plugin(getPluginPath("lazy_plugin"), options);
+    QVERIFY(result.has_value());
+    QCOMPARE(result.value(), std::string("lazy_plugin"));
+    QCOMPARE(loads->load(), 0);
+    QCOMPARE(manager.get_plugin_info("lazy_plugin")->state, PluginState::Discovered);
+
+    // Concurrent first use activates the plugin exactly once
+    std::vector<std::thread> threads;
+    std::atomic<int> resolved{0};
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&manager, &resolved]() {
+            if (manager.get_plugin("lazy_plugin")) {
+                resolved.fetch_add(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    QCOMPARE(resolved.load(), 8);
+    QCOMPARE(loads->load(), 1);
+    QCOMPARE(manager.get_plugin_info("lazy_plugin")->state, PluginState::Running);
+
+    auto command = manager.send_command("lazy_plugin", "status");
+    QVERIFY(command.has_value());
+    QCOMPARE(command.value()["command"].toString(), QString("status"));
+    QCOMPARE(loads->load(), 1);
+
+    QVERIFY(manager.unload_plugin("lazy_plugin").has_value());
+    QVERIFY(manager.loaded_plugins().empty());
+}
+
+void TestPluginManager::testRegistrySnapshot()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("snapshot_a");
+    createMockPlugin("snapshot_b");
+
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("snapshot_a"), options).has_value());
+    QVERIFY(manager.load_plugin(getPluginPath("snapshot_b"), options).has_value());
+
+    auto snapshot = manager.registry_snapshot();
+    QCOMPARE(snapshot->size(), size_t(2));
+
+    int visited = 0;
+    manager.for_each_plugin([&visited](const PluginInfo& info) {
+        QVERIFY(info.instance != nullptr);
+        ++visited;
+    });
+    QCOMPARE(visited, 2);
+
+    auto view = manager.plugin_info_view("snapshot_a");
+    QVERIFY(view != nullptr);
+    QCOMPARE(view->state, PluginState::Running);
+
+    // Writers publish a new registry; snapshots already handed out are unaffected
+    QVERIFY(manager.configure_plugin("snapshot_a", QJsonObject{{"key", "value"}}).has_value());
+    QVERIFY(view->configuration.isEmpty());
+    QCOMPARE(manager.plugin_info_view("snapshot_a")->configuration["key"].toString(), QString("value"));
+
+    QVERIFY(manager.unload_plugin("snapshot_a").has_value());
+    QVERIFY(snapshot->contains("snapshot_a"));
+    QVERIFY(!manager.registry_snapshot()->contains("snapshot_a"));
+    QVERIFY(manager.plugin_info_view("snapshot_a") == nullptr);
+    QCOMPARE(manager.loaded_plugins().size(), size_t(1));
+}
+
+void TestPluginManager::testAtomicSharedPtrPublication()
+{
+    // Published objects are seen whole; lock-freedom is up to the standard library
+    struct Pair {
+        int first = 0;
+        int second = 0;
+    };
+    AtomicSharedPtr<const Pair> published{std::make_shared<const Pair>()};
+    qInfo() << "AtomicSharedPtr lock-free on this standard library:" << published.is_lock_free();
+
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                auto pair = published.load();
+                if (pair->first != pair->second) {
+                    torn.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int i = 1; i <= 10000; ++i) {
+        published.store(std::make_shared<const Pair>(Pair{i, i}));
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    QCOMPARE(torn.load(), 0);
+    QCOMPARE(published.load()->first, 10000);
+}
+
+void TestPluginManager::testUnloadWaitsForInFlightCalls()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("busy");
+
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("busy"), options).has_value());
+
+    auto plugin = std::dynamic_pointer_cast<StubPlugin>(manager.get_plugin("busy"));
+    QVERIFY(plugin != nullptr);
+
+    std::atomic<bool> call_succeeded{false};
+    std::thread caller([&manager, &call_succeeded]() {
+        call_succeeded = manager.send_command("busy", "sleep").has_value();
+    });
+    while (!plugin->entered()) {
+        std::this_thread::yield();
+    }
+
+    // Unload must not shut the plugin down while the command is still running
+    QVERIFY(manager.unload_plugin("busy").has_value());
+    QVERIFY(!plugin->shutdown_while_busy());
+    QCOMPARE(plugin->state(), PluginState::Stopped);
+    caller.join();
+    QVERIFY(call_succeeded.load());
+
+    // Unpublished plugins refuse new calls
+    auto result = manager.send_command("busy", "status");
+    QVERIFY(!result.has_value());
+    QCOMPARE(result.error().code, PluginErrorCode::PluginNotFound);
+}
+
+void TestPluginManager::testReloadHandsOverState()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("stateful");
+
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("stateful"), options).has_value());
+
+    auto original = std::dynamic_pointer_cast<StubPlugin>(manager.get_plugin("stateful"));
+    QVERIFY(original != nullptr);
+    for (int i = 0; i < 3; ++i) {
+        QVERIFY(manager.send_command("stateful", "increment").has_value());
+    }
+
+    QSignalSpy reloaded_spy(&manager, &PluginManager::plugin_reloaded);
+    QVERIFY(manager.reload_plugin("stateful", true).has_value());
+    QCOMPARE(reloaded_spy.count(), 1);
+    QCOMPARE(loads->load(), 2);
+
+    // The replacement was brought up side by side and took over the state
+    auto replacement = std::dynamic_pointer_cast<StubPlugin>(manager.get_plugin("stateful"));
+    QVERIFY(replacement != nullptr);
+    QVERIFY(replacement != original);
+    QCOMPARE(replacement->counter(), 3);
+    QCOMPARE(replacement->state(), PluginState::Running);
+    QCOMPARE(original->state(), PluginState::Stopped);
+
+    auto metrics = manager.plugin_metrics("stateful");
+    QVERIFY(metrics.contains("last_reload_interruption_us"));
+    QVERIFY(metrics["last_reload_interruption_us"].toInteger() < 100000);
+}
+
+void TestPluginManager::testReloadRevalidatesSecurity()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    auto reject = std::make_shared<std::atomic<bool>>(false);
+    PluginManager manager(std::make_unique<StubLoader>(loads), nullptr,
+                          std::make_unique<StubSecurityManager>(reject));
+    manager.set_hot_reload_quiet_period(std::chrono::milliseconds(50));
+    createMockPlugin("revalidated");
+
+    PluginLoadOptions options;
+    options.validate_signature = true;
+    options.enable_hot_reload = true;
+    QVERIFY(manager.load_plugin(getPluginPath("revalidated"), options).has_value());
+    auto original = manager.get_plugin("revalidated");
+    QVERIFY(original != nullptr);
+
+    // A replacement that fails validation is never loaded, however the reload starts
+    reject->store(true);
+    auto result = manager.reload_plugin("revalidated", true);
+    QVERIFY(!result.has_value());
+    QCOMPARE(result.error().code, PluginErrorCode::SecurityViolation);
+
+    QSignalSpy error_spy(&manager, &PluginManager::plugin_error);
+    QFile file(QString::fromStdString(getPluginPath("revalidated").string()));
+    QVERIFY(file.open(QIODevice::Append));
+    file.write("\n");
+    file.close();
+    QTRY_COMPARE_WITH_TIMEOUT(error_spy.count(), 1, 5000);
+
+    QCOMPARE(loads->load(), 1);
+    QCOMPARE(manager.get_plugin("revalidated"), original);
+    QCOMPARE(original->state(), PluginState::Running);
+
+    reject->store(false);
+    QVERIFY(manager.reload_plugin("revalidated", true).has_value());
+    QCOMPARE(loads->load(), 2);
+}
+
+void TestPluginManager::testReloadInPlace()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    auto fail_loads = std::make_shared<std::atomic<bool>>(false);
+    PluginManager manager(std::make_unique<InPlaceLoader>(loads, fail_loads));
+    createMockPlugin("inplace");
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("inplace"), options).has_value());
+    auto original = manager.get_plugin("inplace");
+    QVERIFY(original != nullptr);
+
+    // The old instance is retired before the new one is published
+    QVERIFY(manager.reload_plugin("inplace", false).has_value());
+    auto reloaded = manager.get_plugin("inplace");
+    QVERIFY(reloaded != nullptr && reloaded != original);
+    QCOMPARE(original->state(), PluginState::Stopped);
+    QCOMPARE(reloaded->state(), PluginState::Running);
+    QCOMPARE(manager.get_plugin_info("inplace")->state, PluginState::Running);
+
+    // A broken build leaves the plugin registered in the Error state, with
+    // no instance for callers to reach
+    QSignalSpy error_spy(&manager, &PluginManager::plugin_error);
+    fail_loads->store(true);
+    QVERIFY(!manager.reload_plugin("inplace", false).has_value());
+    QCOMPARE(reloaded->state(), PluginState::Stopped);
+    QVERIFY(manager.get_plugin("inplace") == nullptr);
+    QVERIFY(!manager.send_command("inplace", "status").has_value());
+    auto info = manager.get_plugin_info("inplace");
+    QVERIFY(info.has_value());
+    QCOMPARE(info->state, PluginState::Error);
+    QCOMPARE(error_spy.count(), 1);
+    QVERIFY(manager.unload_plugin("inplace").has_value());
+}
+
+void TestPluginManager::testHotReloadCoalescesChanges()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    manager.set_hot_reload_quiet_period(std::chrono::milliseconds(50));
+    createMockPlugin("watched");
+
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    options.enable_hot_reload = true;
+    QVERIFY(manager.load_plugin(getPluginPath("watched"), options).has_value());
+    QCOMPARE(loads->load(), 1);
+
+    // A burst of writes, as produced by a single build, reloads only once
+    const QString path = QString::fromStdString(getPluginPath("watched").string());
+    for (int i = 0; i < 5; ++i) {
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::Append));
+        file.write(" ");
+        file.close();
+        QTest::qWait(5);
+    }
+
+    QTRY_COMPARE_WITH_TIMEOUT(loads->load(), 2, 5000);
+    QTest::qWait(200);
+    QCOMPARE(loads->load(), 2);
+}
+
+void TestPluginManager::testCommandHandles()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("calculator");
+
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("calculator"), options).has_value());
+
+    auto handle = manager.resolve_command("calculator", "add");
+    QVERIFY(handle.has_value());
+    QVERIFY(handle.value().is_valid());
+
+    auto sum = manager.send_command<int>("calculator", handle.value(), AddParams{2, 3});
+    QVERIFY(sum.has_value());
+    QCOMPARE(sum.value(), 5);
+
+    // Malformed parameters are rejected by the codec, not the plugin
+    auto invalid = manager.send_command("calculator", handle.value(), QCborValue(42));
+    QVERIFY(!invalid.has_value());
+    QCOMPARE(invalid.error().code, PluginErrorCode::InvalidParameters);
+
+    // JSON-only commands have no handle; unknown handles are refused
+    auto json_only = manager.resolve_command("calculator", "status");
+    QVERIFY(!json_only.has_value());
+    QCOMPARE(json_only.error().code, PluginErrorCode::CommandNotFound);
+    auto unknown = manager.send_command("calculator", CommandHandle{42}, QCborValue());
+    QCOMPARE(unknown.error().code, PluginErrorCode::CommandNotFound);
+
+    // The JSON overload keeps working alongside the fast path
+    QVERIFY(manager.send_command("calculator", "status").has_value());
+}
+
+void TestPluginManager::testBatchedCommands()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("first");
+    createMockPlugin("second");
+
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("first"), options).has_value());
+    QVERIFY(manager.load_plugin(getPluginPath("second"), options).has_value());
+
+    const std::vector<CommandRequest> requests{
+        {"first", "increment", {}},
+        {"second", "status", {}},
+        {"missing", "status", {}},
+        {"first", "increment", {}},
+        {"second", "increment", {}},
+    };
+
+    auto results = manager.send_commands(requests);
+    QCOMPARE(results.size(), requests.size());
+    QCOMPARE(results[0].value()["counter"].toInt(), 1);
+    QCOMPARE(results[1].value()["command"].toString(), QString("status"));
+    QVERIFY(!results[2].has_value());
+    QCOMPARE(results[2].error().code, PluginErrorCode::PluginNotFound);
+    QCOMPARE(results[3].value()["counter"].toInt(), 2);
+    QCOMPARE(results[4].value()["counter"].toInt(), 1);
+
+    // Each plugin received its share as a single batch
+    auto first = std::dynamic_pointer_cast<StubPlugin>(manager.get_plugin("first"));
+    auto second = std::dynamic_pointer_cast<StubPlugin>(manager.get_plugin("second"));
+    QCOMPARE(first->batches(), 1);
+    QCOMPARE(first->batched_calls(), 2);
+    QCOMPARE(second->batches(), 1);
+    QCOMPARE(second->batched_calls(), 2);
+
+    // The callback overload reports every request exactly once
+    std::vector<int> seen(requests.size(), 0);
+    manager.send_commands(requests, [&seen](std::size_t index, CommandResult result) {
+        Q_UNUSED(result)
+        ++seen[index];
+    });
+    QVERIFY(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+    QCOMPARE(first->counter(), 4);
+
+    // Any exception fails only the throwing plugin's batch
+    const std::vector<CommandRequest> throwing{
+        {"first", "throw", {}},
+        {"first", "increment", {}},
+        {"second", "status", {}},
+    };
+    results = manager.send_commands(throwing);
+    QCOMPARE(results.size(), throwing.size());
+    QCOMPARE(results[0].error().code, PluginErrorCode::ExecutionFailed);
+    QCOMPARE(results[1].error().code, PluginErrorCode::ExecutionFailed);
+    QCOMPARE(results[2].value()["command"].toString(), QString("status"));
+}
+
+void TestPluginManager::testLoadTracing()
+{
+    auto& recorder = TraceRecorder::instance();
+    recorder.clear();
+    recorder.set_enabled(true);
+
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("traced");
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("traced"), options).has_value());
+
+    // Spans recorded on another thread land in that thread's buffer
+    std::thread worker([] { QTPLUGIN_TRACE_SCOPE("test", "worker"); });
+    worker.join();
+    recorder.set_enabled(false);
+
+    QTemporaryDir trace_dir;
+    QVERIFY(trace_dir.isValid());
+    const auto trace_file = std::filesystem::path(trace_dir.path().toStdString()) / "startup.json";
+    QVERIFY(recorder.export_chrome_trace(trace_file).has_value());
+
+    QFile file(QString::fromStdString(trace_file.string()));
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const auto events = QJsonDocument::fromJson(file.readAll()).object()["traceEvents"].toArray();
+
+    QStringList names;
+    std::set<qint64> threads;
+    for (const auto& value : events) {
+        const auto event = value.toObject();
+        if (event["ph"].toString() == "X") {
+            names << event["name"].toString();
+            threads.insert(event["tid"].toInteger());
+        }
+    }
+    QVERIFY(names.contains("load_plugin"));
+    QVERIFY(names.contains("validate_file"));
+    QVERIFY(names.contains("load_library"));
+    QVERIFY(names.contains("initialize"));
+    QVERIFY(names.contains("update_dependency_graph"));
+    QVERIFY(names.contains("worker"));
+    QCOMPARE(threads.size(), size_t(2));
+
+    // Disabled scopes record nothing
+    const auto recorded = recorder.event_count();
+    { QTPLUGIN_TRACE_SCOPE("test", "disabled"); }
+    QCOMPARE(recorder.event_count(), recorded);
+    recorder.clear();
+}
+
+void TestPluginManager::testWarmRestartSnapshot()
+{
+    createMockPlugin("eager");
+    createMockPlugin("deferred");
+    QTemporaryDir snapshot_dir;
+    QVERIFY(snapshot_dir.isValid());
+    const auto snapshot_file = std::filesystem::path(snapshot_dir.path().toStdString()) / "plugins.snapshot";
+
+    {
+        auto loads = std::make_shared<std::atomic<int>>(0);
+        PluginManager manager(std::make_unique<StubLoader>(loads));
+        PluginLoadOptions options;
+        options.validate_signature = false;
+        options.configuration["mode"] = "fast";
+        QVERIFY(manager.load_plugin(getPluginPath("eager"), options).has_value());
+        options.lazy_activation = true;
+        QVERIFY(manager.load_plugin(getPluginPath("deferred"), options).has_value());
+        QVERIFY(manager.save_snapshot(snapshot_file).has_value());
+    }
+
+    // Unchanged plugins come back as they were; the lazy one stays unloaded
+    {
+        auto loads = std::make_shared<std::atomic<int>>(0);
+        PluginManager manager(std::make_unique<StubLoader>(loads));
+        auto restored = manager.restore_snapshot(snapshot_file);
+        QVERIFY(restored.has_value());
+        QCOMPARE(restored.value().restored.size(), size_t(2));
+        QVERIFY(restored.value().revalidated.empty());
+        QCOMPARE(loads->load(), 1);
+
+        auto eager = manager.get_plugin_info("eager");
+        QVERIFY(eager.has_value());
+        QCOMPARE(eager->configuration["mode"].toString(), QString("fast"));
+        QCOMPARE(manager.get_plugin_info("deferred")->state, PluginState::Discovered);
+    }
+
+    // A rewritten plugin goes through the full pipeline again
+    {
+        QFile file(QString::fromStdString(getPluginPath("eager").string()));
+        QVERIFY(file.open(QIODevice::Append));
+        file.write(" ");
+        file.close();
+
+        auto loads = std::make_shared<std::atomic<int>>(0);
+        PluginManager manager(std::make_unique<StubLoader>(loads));
+        auto restored = manager.restore_snapshot(snapshot_file);
+        QVERIFY(restored.has_value());
+        QCOMPARE(restored.value().revalidated, std::vector<std::string>{"eager"});
+        QCOMPARE(restored.value().restored, std::vector<std::string>{"deferred"});
+    }
+
+#if defined(Q_OS_UNIX)
+    // A snapshot other users can write vouches for nothing
+    {
+        std::filesystem::permissions(snapshot_file, std::filesystem::perms::others_write,
+                                     std::filesystem::perm_options::add);
+        auto loads = std::make_shared<std::atomic<int>>(0);
+        PluginManager manager(std::make_unique<StubLoader>(loads));
+        auto restored = manager.restore_snapshot(snapshot_file);
+        QVERIFY(restored.has_value());
+        QVERIFY(restored.value().restored.empty());
+        QCOMPARE(restored.value().revalidated.size(), size_t(2));
+        std::filesystem::permissions(snapshot_file, std::filesystem::perms::others_write,
+                                     std::filesystem::perm_options::remove);
+    }
+#endif
+
+    // Restoring the size and timestamp of a rewritten file does not make it trusted
+    {
+        const auto path = getPluginPath("deferred");
+        const auto modified = std::filesystem::last_write_time(path);
+        QFile file(QString::fromStdString(path.string()));
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        std::string contents = file.readAll().toStdString();
+        QVERIFY(!contents.empty());
+        contents[0] = contents[0] == ' ' ? '\t' : ' ';
+        QVERIFY(file.seek(0));
+        QCOMPARE(file.write(contents.data(), static_cast<qint64>(contents.size())),
+                 static_cast<qint64>(contents.size()));
+        file.close();
+        std::filesystem::last_write_time(path, modified);
+
+        auto loads = std::make_shared<std::atomic<int>>(0);
+        PluginManager manager(std::make_unique<StubLoader>(loads));
+        auto restored = manager.restore_snapshot(snapshot_file);
+        QVERIFY(restored.has_value());
+        QVERIFY(restored.value().restored.empty());
+        QCOMPARE(restored.value().revalidated.size(), size_t(2));
+    }
+
+    // Anything else is rejected
+    auto invalid = m_plugin_manager->restore_snapshot(getPluginPath("eager"));
+    QVERIFY(!invalid.has_value());
+    QCOMPARE(invalid.error().code, PluginErrorCode::InvalidFormat);
+}
+
+void TestPluginManager::testBackgroundMetricsSampling()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("metered");
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("metered"), options).has_value());
+
+    for (int i = 0; i < 3; ++i) {
+        QVERIFY(manager.send_command("metered", "increment").has_value());
+    }
+    QVERIFY(!manager.send_command("missing", "increment").has_value());
+
+    // Without monitoring, metrics are sampled on demand
+    auto metrics = manager.plugin_metrics("metered");
+    QCOMPARE(metrics["command_count"].toInteger(), qint64(3));
+    QCOMPARE(metrics["plugin_metrics"].toObject()["increments"].toDouble(), 3.0);
+    QVERIFY(manager.latest_metrics() == nullptr);
+
+    manager.start_monitoring(std::chrono::milliseconds(10));
+    QVERIFY(manager.is_monitoring_active());
+    QTRY_VERIFY_WITH_TIMEOUT(manager.latest_metrics() != nullptr, 5000);
+    QVERIFY(manager.send_command("metered", "increment").has_value());
+
+    // Published values show up with the next background sample
+    QTRY_COMPARE_WITH_TIMEOUT(
+        manager.plugin_metrics("metered")["plugin_metrics"].toObject()["increments"].toDouble(), 4.0, 5000);
+    auto system = manager.system_metrics();
+    QCOMPARE(system["total_plugins"].toInt(), 1);
+    QCOMPARE(system["command_count"].toInteger(), qint64(4));
+    QVERIFY(system.contains("sampling_cost_us"));
+
+    manager.stop_monitoring();
+    QVERIFY(!manager.is_monitoring_active());
+}
+
+void TestPluginManager::testSystemMetricsAggregates()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("active");
+    createMockPlugin("dormant");
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("active"), options).has_value());
+    options.lazy_activation = true;
+    QVERIFY(manager.load_plugin(getPluginPath("dormant"), options).has_value());
+
+    auto metrics = manager.system_metrics();
+    QCOMPARE(metrics["total_plugins"].toInt(), 2);
+    QCOMPARE(metrics["loaded_plugins"].toInt(), 1);
+    QCOMPARE(metrics["unloaded_plugins"].toInt(), 1);
+    QVERIFY(metrics["estimated_memory_bytes"].toInteger() > 0);
+
+    // Activation is a state transition; the aggregates follow it
+    QVERIFY(manager.send_command("dormant", "status").has_value());
+    metrics = manager.system_metrics();
+    QCOMPARE(metrics["loaded_plugins"].toInt(), 2);
+    QCOMPARE(metrics["unloaded_plugins"].toInt(), 0);
+    QCOMPARE(metrics["command_count"].toInteger(), qint64(1));
+
+    QVERIFY(manager.unload_plugin("active").has_value());
+    metrics = manager.system_metrics();
+    QCOMPARE(metrics["total_plugins"].toInt(), 1);
+    QCOMPARE(metrics["loaded_plugins"].toInt(), 1);
+    QCOMPARE(metrics["dependency_nodes"].toInt(), 1);
+
+    manager.shutdown_all_plugins();
+    metrics = manager.system_metrics();
+    QCOMPARE(metrics["total_plugins"].toInt(), 0);
+    QCOMPARE(metrics["estimated_memory_bytes"].toInteger(), qint64(0));
+    QCOMPARE(metrics["system_uptime_ms"].toInteger(), qint64(0));
+}
+
+void TestPluginManager::testInitializationTimeout()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("hung");
+    createMockPlugin("healthy");
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    options.timeout = std::chrono::milliseconds(50);
+
+    // The hung plugin is isolated at the deadline instead of blocking the load
+    const auto start = std::chrono::steady_clock::now();
+    auto result = manager.load_plugin(getPluginPath("hung"), options);
+    QVERIFY(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(250));
+    QVERIFY(!result.has_value());
+    QCOMPARE(result.error().code, PluginErrorCode::TimeoutError);
+
+    auto info = manager.get_plugin_info("hung");
+    QVERIFY(info.has_value());
+    QCOMPARE(info->state, PluginState::Error);
+    QVERIFY(info->metrics["init_timed_out"].toBool());
+    QVERIFY(manager.get_plugin("hung") == nullptr);
+    QVERIFY(!manager.send_command("hung", "status").has_value());
+
+    // Loading carries on with the next plugin
+    QVERIFY(manager.load_plugin(getPluginPath("healthy"), options).has_value());
+    info = manager.get_plugin_info("healthy");
+    QVERIFY(info.has_value());
+    QCOMPARE(info->state, PluginState::Running);
+    QVERIFY(info->metrics.contains("init_latency_us"));
+
+    // Once the abandoned initialize() returns the plugin unloads cleanly
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    QVERIFY(manager.unload_plugin("hung").has_value());
+}
+
+void TestPluginManager::testQObjectPluginInitializesOnOwningThread()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("timer");
+    createMockPlugin("timer_hung");
+    PluginLoadOptions options;
+    options.validate_signature = false;
+
+    // Under the default deadline a QObject plugin initializes on a thread of
+    // its own and comes back with its running timer
+    QVERIFY(options.timeout > std::chrono::milliseconds::zero());
+    QVERIFY(manager.load_plugin(getPluginPath("timer"), options).has_value());
+    auto plugin = std::dynamic_pointer_cast<TimerPlugin>(manager.get_plugin("timer"));
+    QVERIFY(plugin != nullptr);
+    QVERIFY(plugin->init_thread() != QThread::currentThread());
+    QCOMPARE(plugin->thread(), QThread::currentThread());
+    QCOMPARE(plugin->timer()->thread(), QThread::currentThread());
+    QVERIFY(plugin->timer()->isActive());
+    plugin.reset();
+    QVERIFY(manager.unload_plugin("timer").has_value());
+
+    // Without a deadline it initializes inline
+    options.timeout = std::chrono::milliseconds::zero();
+    QVERIFY(manager.load_plugin(getPluginPath("timer"), options).has_value());
+    plugin = std::dynamic_pointer_cast<TimerPlugin>(manager.get_plugin("timer"));
+    QVERIFY(plugin != nullptr);
+    QCOMPARE(plugin->init_thread(), QThread::currentThread());
+    QVERIFY(plugin->timer()->isActive());
+
+    // A hung QObject plugin is isolated at the deadline like any other
+    options.timeout = std::chrono::milliseconds(50);
+    const auto start = std::chrono::steady_clock::now();
+    auto result = manager.load_plugin(getPluginPath("timer_hung"), options);
+    QVERIFY(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(250));
+    QVERIFY(!result.has_value());
+    QCOMPARE(result.error().code, PluginErrorCode::TimeoutError);
+    QVERIFY(manager.get_plugin("timer_hung") == nullptr);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    QVERIFY(manager.unload_plugin("timer_hung").has_value());
+}
+
+void TestPluginManager::testReloadQObjectPluginOnManagerThread()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    manager.set_hot_reload_quiet_period(std::chrono::milliseconds(50));
+    createMockPlugin("timer");
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    options.enable_hot_reload = true;
+    QVERIFY(manager.load_plugin(getPluginPath("timer"), options).has_value());
+    auto original = std::dynamic_pointer_cast<TimerPlugin>(manager.get_plugin("timer"));
+    QVERIFY(original != nullptr);
+
+    // A reload requested from a worker thread brings the new build up on the
+    // manager's thread, which keeps the event loop its timer needs
+    std::atomic<bool> done{false};
+    std::optional<expected<void, PluginError>> result;
+    std::thread worker([&]() {
+        result = manager.reload_plugin("timer", true);
+        done = true;
+    });
+    QTRY_VERIFY_WITH_TIMEOUT(done.load(), 5000);
+    worker.join();
+    QVERIFY(result && result->has_value());
+
+    auto reloaded = std::dynamic_pointer_cast<TimerPlugin>(manager.get_plugin("timer"));
+    QVERIFY(reloaded != nullptr && reloaded != original);
+    QCOMPARE(reloaded->init_thread(), QThread::currentThread());
+    QCOMPARE(reloaded->timer()->thread(), QThread::currentThread());
+    QVERIFY(reloaded->timer()->isActive());
+    QVERIFY(!original->timer()->isActive());
+
+    // So does a reload triggered by the file watcher
+    QFile file(QString::fromStdString(getPluginPath("timer").string()));
+    QVERIFY(file.open(QIODevice::Append));
+    file.write("\n");
+    file.close();
+    QTRY_VERIFY_WITH_TIMEOUT(manager.get_plugin("timer") != reloaded, 5000);
+    auto watched = std::dynamic_pointer_cast<TimerPlugin>(manager.get_plugin("timer"));
+    QVERIFY(watched != nullptr);
+    QCOMPARE(watched->init_thread(), QThread::currentThread());
+    QVERIFY(watched->timer()->isActive());
+    QVERIFY(!reloaded->timer()->isActive());
+}
+
+void TestPluginManager::testParallelShutdown()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    for (const auto* name : {"core", "app", "stuck", "tool"}) {
+        createMockPlugin(name);
+        QVERIFY(manager.load_plugin(getPluginPath(name), options).has_value());
+    }
+    {
+        std::lock_guard lock(g_shutdown_log_mutex);
+        g_shutdown_log.clear();
+    }
+
+    ShutdownOptions shutdown_options;
+    shutdown_options.plugin_timeout = std::chrono::milliseconds(100);
+    auto report = manager.shutdown_all_plugins(shutdown_options);
+
+    // The stuck plugin is detached instead of holding up the others
+    QVERIFY(report.elapsed < std::chrono::milliseconds(400));
+    QCOMPARE(report.detached, std::vector<std::string>{"stuck"});
+    QCOMPARE(report.stopped.size(), std::size_t(3));
+    QVERIFY(report.failed.empty());
+    QVERIFY(manager.loaded_plugins().empty());
+
+    // Dependents stop before their dependencies
+    {
+        std::lock_guard lock(g_shutdown_log_mutex);
+        auto app = std::find(g_shutdown_log.begin(), g_shutdown_log.end(), "app");
+        auto core = std::find(g_shutdown_log.begin(), g_shutdown_log.end(), "core");
+        QVERIFY(app != g_shutdown_log.end() && core != g_shutdown_log.end());
+        QVERIFY(app < core);
+    }
+
+    // Let the detached shutdown finish before the plugin goes away
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+}
+
+void TestPluginManager::testShutdownSkipsDependenciesOfDetached()
+{
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    for (const auto* name : {"storage", "hanging", "tool"}) {
+        createMockPlugin(name);
+        QVERIFY(manager.load_plugin(getPluginPath(name), options).has_value());
+    }
+    {
+        std::lock_guard lock(g_shutdown_log_mutex);
+        g_shutdown_log.clear();
+    }
+
+    QSignalSpy unloaded_spy(&manager, &PluginManager::plugin_unloaded);
+    ShutdownOptions shutdown_options;
+    shutdown_options.plugin_timeout = std::chrono::milliseconds(100);
+    auto report = manager.shutdown_all_plugins(shutdown_options);
+
+    // The storage is not stopped while the hanging plugin may still use it
+    QCOMPARE(report.detached, std::vector<std::string>{"hanging"});
+    QCOMPARE(report.skipped, std::vector<std::string>{"storage"});
+    QCOMPARE(report.stopped, std::vector<std::string>{"tool"});
+    QVERIFY(manager.loaded_plugins().empty());
+    QCOMPARE(unloaded_spy.count(), 3);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    {
+        std::lock_guard lock(g_shutdown_log_mutex);
+        QVERIFY(std::find(g_shutdown_log.begin(), g_shutdown_log.end(), "storage") == g_shutdown_log.end());
+        QVERIFY(std::find(g_shutdown_log.begin(), g_shutdown_log.end(), "hanging") != g_shutdown_log.end());
+    }
+}
+
+void TestPluginManager::testUsageProfilePreloading()
+{
+    const auto profile_path = m_plugin_dir / "usage_profile.json";
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    options.lazy_activation = true;
+    for (const auto* name : {"editor", "viewer", "exporter"}) {
+        createMockPlugin(name);
+    }
+
+    // First run: the viewer is used before the editor, the exporter not at all
+    {
+        auto loads = std::make_shared<std::atomic<int>>(0);
+        PluginManager manager(std::make_unique<StubLoader>(loads));
+        manager.set_usage_profile_path(profile_path);
+        for (const auto* name : {"editor", "viewer", "exporter"}) {
+            QVERIFY(manager.load_plugin(getPluginPath(name), options).has_value());
+        }
+        QVERIFY(manager.send_command("viewer", "status").has_value());
+        QVERIFY(manager.send_command("editor", "status").has_value());
+        QVERIFY(manager.send_command("viewer", "status").has_value());
+    }
+
+    // Second run: the hot set is activated in the background in that order
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    manager.set_usage_profile_path(profile_path);
+    const auto profile = manager.usage_profile();
+    QCOMPARE(profile.runs(), std::uint64_t(1));
+    QVERIFY(profile.find("viewer") != nullptr);
+    QCOMPARE(profile.find("viewer")->runs_used, std::uint64_t(1));
+    QVERIFY(profile.find("viewer")->first_use_latency_us > 0);
+    QVERIFY(profile.find("exporter") == nullptr);
+
+    for (const auto* name : {"editor", "viewer", "exporter"}) {
+        QVERIFY(manager.load_plugin(getPluginPath(name), options).has_value());
+    }
+    auto preloaded = manager.preload_hot_plugins(0.1).get();
+    QCOMPARE(preloaded, (std::vector<std::string>{"viewer", "editor"}));
+    QCOMPARE(loads->load(), 2);
+    QCOMPARE(manager.get_plugin_info("viewer")->state, PluginState::Running);
+    QCOMPARE(manager.get_plugin_info("exporter")->state, PluginState::Discovered);
+
+    // A preloaded plugin's first use no longer waits for activation
+    QVERIFY(manager.send_command("viewer", "status").has_value());
+    QVERIFY(manager.save_usage_profile().has_value());
+    auto saved = PluginUsageProfile::load(profile_path);
+    QVERIFY(saved.has_value());
+    QCOMPARE(saved.value().runs(), std::uint64_t(2));
+    QCOMPARE(saved.value().find("viewer")->first_use_latency_us, std::int64_t(0));
+}
+
+void TestPluginManager::testInternedPluginHandles()
+{
+    auto& interner = IdInterner::instance();
+    const auto symbol = interner.intern("interned.plugin");
+    QVERIFY(symbol.is_valid());
+    QCOMPARE(interner.intern(std::string("interned.plugin")), symbol);
+    QCOMPARE(interner.name(symbol), std::string_view("interned.plugin"));
+    QCOMPARE(interner.qname(symbol), QString("interned.plugin"));
+    QVERIFY(!interner.find("never.interned.plugin").has_value());
+    QVERIFY(!SymbolId().is_valid());
+
+    // Lookups run without a lock while other threads grow the interner
+    std::atomic<bool> lookups_ok{true};
+    std::vector<std::thread> interning;
+    for (int t = 0; t < 4; ++t) {
+        interning.emplace_back([t, &interner, &lookups_ok]() {
+            for (int i = 0; i < 2000; ++i) {
+                const std::string name = "concurrent." + std::to_string(t) + "." + std::to_string(i);
+                const auto interned = interner.intern(name);
+                const auto found = interner.find(name);
+                if (!found || *found != interned || !interner.find("interned.plugin")) {
+                    lookups_ok = false;
+                }
+            }
+        });
+    }
+    for (auto& thread : interning) {
+        thread.join();
+    }
+    QVERIFY(lookups_ok.load());
+    QVERIFY(interner.find("concurrent.3.1999") == interner.intern("concurrent.3.1999"));
+
+    // Handle overloads of the manager
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    createMockPlugin("handled");
+    PluginLoadOptions options;
+    options.validate_signature = false;
+    QVERIFY(manager.load_plugin(getPluginPath("handled"), options).has_value());
+
+    const auto handle = PluginManager::plugin_handle("handled");
+    QCOMPARE(handle, PluginHandle("handled"));
+    QCOMPARE(handle.qid(), QString("handled"));
+    QVERIFY(manager.get_plugin(handle) != nullptr);
+    auto result = manager.send_command(handle, "increment");
+    QVERIFY(result.has_value());
+    QCOMPARE(result.value()["counter"].toInt(), 1);
+    QVERIFY(!manager.send_command(PluginHandle("missing"), "status").has_value());
+
+    // Subscribers are tracked by symbol
+    MessageBus bus;
+    QVERIFY(!bus.has_subscriber("listener"));
+    QVERIFY((bus.subscribe<messages::PluginLifecycleMessage>(
+        "listener", [](const messages::PluginLifecycleMessage&) -> expected<void, PluginError> { return make_success(); })
+        .has_value()));
+    QVERIFY(bus.has_subscriber("listener"));
+    QVERIFY(bus.has_subscriber(PluginHandle("listener")));
+
+    QSignalSpy published(&bus, &MessageBus::message_published);
+    messages::PluginLifecycleMessage message("test", "handled", messages::PluginLifecycleMessage::Event::Loaded);
+    QVERIFY(bus.publish(message, DeliveryMode::Multicast, {"listener", "no.such.recipient"}).has_value());
+    QCOMPARE(published.count(), 1);
+    QCOMPARE(published.at(0).at(1).toString(), QString("test"));
+
+    QVERIFY(bus.unsubscribe("listener").has_value());
+    QVERIFY(!bus.has_subscriber(PluginHandle("listener")));
+}
+
+void TestPluginManager::testStaticPlugins()
+{
+    // The loader is never asked for static plugins
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    PluginManager manager(std::make_unique<StubLoader>(loads));
+    g_static_init_log.clear();
+
+    QCOMPARE(manager.load_static_plugins(static_test_table), 2);
+    QCOMPARE(loads->load(), 0);
+    QCOMPARE(g_static_init_log, (std::vector<std::string>{"static.counter", "static.report"}));
+    QVERIFY(manager.plugin_info_view("static.report")->static_entry != nullptr);
+    QVERIFY(manager.plugin_info_view("static.report")->file_path.empty());
+    QCOMPARE(manager.plugin_info_view("static.counter")->metadata.version, Version(1, 2, 0));
+
+    // Typed access calls the handler without virtual dispatch
+    auto counter = manager.get_static_plugin<StaticCounterPlugin>();
+    QVERIFY(counter != nullptr);
+    QVERIFY(counter->handle_command("increment", {}).has_value());
+    auto result = manager.send_command("static.counter", "increment");
+    QVERIFY(result.has_value());
+    QCOMPARE(result.value()["counter"].toInt(), 2);
+    QCOMPARE(counter->counter(), 2);
+    QVERIFY(manager.get_static_plugin<StaticRegisteredPlugin>() == nullptr);
+
+    // Loading the table again skips loaded plugins
+    QCOMPARE(manager.load_static_plugins(static_test_table), 0);
+    auto reload = manager.reload_plugin("static.counter");
+    QVERIFY(!reload.has_value());
+    QCOMPARE(reload.error().code, PluginErrorCode::NotImplemented);
+
+    QVERIFY(manager.unload_plugin("static.report").has_value());
+    QVERIFY(manager.unload_plugin("static.counter").has_value());
+
+    // Macro-registered plugins, created lazily on first use
+    const auto registered = registered_static_plugins();
+    QVERIFY(std::any_of(registered.begin(), registered.end(), [](const StaticPluginEntry* entry) {
+        return entry->info.id == "static.registered";
+    }));
+    PluginLoadOptions options;
+    options.lazy_activation = true;
+    QVERIFY(manager.load_static_plugins(options) >= 1);
+    QCOMPARE(manager.plugin_info_view("static.registered")->state, PluginState::Discovered);
+    auto registered_plugin = manager.get_static_plugin<StaticRegisteredPlugin>();
+    QVERIFY(registered_plugin != nullptr);
+    QCOMPARE(registered_plugin->state(), PluginState::Running);
+    QCOMPARE(loads->load(), 0);
+}
+
 // Helper methods implementation
 void TestPluginManager::createMockPlugin(const QString& name, const QString& version)
 {
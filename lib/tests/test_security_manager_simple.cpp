@@ -5,8 +5,15 @@
  */
 
 #include <QtTest/QtTest>
+#include <QCborMap>
+#include <QCborValue>
+#include <QFile>
+#include <QTemporaryDir>
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <filesystem>
+#include <vector>
 
 #include "qtplugin/security/security_manager.hpp"
 
@@ -25,6 +32,8 @@ private slots:
     void testSecurityLevelManagement();
     void testBasicValidation();
     void testStatistics();
+    void testChecksumDigestCache();
+    void testBatchValidation();
 
 private:
     std::unique_ptr<SecurityManager> m_security_manager;
@@ -125,5 +134,103 @@ void TestSecurityManagerSimple::testStatistics()
     QVERIFY(validations_performed > 0);
 }
 
+void TestSecurityManagerSimple::testChecksumDigestCache()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const std::filesystem::path plugin_path = dir.filePath("checksummed.so").toStdString();
+
+    // Metadata blob as written by moc, with an embedded checksum
+    QCborMap meta_data;
+    meta_data.insert(QStringLiteral("checksum"), QString::fromStdString(std::string(64, '0')));
+    QCborMap metadata;
+    metadata.insert(2, QStringLiteral("qtplugin.IPlugin/3.0"));
+    metadata.insert(4, meta_data);
+    QByteArray image("QTMETADATA !");
+    image.append(QByteArray("\x00\x06\x05\x00", 4));
+    image.append(QCborValue(metadata).toCbor());
+    image.append(QByteArray(4096, 'x'));
+
+    QFile file(QString::fromStdString(plugin_path.string()));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write(image), image.size());
+    file.close();
+
+    SecurityManager manager;
+    manager.set_signature_verification_enabled(true);
+    auto digest_stat = [&manager](const char* key) { return manager.security_statistics().value(key).toInteger(); };
+
+    // The checksum does not match; the digest is computed once
+    QVERIFY(!manager.validate_signature(plugin_path).is_valid);
+    QVERIFY(!manager.validate_signature(plugin_path).is_valid);
+    QCOMPARE(digest_stat("digest_cache_misses"), qint64(1));
+    QCOMPARE(digest_stat("digest_cache_hits"), qint64(1));
+
+    // Invalidation, e.g. by the file watcher, forces a new digest
+    manager.invalidate_file(plugin_path);
+    QVERIFY(!manager.validate_signature(plugin_path).is_valid);
+    QCOMPARE(digest_stat("digest_cache_misses"), qint64(2));
+
+    // So does any change of the file
+    QVERIFY(file.open(QIODevice::Append));
+    file.write("more");
+    file.close();
+    QVERIFY(!manager.validate_signature(plugin_path).is_valid);
+    QCOMPARE(digest_stat("digest_cache_misses"), qint64(3));
+    QCOMPARE(digest_stat("digest_cache_hits"), qint64(1));
+}
+
+void TestSecurityManagerSimple::testBatchValidation()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    // Readable files, empty files, missing files and wrong extensions
+    std::vector<std::filesystem::path> files;
+    for (int i = 0; i < 24; ++i) {
+        const std::filesystem::path path = dir.filePath(QString("batch_%1.so").arg(i)).toStdString();
+        if (i % 4 != 3) {
+            QFile file(QString::fromStdString(path.string()));
+            QVERIFY(file.open(QIODevice::WriteOnly));
+            if (i % 4 != 2) {
+                file.write(QByteArray(1024 * (i + 1), 'p'));
+            }
+        }
+        files.push_back(path);
+    }
+    files.push_back(dir.filePath("notes.txt").toStdString());
+
+    SecurityManager sequential;
+    SecurityManager batched;
+
+    std::mutex seen_mutex;
+    std::vector<int> seen(files.size(), 0);
+    auto results = batched.validate_plugins(files, SecurityLevel::Standard,
+                                            [&](std::size_t index, const SecurityValidationResult&) {
+                                                std::lock_guard lock(seen_mutex);
+                                                ++seen[index];
+                                            });
+
+    QCOMPARE(results.size(), files.size());
+    QVERIFY(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        const auto expected = sequential.validate_plugin(files[i], SecurityLevel::Standard);
+        QCOMPARE(results[i].is_valid, expected.is_valid);
+        QCOMPARE(results[i].validated_level, expected.validated_level);
+        QCOMPARE(results[i].errors, expected.errors);
+        // A passing result names the file it vouches for
+        if (results[i].is_valid) {
+            QVERIFY(results[i].file_identity.has_value());
+            QVERIFY(results[i].file_identity == identify_file(files[i]));
+        }
+    }
+
+    const auto stats = batched.security_statistics();
+    QCOMPARE(stats.value("validations_performed").toInteger(), qint64(files.size()));
+    QCOMPARE(stats.value("validations_passed").toInteger() + stats.value("validations_failed").toInteger(),
+             qint64(files.size()));
+    QVERIFY(batched.validate_plugins({}, SecurityLevel::Basic).empty());
+}
+
 QTEST_MAIN(TestSecurityManagerSimple)
 #include "test_security_manager_simple.moc"
@@ -178,6 +178,7 @@ void PluginRegistry::onPluginStatusChanged(const QString& name, qtplugin::Plugin
         case qtplugin::PluginState::Stopped: statusStr = "Stopped"; break;
         case qtplugin::PluginState::Error: statusStr = "Error"; break;
         case qtplugin::PluginState::Reloading: statusStr = "Reloading"; break;
+        case qtplugin::PluginState::Discovered: statusStr = "Discovered"; break;
         }
         it->status = statusStr;
 
@@ -17,21 +17,356 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QHash>
+#include <QVector>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+namespace {
+
+constexpr qint64 kNoExpiry = std::numeric_limits<qint64>::max();
+constexpr int kMaxAuditEntries = 10000;
+constexpr int kAuditDrainIntervalMs = 250;
+constexpr int kCleanupIntervalMs = 60000;
+
+QString levelToString(PermissionLevel level) {
+    switch (level) {
+    case PermissionLevel::None: return "none";
+    case PermissionLevel::Read: return "read";
+    case PermissionLevel::Write: return "write";
+    case PermissionLevel::Execute: return "execute";
+    case PermissionLevel::Full: return "full";
+    case PermissionLevel::Admin: return "admin";
+    }
+    return "none";
+}
+
+PermissionLevel levelFromString(const QString& level) {
+    static const QHash<QString, PermissionLevel> levels = {
+        {"none", PermissionLevel::None}, {"read", PermissionLevel::Read},
+        {"write", PermissionLevel::Write}, {"execute", PermissionLevel::Execute},
+        {"full", PermissionLevel::Full}, {"admin", PermissionLevel::Admin}};
+    return levels.value(level.toLower(), PermissionLevel::None);
+}
+
+// Effective permissions of all plugins, rebuilt whenever grants, policies or
+// defaults change and never modified once published
+struct CompiledPermissions {
+    // A grant whose conditions are checked against the caller's context
+    struct ConditionalGrant {
+        int slot = 0;
+        PermissionLevel level = PermissionLevel::None;
+        QStringList conditions;
+        qint64 validUntil = kNoExpiry;
+    };
+
+    struct PluginTable {
+        QVector<quint8> levels;         // PermissionLevel by permission slot
+        qint64 validUntil = kNoExpiry;  // Earliest expiry of a compiled grant
+        QList<ConditionalGrant> conditional;
+    };
+
+    QHash<QString, int> slotIndex;         // Permission ID -> index into the level arrays
+    QVector<quint8> defaultLevels;      // Levels of plugins without grants or policies
+    QHash<QString, PluginTable> plugins;
+    qint64 validUntil = kNoExpiry;      // Earliest validUntil of all plugin tables
+};
+
+struct AuditRecord {
+    QString pluginId;
+    QString permissionId;
+    const char* action = nullptr;
+    PermissionLevel level = PermissionLevel::None;
+    qint64 timestamp = 0;
+};
+
+// Bounded multi-producer ring; one consumer at a time drains it
+class AuditRing {
+public:
+    static constexpr quint64 Capacity = 4096;
+
+    AuditRing() : m_cells(new Cell[Capacity]) {
+        for (quint64 i = 0; i < Capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(AuditRecord&& record) {
+        quint64 pos = m_tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & (Capacity - 1)];
+            const quint64 sequence = cell.sequence.load(std::memory_order_acquire);
+            const qint64 diff = qint64(sequence) - qint64(pos);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.record = std::move(record);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Full
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(AuditRecord& record) {
+        Cell& cell = m_cells[m_head & (Capacity - 1)];
+        if (cell.sequence.load(std::memory_order_acquire) != m_head + 1) {
+            return false;
+        }
+        record = std::move(cell.record);
+        cell.sequence.store(m_head + Capacity, std::memory_order_release);
+        ++m_head;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<quint64> sequence{0};
+        AuditRecord record;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    alignas(64) std::atomic<quint64> m_tail{0};
+    alignas(64) quint64 m_head = 0;
+};
+
+} // namespace
+
+// Permission data structure implementations
+bool PermissionGrant::isValid() const {
+    return status == PermissionStatus::Granted && !isExpired();
+}
+
+bool PermissionGrant::isExpired() const {
+    return expiryDate.isValid() && expiryDate <= QDateTime::currentDateTime();
+}
+
+bool PermissionGrant::hasConditions() const {
+    return !conditions.isEmpty();
+}
+
+void PermissionGrant::recordUsage() {
+    ++usageCount;
+    lastUsed = QDateTime::currentDateTime();
+}
+
+QString PermissionAuditEntry::generateAuditId() const {
+    return QString("audit_") + QUuid::createUuid().toString(QUuid::WithoutBraces);
+}
+
+// Private data structure for PluginPermissionManager
+struct PluginPermissionManager::PermissionManagerPrivate {
+    // Source of truth, guarded by mutex
+    QMap<QString, Permission> permissions;
+    QHash<QString, QHash<QString, PermissionGrant>> grants;  // Plugin ID -> permission ID -> grant
+    QMap<QString, QJsonObject> policies;
+    QHash<QString, QStringList> appliedPolicies;              // Plugin ID -> policy names
+    QMap<PermissionCategory, PermissionLevel> defaultLevels;
+    PermissionLevel autoApproveLevel = PermissionLevel::Read;
+    bool requireExplicitGrant = true;
+    mutable QMutex mutex;
+
+    // Read by the checks without locking
+    std::atomic<std::shared_ptr<const CompiledPermissions>> compiled{std::make_shared<const CompiledPermissions>()};
+    std::atomic<bool> auditingEnabled{true};
+
+    AuditRing auditRing;
+    std::atomic<quint64> droppedAuditRecords{0};
+    QList<PermissionAuditEntry> auditLog;
+    mutable QMutex auditMutex;  // Guards auditLog and the ring's consumer side
+
+    QTimer* auditTimer = nullptr;
+    QTimer* cleanupTimer = nullptr;
+    QTimer* expiryTimer = nullptr;      // Fires when the earliest compiled grant expires
+    qint64 scheduledExpiry = kNoExpiry;  // Guarded by mutex
+
+    // Called with mutex held
+    void compile();
+    void scheduleExpiry(qint64 expiry);
+    void recompile() {
+        QMutexLocker locker(&mutex);
+        compile();
+    }
+    // Rebuilds unless another thread already replaced the given table
+    void recompile(const CompiledPermissions* stale) {
+        QMutexLocker locker(&mutex);
+        if (compiled.load(std::memory_order_acquire).get() == stale) {
+            compile();
+        }
+    }
+
+    PermissionLevel effectiveLevel(const QString& pluginId, const QString& permissionId);
+    void audit(const QString& pluginId, const QString& permissionId, const char* action, PermissionLevel level);
+};
+
+void PluginPermissionManager::PermissionManagerPrivate::compile() {
+    auto table = std::make_shared<CompiledPermissions>();
+    auto slotOf = [&table](const QString& permissionId) {
+        auto it = table->slotIndex.constFind(permissionId);
+        if (it == table->slotIndex.cend()) {
+            it = table->slotIndex.insert(permissionId, int(table->slotIndex.size()));
+        }
+        return *it;
+    };
+
+    for (const Permission& permission : std::as_const(permissions)) {
+        slotOf(permission.id);
+    }
+    for (const auto& pluginGrants : std::as_const(grants)) {
+        for (auto it = pluginGrants.cbegin(); it != pluginGrants.cend(); ++it) {
+            slotOf(it.key());
+        }
+    }
+    QHash<QString, QList<QPair<int, PermissionLevel>>> policyRules;
+    for (auto it = policies.cbegin(); it != policies.cend(); ++it) {
+        const QJsonObject rules = it.value().value("permissions").toObject();
+        auto& compiledRules = policyRules[it.key()];
+        for (auto rule = rules.begin(); rule != rules.end(); ++rule) {
+            compiledRules.append({slotOf(rule.key()), levelFromString(rule.value().toString())});
+        }
+    }
+
+    table->defaultLevels.fill(quint8(PermissionLevel::None), int(table->slotIndex.size()));
+    if (!requireExplicitGrant) {
+        for (const Permission& permission : std::as_const(permissions)) {
+            table->defaultLevels[table->slotIndex.value(permission.id)] =
+                quint8(defaultLevels.value(permission.category, PermissionLevel::None));
+        }
+    }
+
+    auto pluginTable = [&table](const QString& pluginId) -> CompiledPermissions::PluginTable& {
+        auto it = table->plugins.find(pluginId);
+        if (it == table->plugins.end()) {
+            it = table->plugins.insert(pluginId, {table->defaultLevels, kNoExpiry, {}});
+        }
+        return *it;
+    };
+    auto raise = [](quint8& current, PermissionLevel level) {
+        current = std::max(current, quint8(level));
+    };
+
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    for (auto plugin = grants.cbegin(); plugin != grants.cend(); ++plugin) {
+        for (const PermissionGrant& grant : plugin.value()) {
+            if (grant.status != PermissionStatus::Granted) {
+                continue;
+            }
+            const qint64 expiry = grant.expiryDate.isValid() ? grant.expiryDate.toMSecsSinceEpoch() : kNoExpiry;
+            if (expiry <= now) {
+                continue;
+            }
+            auto& compiledPlugin = pluginTable(plugin.key());
+            // Conditions need the caller's context, so they are kept beside the levels
+            if (grant.hasConditions()) {
+                compiledPlugin.conditional.append(
+                    {table->slotIndex.value(grant.permissionId), grant.level, grant.conditions, expiry});
+                continue;
+            }
+            raise(compiledPlugin.levels[table->slotIndex.value(grant.permissionId)], grant.level);
+            compiledPlugin.validUntil = std::min(compiledPlugin.validUntil, expiry);
+            table->validUntil = std::min(table->validUntil, expiry);
+        }
+    }
+    for (auto plugin = appliedPolicies.cbegin(); plugin != appliedPolicies.cend(); ++plugin) {
+        for (const QString& policyName : plugin.value()) {
+            const auto rules = policyRules.constFind(policyName);
+            if (rules == policyRules.cend()) {
+                continue;
+            }
+            auto& compiledPlugin = pluginTable(plugin.key());
+            for (const auto& [slot, level] : *rules) {
+                raise(compiledPlugin.levels[slot], level);
+            }
+        }
+    }
+
+    const qint64 validUntil = table->validUntil;
+    compiled.store(std::move(table), std::memory_order_release);
+    scheduleExpiry(validUntil);
+}
+
+void PluginPermissionManager::PermissionManagerPrivate::scheduleExpiry(qint64 expiry) {
+    if (expiry == scheduledExpiry || !expiryTimer) {
+        return;
+    }
+    scheduledExpiry = expiry;
+    // Grants change on any thread; the timer lives on the manager's
+    QMetaObject::invokeMethod(expiryTimer, [timer = expiryTimer, expiry] {
+        if (expiry == kNoExpiry) {
+            timer->stop();
+            return;
+        }
+        const qint64 delay = expiry - QDateTime::currentMSecsSinceEpoch() + 1;
+        timer->start(int(std::clamp<qint64>(delay, 0, std::numeric_limits<int>::max())));
+    }, Qt::QueuedConnection);
+}
+
+PermissionLevel PluginPermissionManager::PermissionManagerPrivate::effectiveLevel(const QString& pluginId,
+                                                                                  const QString& permissionId) {
+    for (;;) {
+        const auto table = compiled.load(std::memory_order_acquire);
+        const auto slot = table->slotIndex.constFind(permissionId);
+        if (slot == table->slotIndex.cend()) {
+            return PermissionLevel::None;
+        }
+        const auto plugin = table->plugins.constFind(pluginId);
+        if (plugin == table->plugins.cend()) {
+            return PermissionLevel(table->defaultLevels[*slot]);
+        }
+        // A grant has expired before the expiry timer got to it; compiling
+        // drops it, and only the first checker to get here does the work
+        if (plugin->validUntil != kNoExpiry && QDateTime::currentMSecsSinceEpoch() >= plugin->validUntil) {
+            recompile(table.get());
+            continue;
+        }
+        return PermissionLevel(plugin->levels[*slot]);
+    }
+}
+
+void PluginPermissionManager::PermissionManagerPrivate::audit(const QString& pluginId, const QString& permissionId,
+                                                              const char* action, PermissionLevel level) {
+    if (!auditingEnabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (!auditRing.push({pluginId, permissionId, action, level, QDateTime::currentMSecsSinceEpoch()})) {
+        droppedAuditRecords.fetch_add(1, std::memory_order_relaxed);
+    }
+}
 
 // Implementation for PluginPermissionManager
 PluginPermissionManager::PluginPermissionManager(QObject* parent)
-    : QObject(parent) {
+    : QObject(parent)
+    , d(std::make_unique<PermissionManagerPrivate>()) {
     initializeManager();
 }
 
 PluginPermissionManager::~PluginPermissionManager() = default;
 
-// Stub implementations for PluginPermissionManager methods
-
 void PluginPermissionManager::initializeManager() {
-    // TODO: Initialize permission manager
     qDebug() << "Initializing permission manager";
     loadConfiguration();
+    setupCleanupTimer();
+
+    d->auditTimer = new QTimer(this);
+    d->auditTimer->setInterval(kAuditDrainIntervalMs);
+    connect(d->auditTimer, &QTimer::timeout, this, &PluginPermissionManager::drainAuditQueue);
+    d->auditTimer->start();
+}
+
+void PluginPermissionManager::setupCleanupTimer() {
+    d->cleanupTimer = new QTimer(this);
+    d->cleanupTimer->setInterval(kCleanupIntervalMs);
+    connect(d->cleanupTimer, &QTimer::timeout, this, &PluginPermissionManager::onCleanupTimer);
+    d->cleanupTimer->start();
+
+    d->expiryTimer = new QTimer(this);
+    d->expiryTimer->setSingleShot(true);
+    d->expiryTimer->setTimerType(Qt::PreciseTimer);
+    connect(d->expiryTimer, &QTimer::timeout, this, &PluginPermissionManager::onCleanupTimer);
 }
 
 void PluginPermissionManager::loadConfiguration() {
@@ -54,31 +389,39 @@ void PluginPermissionManager::createDefaultPolicies() {
     qDebug() << "Creating default policies";
 }
 
-// Stub implementations for required methods
-
 // Permission registration
 void PluginPermissionManager::registerPermission(const Permission& permission) {
-    Q_UNUSED(permission)
-    qDebug() << "registerPermission - stub implementation";
+    QMutexLocker locker(&d->mutex);
+    d->permissions.insert(permission.id, permission);
+    d->compile();
 }
 
 void PluginPermissionManager::unregisterPermission(const QString& permissionId) {
-    Q_UNUSED(permissionId)
-    qDebug() << "unregisterPermission - stub implementation";
+    QMutexLocker locker(&d->mutex);
+    if (d->permissions.remove(permissionId) > 0) {
+        d->compile();
+    }
 }
 
 Permission PluginPermissionManager::getPermission(const QString& permissionId) const {
-    Q_UNUSED(permissionId)
-    return Permission(); // Return default constructed Permission
+    QMutexLocker locker(&d->mutex);
+    return d->permissions.value(permissionId);
 }
 
 QList<Permission> PluginPermissionManager::getAllPermissions() const {
-    return QList<Permission>(); // Return empty list
+    QMutexLocker locker(&d->mutex);
+    return d->permissions.values();
 }
 
 QList<Permission> PluginPermissionManager::getPermissionsByCategory(PermissionCategory category) const {
-    Q_UNUSED(category)
-    return QList<Permission>(); // Return empty list
+    QMutexLocker locker(&d->mutex);
+    QList<Permission> result;
+    for (const Permission& permission : std::as_const(d->permissions)) {
+        if (permission.category == category) {
+            result.append(permission);
+        }
+    }
+    return result;
 }
 
 // Permission requests
@@ -113,123 +456,265 @@ QList<PermissionRequest> PluginPermissionManager::getRequestHistory(const QStrin
 
 // Permission grants
 void PluginPermissionManager::grantPermission(const QString& pluginId, const QString& permissionId, PermissionLevel level, PermissionScope scope) {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(permissionId)
-    Q_UNUSED(level)
-    Q_UNUSED(scope)
-    qDebug() << "grantPermission - stub implementation";
+    PermissionGrant grant(permissionId, pluginId, level);
+    grant.scope = scope;
+    grantPermission(grant);
+}
+
+void PluginPermissionManager::grantPermission(const PermissionGrant& grant) {
+    {
+        QMutexLocker locker(&d->mutex);
+        d->grants[grant.pluginId].insert(grant.permissionId, grant);
+        d->compile();
+    }
+    d->audit(grant.pluginId, grant.permissionId, "granted", grant.level);
+    emit permissionGranted(grant.pluginId, grant.permissionId, grant.level);
 }
 
 void PluginPermissionManager::revokePermission(const QString& pluginId, const QString& permissionId) {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(permissionId)
-    qDebug() << "revokePermission - stub implementation";
+    {
+        QMutexLocker locker(&d->mutex);
+        auto plugin = d->grants.find(pluginId);
+        if (plugin == d->grants.end() || plugin->remove(permissionId) == 0) {
+            return;
+        }
+        if (plugin->isEmpty()) {
+            d->grants.erase(plugin);
+        }
+        d->compile();
+    }
+    d->audit(pluginId, permissionId, "revoked", PermissionLevel::None);
+    emit permissionRevoked(pluginId, permissionId);
 }
 
 void PluginPermissionManager::revokeAllPermissions(const QString& pluginId) {
-    Q_UNUSED(pluginId)
-    qDebug() << "revokeAllPermissions - stub implementation";
+    QStringList revoked;
+    {
+        QMutexLocker locker(&d->mutex);
+        revoked = d->grants.take(pluginId).keys();
+        if (revoked.isEmpty()) {
+            return;
+        }
+        d->compile();
+    }
+    for (const QString& permissionId : std::as_const(revoked)) {
+        d->audit(pluginId, permissionId, "revoked", PermissionLevel::None);
+        emit permissionRevoked(pluginId, permissionId);
+    }
 }
 
 QList<PermissionGrant> PluginPermissionManager::getGrantedPermissions(const QString& pluginId) const {
-    Q_UNUSED(pluginId)
-    return QList<PermissionGrant>(); // Return empty list
+    QMutexLocker locker(&d->mutex);
+    return d->grants.value(pluginId).values();
 }
 
 QList<PermissionGrant> PluginPermissionManager::getAllGrants() const {
-    return QList<PermissionGrant>(); // Return empty list
+    QMutexLocker locker(&d->mutex);
+    QList<PermissionGrant> result;
+    for (const auto& pluginGrants : std::as_const(d->grants)) {
+        result.append(pluginGrants.values());
+    }
+    return result;
 }
 
 // Permission checking
 bool PluginPermissionManager::hasPermission(const QString& pluginId, const QString& permissionId, PermissionLevel requiredLevel) const {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(permissionId)
-    Q_UNUSED(requiredLevel)
-    return true; // Allow all for stub implementation
+    const PermissionLevel level = d->effectiveLevel(pluginId, permissionId);
+    const bool granted = level >= requiredLevel;
+    d->audit(pluginId, permissionId, granted ? "used" : "denied", requiredLevel);
+    return granted;
 }
 
 PermissionLevel PluginPermissionManager::getPermissionLevel(const QString& pluginId, const QString& permissionId) const {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(permissionId)
-    return PermissionLevel::Read; // Return default level
+    return d->effectiveLevel(pluginId, permissionId);
 }
 
 PermissionStatus PluginPermissionManager::checkPermission(const QString& pluginId, const QString& permissionId, PermissionLevel requiredLevel) const {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(permissionId)
-    Q_UNUSED(requiredLevel)
-    return PermissionStatus::Granted; // Return granted for stub
+    return d->effectiveLevel(pluginId, permissionId) >= requiredLevel ? PermissionStatus::Granted
+                                                                      : PermissionStatus::Denied;
 }
 
 bool PluginPermissionManager::canPerformAction(const QString& pluginId, const QString& action, const QJsonObject& context) const {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(action)
-    Q_UNUSED(context)
-    return true; // Allow all for stub implementation
+    const auto requiredLevel = context.contains("level") ? levelFromString(context.value("level").toString())
+                                                         : PermissionLevel::Read;
+    if (d->effectiveLevel(pluginId, action) >= requiredLevel) {
+        d->audit(pluginId, action, "used", requiredLevel);
+        return true;
+    }
+
+    // The compiled levels fall short; a conditional grant may still hold in this context
+    bool granted = false;
+    const auto table = d->compiled.load(std::memory_order_acquire);
+    const auto slot = table->slotIndex.constFind(action);
+    const auto plugin = table->plugins.constFind(pluginId);
+    if (slot != table->slotIndex.cend() && plugin != table->plugins.cend()) {
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        for (const auto& grant : plugin->conditional) {
+            if (grant.slot == *slot && grant.level >= requiredLevel && now < grant.validUntil &&
+                evaluateConditions(grant.conditions, pluginId, context)) {
+                granted = true;
+                break;
+            }
+        }
+    }
+    d->audit(pluginId, action, granted ? "used" : "denied", requiredLevel);
+    return granted;
+}
+
+// Each condition is "key=value", "key!=value" or a bare "key" whose context
+// value must be true; "pluginId" refers to the checked plugin. All must hold.
+bool PluginPermissionManager::evaluateConditions(const QStringList& conditions, const QString& pluginId, const QJsonObject& context) const {
+    for (const QString& condition : conditions) {
+        const qsizetype separator = condition.indexOf('=');
+        if (separator < 0) {
+            if (!context.value(condition.trimmed()).toBool()) {
+                return false;
+            }
+            continue;
+        }
+        const bool negated = separator > 0 && condition.at(separator - 1) == '!';
+        const QString key = condition.left(negated ? separator - 1 : separator).trimmed();
+        const QString expected = condition.mid(separator + 1).trimmed();
+        const QJsonValue value = key == "pluginId" ? QJsonValue(pluginId) : context.value(key);
+        const bool matches = !value.isUndefined() && value.toVariant().toString() == expected;
+        if (matches == negated) {
+            return false;
+        }
+    }
+    return true;
 }
 
 // Permission policies
 void PluginPermissionManager::setPermissionPolicy(const QString& policyName, const QJsonObject& policy) {
-    Q_UNUSED(policyName)
-    Q_UNUSED(policy)
-    qDebug() << "setPermissionPolicy - stub implementation";
+    QMutexLocker locker(&d->mutex);
+    d->policies.insert(policyName, policy);
+    d->compile();
 }
 
 QJsonObject PluginPermissionManager::getPermissionPolicy(const QString& policyName) const {
-    Q_UNUSED(policyName)
-    return QJsonObject(); // Return empty object
+    QMutexLocker locker(&d->mutex);
+    return d->policies.value(policyName);
 }
 
 void PluginPermissionManager::removePermissionPolicy(const QString& policyName) {
-    Q_UNUSED(policyName)
-    qDebug() << "removePermissionPolicy - stub implementation";
+    QMutexLocker locker(&d->mutex);
+    if (d->policies.remove(policyName) == 0) {
+        return;
+    }
+    for (auto& names : d->appliedPolicies) {
+        names.removeAll(policyName);
+    }
+    d->compile();
 }
 
 QStringList PluginPermissionManager::getAvailablePolicies() const {
-    return QStringList(); // Return empty list
+    QMutexLocker locker(&d->mutex);
+    return d->policies.keys();
 }
 
 void PluginPermissionManager::applyPolicy(const QString& pluginId, const QString& policyName) {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(policyName)
-    qDebug() << "applyPolicy - stub implementation";
+    {
+        QMutexLocker locker(&d->mutex);
+        if (!d->policies.contains(policyName)) {
+            qWarning() << "Unknown permission policy" << policyName;
+            return;
+        }
+        QStringList& names = d->appliedPolicies[pluginId];
+        if (names.contains(policyName)) {
+            return;
+        }
+        names.append(policyName);
+        d->compile();
+    }
+    d->audit(pluginId, QString(), "policy_applied", PermissionLevel::None);
+    emit policyApplied(pluginId, policyName);
 }
 
 // Bulk operations
 void PluginPermissionManager::grantPermissionSet(const QString& pluginId, const QStringList& permissionIds, PermissionLevel level) {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(permissionIds)
-    Q_UNUSED(level)
-    qDebug() << "grantPermissionSet - stub implementation";
+    {
+        QMutexLocker locker(&d->mutex);
+        auto& pluginGrants = d->grants[pluginId];
+        for (const QString& permissionId : permissionIds) {
+            pluginGrants.insert(permissionId, PermissionGrant(permissionId, pluginId, level));
+        }
+        d->compile();
+    }
+    for (const QString& permissionId : permissionIds) {
+        d->audit(pluginId, permissionId, "granted", level);
+        emit permissionGranted(pluginId, permissionId, level);
+    }
 }
 
 void PluginPermissionManager::revokePermissionSet(const QString& pluginId, const QStringList& permissionIds) {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(permissionIds)
-    qDebug() << "revokePermissionSet - stub implementation";
+    QStringList revoked;
+    {
+        QMutexLocker locker(&d->mutex);
+        auto plugin = d->grants.find(pluginId);
+        if (plugin == d->grants.end()) {
+            return;
+        }
+        for (const QString& permissionId : permissionIds) {
+            if (plugin->remove(permissionId) > 0) {
+                revoked.append(permissionId);
+            }
+        }
+        if (plugin->isEmpty()) {
+            d->grants.erase(plugin);
+        }
+        if (revoked.isEmpty()) {
+            return;
+        }
+        d->compile();
+    }
+    for (const QString& permissionId : std::as_const(revoked)) {
+        d->audit(pluginId, permissionId, "revoked", PermissionLevel::None);
+        emit permissionRevoked(pluginId, permissionId);
+    }
 }
 
 void PluginPermissionManager::copyPermissions(const QString& fromPluginId, const QString& toPluginId) {
-    Q_UNUSED(fromPluginId)
-    Q_UNUSED(toPluginId)
-    qDebug() << "copyPermissions - stub implementation";
+    QMutexLocker locker(&d->mutex);
+    auto copied = d->grants.value(fromPluginId);
+    for (PermissionGrant& grant : copied) {
+        grant.pluginId = toPluginId;
+        grant.grantedDate = QDateTime::currentDateTime();
+        grant.usageCount = 0;
+        grant.lastUsed = QDateTime();
+    }
+    d->grants.insert(toPluginId, copied);
+    d->appliedPolicies.insert(toPluginId, d->appliedPolicies.value(fromPluginId));
+    d->compile();
 }
 
 void PluginPermissionManager::resetPermissions(const QString& pluginId) {
-    Q_UNUSED(pluginId)
-    qDebug() << "resetPermissions - stub implementation";
+    {
+        QMutexLocker locker(&d->mutex);
+        d->appliedPolicies.remove(pluginId);
+    }
+    revokeAllPermissions(pluginId);
+    d->recompile();
 }
 
 // Audit and logging
 QList<PermissionAuditEntry> PluginPermissionManager::getAuditLog(const QString& pluginId, int maxEntries) const {
-    Q_UNUSED(pluginId)
-    Q_UNUSED(maxEntries)
-    return QList<PermissionAuditEntry>(); // Return empty list
+    QMutexLocker locker(&d->auditMutex);
+    QList<PermissionAuditEntry> result;
+    for (auto it = d->auditLog.crbegin(); it != d->auditLog.crend() && result.size() < maxEntries; ++it) {
+        if (pluginId.isEmpty() || it->pluginId == pluginId) {
+            result.prepend(*it);
+        }
+    }
+    return result;
 }
 
 void PluginPermissionManager::clearAuditLog(const QString& pluginId) {
-    Q_UNUSED(pluginId)
-    qDebug() << "clearAuditLog - stub implementation";
+    QMutexLocker locker(&d->auditMutex);
+    if (pluginId.isEmpty()) {
+        d->auditLog.clear();
+    } else {
+        d->auditLog.removeIf([&pluginId](const PermissionAuditEntry& entry) { return entry.pluginId == pluginId; });
+    }
 }
 
 void PluginPermissionManager::exportAuditLog(const QString& filePath, const QString& format) const {
@@ -238,43 +723,136 @@ void PluginPermissionManager::exportAuditLog(const QString& filePath, const QStr
     qDebug() << "exportAuditLog - stub implementation";
 }
 
+void PluginPermissionManager::logAuditEntry(const PermissionAuditEntry& entry) {
+    {
+        QMutexLocker locker(&d->auditMutex);
+        d->auditLog.append(entry);
+        if (d->auditLog.size() > kMaxAuditEntries) {
+            d->auditLog.remove(0, d->auditLog.size() - kMaxAuditEntries);
+        }
+    }
+    emit auditEntryAdded(entry);
+}
+
+void PluginPermissionManager::drainAuditQueue() {
+    QList<AuditRecord> records;
+    quint64 dropped = 0;
+    {
+        QMutexLocker locker(&d->auditMutex);
+        AuditRecord record;
+        while (d->auditRing.pop(record)) {
+            records.append(std::move(record));
+        }
+        dropped = d->droppedAuditRecords.exchange(0, std::memory_order_relaxed);
+    }
+
+    if (dropped > 0) {
+        PermissionAuditEntry entry(QString(), QString(), "dropped");
+        entry.details = QString("%1 audit records dropped while the queue was full").arg(dropped);
+        logAuditEntry(entry);
+    }
+    for (const AuditRecord& record : std::as_const(records)) {
+        PermissionAuditEntry entry(record.pluginId, record.permissionId, QString::fromLatin1(record.action));
+        entry.level = record.level;
+        entry.timestamp = QDateTime::fromMSecsSinceEpoch(record.timestamp);
+        logAuditEntry(entry);
+
+        if (qstrcmp(record.action, "used") == 0) {
+            onPermissionUsed(record.pluginId, record.permissionId);
+        } else if (qstrcmp(record.action, "denied") == 0) {
+            emit permissionDenied(record.pluginId, record.permissionId,
+                                  QString("Requires %1 access").arg(levelToString(record.level)));
+        }
+    }
+}
+
 // Configuration
 void PluginPermissionManager::setDefaultPermissionLevel(PermissionCategory category, PermissionLevel level) {
-    Q_UNUSED(category)
-    Q_UNUSED(level)
-    qDebug() << "setDefaultPermissionLevel - stub implementation";
+    QMutexLocker locker(&d->mutex);
+    d->defaultLevels.insert(category, level);
+    d->compile();
 }
 
 PermissionLevel PluginPermissionManager::getDefaultPermissionLevel(PermissionCategory category) const {
-    Q_UNUSED(category)
-    return PermissionLevel::Read; // Return default level
+    QMutexLocker locker(&d->mutex);
+    return d->defaultLevels.value(category, PermissionLevel::None);
 }
 
 void PluginPermissionManager::setRequireExplicitGrant(bool require) {
-    Q_UNUSED(require)
-    qDebug() << "setRequireExplicitGrant - stub implementation";
+    QMutexLocker locker(&d->mutex);
+    d->requireExplicitGrant = require;
+    d->compile();
 }
 
 bool PluginPermissionManager::requireExplicitGrant() const {
-    return true; // Return default value
+    QMutexLocker locker(&d->mutex);
+    return d->requireExplicitGrant;
 }
 
 void PluginPermissionManager::setAuditingEnabled(bool enabled) {
-    Q_UNUSED(enabled)
-    qDebug() << "setAuditingEnabled - stub implementation";
+    d->auditingEnabled.store(enabled, std::memory_order_relaxed);
 }
 
 bool PluginPermissionManager::isAuditingEnabled() const {
-    return true; // Return default value
+    return d->auditingEnabled.load(std::memory_order_relaxed);
 }
 
 void PluginPermissionManager::setAutoApproveLevel(PermissionLevel level) {
-    Q_UNUSED(level)
-    qDebug() << "setAutoApproveLevel - stub implementation";
+    QMutexLocker locker(&d->mutex);
+    d->autoApproveLevel = level;
 }
 
 PermissionLevel PluginPermissionManager::autoApproveLevel() const {
-    return PermissionLevel::Read; // Return default level
+    QMutexLocker locker(&d->mutex);
+    return d->autoApproveLevel;
+}
+
+// Slots
+void PluginPermissionManager::refreshPermissions() {
+    d->recompile();
+}
+
+void PluginPermissionManager::cleanupExpiredGrants() {
+    QList<PermissionGrant> expired;
+    {
+        QMutexLocker locker(&d->mutex);
+        for (auto& pluginGrants : d->grants) {
+            for (PermissionGrant& grant : pluginGrants) {
+                if (grant.status == PermissionStatus::Granted && grant.isExpired()) {
+                    grant.status = PermissionStatus::Expired;
+                    expired.append(grant);
+                }
+            }
+        }
+        if (expired.isEmpty()) {
+            // Woken before the earliest expiry; wait for it again
+            d->scheduledExpiry = kNoExpiry;
+            d->scheduleExpiry(d->compiled.load(std::memory_order_acquire)->validUntil);
+            return;
+        }
+        d->compile();
+    }
+    for (const PermissionGrant& grant : std::as_const(expired)) {
+        d->audit(grant.pluginId, grant.permissionId, "expired", grant.level);
+    }
+}
+
+void PluginPermissionManager::onCleanupTimer() {
+    cleanupExpiredGrants();
+}
+
+void PluginPermissionManager::onPermissionUsed(const QString& pluginId, const QString& permissionId) {
+    {
+        QMutexLocker locker(&d->mutex);
+        auto plugin = d->grants.find(pluginId);
+        if (plugin != d->grants.end()) {
+            auto grant = plugin->find(permissionId);
+            if (grant != plugin->end()) {
+                grant->recordUsage();
+            }
+        }
+    }
+    emit permissionUsed(pluginId, permissionId);
 }
 
 // Note: MOC file will be generated automatically by CMake
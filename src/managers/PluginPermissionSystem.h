@@ -274,12 +274,19 @@ public:
     
     // Permission grants
     void grantPermission(const QString& pluginId, const QString& permissionId, PermissionLevel level, PermissionScope scope = PermissionScope::User);
+    void grantPermission(const PermissionGrant& grant);  // Keeps the grant's expiry and conditions
     void revokePermission(const QString& pluginId, const QString& permissionId);
     void revokeAllPermissions(const QString& pluginId);
     QList<PermissionGrant> getGrantedPermissions(const QString& pluginId) const;
     QList<PermissionGrant> getAllGrants() const;
     
     // Permission checking
+    // Checks read a table compiled on every grant, revoke, policy or default
+    // change and take no lock. Access is denied unless granted: category
+    // defaults apply only after setRequireExplicitGrant(false).
+    // canPerformAction() treats the action as a permission ID with the required
+    // level in context["level"] (default "read"); it is the only check that
+    // honours conditional grants, evaluated against the context
     bool hasPermission(const QString& pluginId, const QString& permissionId, PermissionLevel requiredLevel = PermissionLevel::Read) const;
     PermissionLevel getPermissionLevel(const QString& pluginId, const QString& permissionId) const;
     PermissionStatus checkPermission(const QString& pluginId, const QString& permissionId, PermissionLevel requiredLevel = PermissionLevel::Read) const;
@@ -299,6 +306,8 @@ public:
     void resetPermissions(const QString& pluginId);
     
     // Audit and logging
+    // Entries are queued in a ring buffer and written to the log by a timer,
+    // so they appear shortly after the event; entries are dropped while the ring is full
     QList<PermissionAuditEntry> getAuditLog(const QString& pluginId = "", int maxEntries = 1000) const;
     void clearAuditLog(const QString& pluginId = "");
     void exportAuditLog(const QString& filePath, const QString& format = "json") const;
@@ -349,6 +358,10 @@ private:
     void logAuditEntry(const PermissionAuditEntry& entry);
     bool evaluateConditions(const QStringList& conditions, const QString& pluginId, const QJsonObject& context) const;
     QString generateGrantId() const;
+    void drainAuditQueue();
+
+    struct PermissionManagerPrivate;
+    std::unique_ptr<PermissionManagerPrivate> d;
 };
 
 // Permission group for organizing related permissions
@@ -16,6 +16,35 @@
 #include <QFileDialog>
 #include <QCryptographicHash>
 #include <QSslConfiguration>
+#include <QSaveFile>
+#include <algorithm>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QtConcurrent>
+
+namespace {
+
+// Certificate chain validation results are reused for at most this long
+constexpr qint64 chainCheckTtlSecs = 300;
+
+QJsonObject readJsonFile(const QString& filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QJsonObject();
+    }
+    return QJsonDocument::fromJson(file.readAll()).object();
+}
+
+bool writeJsonFile(const QString& filePath, const QJsonObject& json) {
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(QJsonDocument(json).toJson());
+    return file.commit();
+}
+
+} // namespace
 
 // CertificateInfo implementation
 CertificateInfo::CertificateInfo(const QSslCertificate& cert)
@@ -75,6 +104,25 @@ struct PluginSignatureVerifier::SignatureVerifierPrivate {
     bool timestampRequired;
     QString trustStoreDirectory;
     
+    // Signature checks by plugin path, reused while the file is unchanged;
+    // the trust policy is applied on every verification
+    struct FileCheck {
+        qint64 size = -1;
+        QDateTime modified;
+        QDateTime metadataChanged;
+        SignatureInfo info;
+    };
+    QHash<QString, FileCheck> fileChecks;
+    QMutex fileChecksMutex;
+    
+    // Certificate chain validation results by the chain's fingerprints
+    struct ChainCheck {
+        bool valid = false;
+        QDateTime expires;
+    };
+    QHash<QString, ChainCheck> chainChecks;
+    QMutex chainChecksMutex;
+    
     SignatureVerifierPrivate() 
         : requireSignatures(false)
         , allowSelfSigned(true)
@@ -115,16 +163,43 @@ void PluginSignatureVerifier::initializeVerifier() {
 }
 
 SignatureInfo PluginSignatureVerifier::verifyPlugin(const QString& pluginPath) {
-    SignatureInfo info(pluginPath);
-    
-    if (!QFile::exists(pluginPath)) {
+    SignatureInfo info = checkSignature(pluginPath);
+    applyTrustPolicy(info);
+    emit verificationCompleted(pluginPath, info.status);
+    return info;
+}
+
+SignatureInfo PluginSignatureVerifier::checkSignature(const QString& pluginPath) {
+    const QFileInfo fileInfo(pluginPath);
+    if (!fileInfo.exists()) {
+        SignatureInfo info(pluginPath);
         info.status = VerificationStatus::Unknown;
         info.statusMessage = "Plugin file not found";
         return info;
     }
     
+    {
+        QMutexLocker locker(&d->fileChecksMutex);
+        const auto it = d->fileChecks.constFind(pluginPath);
+        if (it != d->fileChecks.constEnd() && it->size == fileInfo.size() &&
+            it->modified == fileInfo.lastModified() && it->metadataChanged == fileInfo.metadataChangeTime()) {
+            return it->info;
+        }
+    }
+    
+    SignatureInfo info = checkSignatureUncached(pluginPath);
+    
+    // Read errors are retried on the next call
+    if (info.status != VerificationStatus::Unknown) {
+        QMutexLocker locker(&d->fileChecksMutex);
+        d->fileChecks.insert(pluginPath, {fileInfo.size(), fileInfo.lastModified(), fileInfo.metadataChangeTime(), info});
+    }
+    return info;
+}
+
+SignatureInfo PluginSignatureVerifier::checkSignatureUncached(const QString& pluginPath) {
     // Extract signature information
-    info = extractSignatureInfo(pluginPath);
+    SignatureInfo info = extractSignatureInfo(pluginPath);
     
     if (info.signatureData.isEmpty()) {
         info.status = VerificationStatus::NotSigned;
@@ -133,68 +208,78 @@ SignatureInfo PluginSignatureVerifier::verifyPlugin(const QString& pluginPath) {
         if (d->requireSignatures) {
             info.validationErrors << "Signature required but not found";
         }
-        
-        emit verificationCompleted(pluginPath, info.status);
         return info;
     }
     
-    // Verify signature
-    QByteArray pluginData;
+    // Verify signature over the mapped file instead of a copy
     QFile file(pluginPath);
-    if (file.open(QIODevice::ReadOnly)) {
-        pluginData = file.readAll();
-    } else {
+    if (!file.open(QIODevice::ReadOnly)) {
         info.status = VerificationStatus::Unknown;
         info.statusMessage = "Cannot read plugin file";
-        emit verificationCompleted(pluginPath, info.status);
         return info;
     }
+    const uchar* mapped = file.size() > 0 ? file.map(0, file.size()) : nullptr;
+    const QByteArray pluginData = mapped
+        ? QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), file.size())
+        : file.readAll();
     
-    // Validate signature data
+    // Validate signature data; the trust policy decides the final status
     if (validateSignatureData(info.signatureData, pluginData, info.signerCertificate)) {
-        // Check certificate trust level
-        TrustLevel trustLevel = getCertificateTrustLevel(info.signerCertificate.fingerprint);
-        
-        switch (trustLevel) {
-        case TrustLevel::Trusted:
-            info.status = VerificationStatus::Valid;
-            info.statusMessage = "Signature is valid and trusted";
-            break;
-        case TrustLevel::Conditional:
-            info.status = VerificationStatus::Untrusted;
-            info.statusMessage = "Signature is valid but conditionally trusted";
-            break;
-        case TrustLevel::Untrusted:
-            info.status = VerificationStatus::Untrusted;
-            info.statusMessage = "Signature is valid but not trusted";
-            break;
-        case TrustLevel::Blocked:
-            info.status = VerificationStatus::Invalid;
-            info.statusMessage = "Certificate is blocked";
-            break;
-        }
-        
-        // Check certificate validity
-        if (info.signerCertificate.isExpired()) {
-            info.status = VerificationStatus::Expired;
-            info.statusMessage = "Certificate has expired";
-        }
-        
-        // Check revocation if enabled
-        if (d->checkRevocation && d->revocationChecker->isRevoked(info.signerCertificate.fingerprint)) {
-            info.status = VerificationStatus::Revoked;
-            info.statusMessage = "Certificate has been revoked";
-        }
-        
+        info.status = VerificationStatus::Valid;
+        info.statusMessage = "Signature is valid";
     } else {
         info.status = VerificationStatus::Invalid;
         info.statusMessage = "Signature validation failed";
     }
-    
-    emit verificationCompleted(pluginPath, info.status);
     return info;
 }
 
+void PluginSignatureVerifier::applyTrustPolicy(SignatureInfo& info) const {
+    if (info.status != VerificationStatus::Valid) {
+        return;
+    }
+    
+    if (!info.certificateChain.isEmpty() && !validateCertificateChain(info.certificateChain)) {
+        info.status = VerificationStatus::Invalid;
+        info.statusMessage = "Certificate chain is not valid";
+        return;
+    }
+    
+    // Check certificate trust level
+    TrustLevel trustLevel = getCertificateTrustLevel(info.signerCertificate.fingerprint);
+    
+    switch (trustLevel) {
+    case TrustLevel::Trusted:
+        info.status = VerificationStatus::Valid;
+        info.statusMessage = "Signature is valid and trusted";
+        break;
+    case TrustLevel::Conditional:
+        info.status = VerificationStatus::Untrusted;
+        info.statusMessage = "Signature is valid but conditionally trusted";
+        break;
+    case TrustLevel::Untrusted:
+        info.status = VerificationStatus::Untrusted;
+        info.statusMessage = "Signature is valid but not trusted";
+        break;
+    case TrustLevel::Blocked:
+        info.status = VerificationStatus::Invalid;
+        info.statusMessage = "Certificate is blocked";
+        break;
+    }
+    
+    // Check certificate validity
+    if (info.signerCertificate.isExpired()) {
+        info.status = VerificationStatus::Expired;
+        info.statusMessage = "Certificate has expired";
+    }
+    
+    // Check revocation if enabled
+    if (d->checkRevocation && d->revocationChecker->isRevoked(info.signerCertificate.fingerprint)) {
+        info.status = VerificationStatus::Revoked;
+        info.statusMessage = "Certificate has been revoked";
+    }
+}
+
 VerificationStatus PluginSignatureVerifier::verifySignature(const QString& pluginPath, const QString& signatureData) {
     if (!QFile::exists(pluginPath) || signatureData.isEmpty()) {
         return VerificationStatus::Unknown;
@@ -223,17 +308,30 @@ bool PluginSignatureVerifier::verifyIntegrity(const QString& pluginPath, const Q
 }
 
 QStringList PluginSignatureVerifier::verifyPluginBundle(const QStringList& pluginPaths) {
-    QStringList results;
+    // Reading and checking the files runs on the global thread pool; trust
+    // store lookups and signals stay on this thread
+    const QList<SignatureInfo> checked = QtConcurrent::blockingMapped<QList<SignatureInfo>>(
+        pluginPaths, [this](const QString& path) { return checkSignature(path); });
     
-    for (const QString& path : pluginPaths) {
-        SignatureInfo info = verifyPlugin(path);
-        QString result = QString("%1: %2").arg(path, info.statusMessage);
-        results << result;
+    QStringList results;
+    for (SignatureInfo info : checked) {
+        applyTrustPolicy(info);
+        emit verificationCompleted(info.pluginPath, info.status);
+        results << QString("%1: %2").arg(info.pluginPath, info.statusMessage);
     }
     
     return results;
 }
 
+void PluginSignatureVerifier::invalidateVerificationCache(const QString& pluginPath) {
+    QMutexLocker locker(&d->fileChecksMutex);
+    if (pluginPath.isEmpty()) {
+        d->fileChecks.clear();
+    } else {
+        d->fileChecks.remove(pluginPath);
+    }
+}
+
 // Certificate management methods
 void PluginSignatureVerifier::addTrustedCertificate(const CertificateInfo& certificate, const QString& description) {
     TrustStoreEntry entry(certificate, TrustLevel::Trusted);
@@ -304,14 +402,35 @@ bool PluginSignatureVerifier::validateCertificateChain(const QList<CertificateIn
         return false;
     }
 
-    // Basic chain validation - in production this would be more comprehensive
+    QStringList fingerprints;
+    for (const CertificateInfo& cert : chain) {
+        fingerprints << cert.fingerprint;
+    }
+    const QString key = fingerprints.join(':');
+    const QDateTime now = QDateTime::currentDateTime();
+    {
+        QMutexLocker locker(&d->chainChecksMutex);
+        const auto it = d->chainChecks.constFind(key);
+        if (it != d->chainChecks.constEnd() && now < it->expires) {
+            return it->valid;
+        }
+    }
+
+    // Basic chain validation - in production this would be more comprehensive;
+    // a valid chain is only reused until its first certificate expires
+    bool valid = true;
+    QDateTime expires = now.addSecs(chainCheckTtlSecs);
     for (const CertificateInfo& cert : chain) {
         if (!cert.isValid()) {
-            return false;
+            valid = false;
+            break;
         }
+        expires = qMin(expires, cert.validTo);
     }
 
-    return true;
+    QMutexLocker locker(&d->chainChecksMutex);
+    d->chainChecks.insert(key, {valid, expires});
+    return valid;
 }
 
 bool PluginSignatureVerifier::checkCertificateRevocation(const CertificateInfo& certificate) const {
@@ -381,6 +500,7 @@ QString PluginSignatureVerifier::generateSignature(const QByteArray& data, const
 // Configuration methods
 void PluginSignatureVerifier::setRequireSignatures(bool require) {
     d->requireSignatures = require;
+    invalidateVerificationCache();
     saveConfiguration();
 }
 
@@ -761,4 +881,191 @@ bool SignatureValidator::verifyHash(const QByteArray& data, const QString& expec
     return actualHash.compare(expectedHash, Qt::CaseInsensitive) == 0;
 }
 
+// TrustStore implementation
+TrustStore::TrustStore(const QString& storeDirectory, QObject* parent)
+    : QObject(parent)
+    , m_storeDirectory(storeDirectory) {
+    ensureStoreDirectory();
+    m_storeFilePath = getStoreFilePath();
+}
+
+TrustStore::~TrustStore() = default;
+
+void TrustStore::addEntry(const TrustStoreEntry& entry) {
+    if (entry.fingerprint.isEmpty()) {
+        return;
+    }
+    m_entries.insert(entry.fingerprint, entry);
+    m_lastModified = QDateTime::currentDateTime();
+    emit entryAdded(entry.fingerprint);
+}
+
+void TrustStore::removeEntry(const QString& fingerprint) {
+    if (m_entries.remove(fingerprint) > 0) {
+        m_lastModified = QDateTime::currentDateTime();
+        emit entryRemoved(fingerprint);
+    }
+}
+
+void TrustStore::updateEntry(const TrustStoreEntry& entry) {
+    auto it = m_entries.find(entry.fingerprint);
+    if (it == m_entries.end()) {
+        return;
+    }
+    const TrustLevel oldLevel = it->trustLevel;
+    *it = entry;
+    m_lastModified = QDateTime::currentDateTime();
+    emit entryUpdated(entry.fingerprint);
+    if (oldLevel != entry.trustLevel) {
+        emit trustLevelChanged(entry.fingerprint, oldLevel, entry.trustLevel);
+    }
+}
+
+TrustStoreEntry TrustStore::getEntry(const QString& fingerprint) const {
+    return m_entries.value(fingerprint);
+}
+
+QList<TrustStoreEntry> TrustStore::getAllEntries() const {
+    return m_entries.values();
+}
+
+QList<TrustStoreEntry> TrustStore::getEntriesByTrustLevel(TrustLevel level) const {
+    QList<TrustStoreEntry> entries;
+    for (const TrustStoreEntry& entry : m_entries) {
+        if (entry.trustLevel == level) {
+            entries.append(entry);
+        }
+    }
+    return entries;
+}
+
+bool TrustStore::isTrusted(const QString& fingerprint) const {
+    return getTrustLevel(fingerprint) == TrustLevel::Trusted;
+}
+
+bool TrustStore::isBlocked(const QString& fingerprint) const {
+    const auto it = m_entries.constFind(fingerprint);
+    return it != m_entries.constEnd() && it->trustLevel == TrustLevel::Blocked;
+}
+
+TrustLevel TrustStore::getTrustLevel(const QString& fingerprint) const {
+    const auto it = m_entries.constFind(fingerprint);
+    if (it == m_entries.constEnd()) {
+        return TrustLevel::Untrusted;
+    }
+    // Disabled entries still block
+    if (!it->isEnabled && it->trustLevel != TrustLevel::Blocked) {
+        return TrustLevel::Untrusted;
+    }
+    return it->trustLevel;
+}
+
+void TrustStore::setTrustLevel(const QString& fingerprint, TrustLevel level) {
+    auto it = m_entries.find(fingerprint);
+    if (it == m_entries.end() || it->trustLevel == level) {
+        return;
+    }
+    const TrustLevel oldLevel = it->trustLevel;
+    it->trustLevel = level;
+    m_lastModified = QDateTime::currentDateTime();
+    emit trustLevelChanged(fingerprint, oldLevel, level);
+}
+
+void TrustStore::loadStore() {
+    m_entries.clear();
+    const QJsonArray entries = readJsonFile(m_storeFilePath).value("entries").toArray();
+    for (const QJsonValue& value : entries) {
+        TrustStoreEntry entry = entryFromJson(value.toObject());
+        if (!entry.fingerprint.isEmpty()) {
+            m_entries.insert(entry.fingerprint, entry);
+        }
+    }
+    m_lastModified = QFileInfo(m_storeFilePath).lastModified();
+    emit storeLoaded();
+}
+
+void TrustStore::saveStore() {
+    exportStore(m_storeFilePath);
+    emit storeSaved();
+}
+
+void TrustStore::clearStore() {
+    m_entries.clear();
+    m_lastModified = QDateTime::currentDateTime();
+}
+
+void TrustStore::importStore(const QString& filePath) {
+    const QJsonArray entries = readJsonFile(filePath).value("entries").toArray();
+    for (const QJsonValue& value : entries) {
+        addEntry(entryFromJson(value.toObject()));
+    }
+}
+
+void TrustStore::exportStore(const QString& filePath) {
+    QJsonArray entries;
+    for (const TrustStoreEntry& entry : m_entries) {
+        entries.append(entryToJson(entry));
+    }
+    QJsonObject json;
+    json["entries"] = entries;
+    if (!writeJsonFile(filePath, json)) {
+        qWarning() << "Failed to write trust store" << filePath;
+    }
+}
+
+int TrustStore::getTrustedCount() const {
+    return static_cast<int>(std::count_if(m_entries.cbegin(), m_entries.cend(), [](const TrustStoreEntry& entry) {
+        return entry.trustLevel == TrustLevel::Trusted;
+    }));
+}
+
+int TrustStore::getBlockedCount() const {
+    return static_cast<int>(std::count_if(m_entries.cbegin(), m_entries.cend(), [](const TrustStoreEntry& entry) {
+        return entry.trustLevel == TrustLevel::Blocked;
+    }));
+}
+
+int TrustStore::getTotalCount() const {
+    return static_cast<int>(m_entries.size());
+}
+
+QDateTime TrustStore::getLastModified() const {
+    return m_lastModified;
+}
+
+void TrustStore::ensureStoreDirectory() {
+    QDir().mkpath(m_storeDirectory);
+}
+
+QString TrustStore::getStoreFilePath() const {
+    return QDir(m_storeDirectory).filePath("truststore.json");
+}
+
+QJsonObject TrustStore::entryToJson(const TrustStoreEntry& entry) const {
+    QJsonObject json;
+    json["fingerprint"] = entry.fingerprint;
+    json["certificate"] = QString::fromLatin1(entry.certificate.certificate.toPem());
+    json["trustLevel"] = static_cast<int>(entry.trustLevel);
+    json["description"] = entry.description;
+    json["addedDate"] = entry.addedDate.toString(Qt::ISODate);
+    json["lastUsed"] = entry.lastUsed.toString(Qt::ISODate);
+    json["addedBy"] = entry.addedBy;
+    json["isEnabled"] = entry.isEnabled;
+    json["metadata"] = entry.metadata;
+    return json;
+}
+
+TrustStoreEntry TrustStore::entryFromJson(const QJsonObject& json) const {
+    const QSslCertificate certificate(json.value("certificate").toString().toLatin1(), QSsl::Pem);
+    TrustStoreEntry entry(CertificateInfo(certificate), static_cast<TrustLevel>(json.value("trustLevel").toInt()));
+    entry.fingerprint = json.value("fingerprint").toString();
+    entry.description = json.value("description").toString();
+    entry.addedDate = QDateTime::fromString(json.value("addedDate").toString(), Qt::ISODate);
+    entry.lastUsed = QDateTime::fromString(json.value("lastUsed").toString(), Qt::ISODate);
+    entry.addedBy = json.value("addedBy").toString();
+    entry.isEnabled = json.value("isEnabled").toBool(true);
+    entry.metadata = json.value("metadata").toObject();
+    return entry;
+}
+
 // Note: MOC file will be generated automatically by CMake
@@ -33,6 +33,7 @@
 #include <QSslSocket>
 #include <QStringList>
 #include <QMap>
+#include <QHash>
 #include <QSet>
 #include <memory>
 
@@ -165,6 +166,7 @@ public:
     VerificationStatus verifySignature(const QString& pluginPath, const QString& signatureData);
     bool verifyIntegrity(const QString& pluginPath, const QString& expectedHash = "");
     QStringList verifyPluginBundle(const QStringList& pluginPaths);
+    void invalidateVerificationCache(const QString& pluginPath = QString());
     
     // Certificate management
     void addTrustedCertificate(const CertificateInfo& certificate, const QString& description = "");
@@ -237,6 +239,9 @@ private:
     void loadTrustStore();
     void saveTrustStore();
     void setupRevocationChecking();
+    SignatureInfo checkSignature(const QString& pluginPath);
+    SignatureInfo checkSignatureUncached(const QString& pluginPath);
+    void applyTrustPolicy(SignatureInfo& info) const;
     SignatureInfo extractSignatureInfo(const QString& pluginPath);
     bool validateSignatureData(const QString& signatureData, const QByteArray& pluginData, const CertificateInfo& certificate);
     QString calculateFileHash(const QString& filePath, QCryptographicHash::Algorithm algorithm = QCryptographicHash::Sha256);
@@ -367,7 +372,7 @@ signals:
 private:
     QString m_storeDirectory;
     QString m_storeFilePath;
-    QMap<QString, TrustStoreEntry> m_entries;
+    QHash<QString, TrustStoreEntry> m_entries;  // By certificate fingerprint
     QDateTime m_lastModified;
     
     void ensureStoreDirectory();
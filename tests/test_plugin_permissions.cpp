@@ -0,0 +1,128 @@
+#include <QtTest/QtTest>
+#include <QJsonObject>
+#include "../src/managers/PluginPermissionSystem.h"
+
+class PluginPermissionsTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void testDeniedByDefault();
+    void testGrantAndRevoke();
+    void testPolicy();
+    void testExpiry();
+    void testConditionalGrant();
+
+private:
+    PluginPermissionManager* m_manager = nullptr;
+};
+
+void PluginPermissionsTest::init()
+{
+    m_manager = new PluginPermissionManager(this);
+    m_manager->registerPermission(Permission("file.read", "Read files", PermissionCategory::FileSystem, PermissionType::FileRead));
+    m_manager->registerPermission(Permission("net.connect", "Connect", PermissionCategory::Network, PermissionType::NetworkConnect));
+}
+
+void PluginPermissionsTest::cleanup()
+{
+    delete m_manager;
+    m_manager = nullptr;
+}
+
+void PluginPermissionsTest::testDeniedByDefault()
+{
+    // Category defaults only apply once explicit grants are no longer required
+    m_manager->setDefaultPermissionLevel(PermissionCategory::FileSystem, PermissionLevel::Read);
+    QVERIFY(m_manager->requireExplicitGrant());
+    QVERIFY(!m_manager->hasPermission("plugin", "file.read"));
+    QVERIFY(!m_manager->hasPermission("plugin", "unknown.permission"));
+
+    m_manager->setRequireExplicitGrant(false);
+    QVERIFY(m_manager->hasPermission("plugin", "file.read"));
+    QVERIFY(!m_manager->hasPermission("plugin", "file.read", PermissionLevel::Write));
+    QVERIFY(!m_manager->hasPermission("plugin", "net.connect"));
+}
+
+void PluginPermissionsTest::testGrantAndRevoke()
+{
+    QSignalSpy granted(m_manager, &PluginPermissionManager::permissionGranted);
+    QSignalSpy revoked(m_manager, &PluginPermissionManager::permissionRevoked);
+
+    m_manager->grantPermission("plugin", "file.read", PermissionLevel::Write);
+    QCOMPARE(granted.count(), 1);
+    QVERIFY(m_manager->hasPermission("plugin", "file.read", PermissionLevel::Write));
+    QVERIFY(!m_manager->hasPermission("plugin", "file.read", PermissionLevel::Execute));
+    QVERIFY(!m_manager->hasPermission("other", "file.read"));
+    QCOMPARE(m_manager->getPermissionLevel("plugin", "file.read"), PermissionLevel::Write);
+    QVERIFY(m_manager->canPerformAction("plugin", "file.read", QJsonObject{{"level", "write"}}));
+
+    m_manager->revokePermission("plugin", "file.read");
+    QCOMPARE(revoked.count(), 1);
+    QVERIFY(!m_manager->hasPermission("plugin", "file.read"));
+    QCOMPARE(m_manager->checkPermission("plugin", "file.read"), PermissionStatus::Denied);
+}
+
+void PluginPermissionsTest::testPolicy()
+{
+    m_manager->setPermissionPolicy("network", QJsonObject{{"permissions", QJsonObject{{"net.connect", "execute"}}}});
+    QVERIFY(!m_manager->hasPermission("plugin", "net.connect"));
+
+    m_manager->applyPolicy("plugin", "network");
+    QVERIFY(m_manager->hasPermission("plugin", "net.connect", PermissionLevel::Execute));
+    QVERIFY(!m_manager->hasPermission("other", "net.connect"));
+
+    m_manager->removePermissionPolicy("network");
+    QVERIFY(!m_manager->hasPermission("plugin", "net.connect"));
+}
+
+void PluginPermissionsTest::testExpiry()
+{
+    PermissionGrant grant("file.read", "plugin", PermissionLevel::Read);
+    grant.expiryDate = QDateTime::currentDateTime().addMSecs(200);
+    m_manager->grantPermission(grant);
+    QVERIFY(m_manager->hasPermission("plugin", "file.read"));
+
+    // The expiry timer retires the grant without waiting for a check
+    QTRY_COMPARE_WITH_TIMEOUT(m_manager->getGrantedPermissions("plugin").value(0).status, PermissionStatus::Expired, 2000);
+    QVERIFY(!m_manager->hasPermission("plugin", "file.read"));
+
+    PermissionGrant expired("net.connect", "plugin", PermissionLevel::Read);
+    expired.expiryDate = QDateTime::currentDateTime().addSecs(-1);
+    m_manager->grantPermission(expired);
+    QVERIFY(!m_manager->hasPermission("plugin", "net.connect"));
+}
+
+void PluginPermissionsTest::testConditionalGrant()
+{
+    PermissionGrant grant("net.connect", "plugin", PermissionLevel::Write);
+    grant.conditions = QStringList{"host=localhost", "secure", "pluginId=plugin"};
+    m_manager->grantPermission(grant);
+
+    // Without a context the conditions cannot hold
+    QVERIFY(!m_manager->hasPermission("plugin", "net.connect"));
+    QVERIFY(!m_manager->canPerformAction("plugin", "net.connect"));
+
+    const QJsonObject context{{"host", "localhost"}, {"secure", true}};
+    QVERIFY(m_manager->canPerformAction("plugin", "net.connect", context));
+    QVERIFY(!m_manager->canPerformAction("other", "net.connect", context));
+    QVERIFY(!m_manager->canPerformAction("plugin", "net.connect", QJsonObject{{"host", "example.com"}, {"secure", true}}));
+    QVERIFY(!m_manager->canPerformAction("plugin", "net.connect", QJsonObject{{"host", "localhost"}, {"secure", false}}));
+
+    QJsonObject tooHigh = context;
+    tooHigh.insert("level", "full");
+    QVERIFY(!m_manager->canPerformAction("plugin", "net.connect", tooHigh));
+
+    // An unconditional grant on another permission does not widen the conditional one
+    m_manager->grantPermission("plugin", "file.read", PermissionLevel::Read);
+    QVERIFY(m_manager->canPerformAction("plugin", "file.read"));
+    QVERIFY(!m_manager->canPerformAction("plugin", "net.connect"));
+
+    m_manager->revokePermission("plugin", "net.connect");
+    QVERIFY(!m_manager->canPerformAction("plugin", "net.connect", context));
+}
+
+QTEST_MAIN(PluginPermissionsTest)
+#include "test_plugin_permissions.moc"